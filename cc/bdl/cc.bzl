@@ -81,21 +81,7 @@ bzd_cc_binary = macro(
     },
 )
 
-def bzd_cc_test(name, target = "//cc/targets:auto", tags = [], bdls = [], hdrs = [], srcs = [], deps = [], testonly = True, **kwargs):
-    """Rule that defines a bzd C++ test binary.
-
-    Args:
-        name: Name for the target.
-        target: The target name.
-        tags: Tags to be added to the rules.
-        bdls: BDLs to be added to the rule.
-        hdrs: Headers to be added to the rule.
-        srcs: Sources to be added to the rule.
-        deps: Dependencies to be added to the rule.
-        testonly: If this is a testonly target.
-        **kwargs: Additional attributes to be added to the `bdl_system` rule.
-    """
-
+def _bzd_cc_test_impl(name, target, tags, bdls, hdrs, srcs, deps, testonly, optimized, **kwargs):
     updated_deps = deps + []
     if bdls:
         bdl_library(
@@ -127,14 +113,111 @@ def bzd_cc_test(name, target = "//cc/targets:auto", tags = [], bdls = [], hdrs =
         testonly = testonly,
     )
 
+    binary = "{}.system.default".format(name)
+    if optimized:
+        _bzd_cc_optimized_binary(
+            name = "{}.optimized".format(name),
+            binary = binary,
+            tags = ["manual"],
+            testonly = testonly,
+        )
+        binary = "{}.optimized".format(name)
+
     bzd_runner_test(
         name = name,
-        binary = "{}.system.default".format(name),
+        binary = binary,
         testonly = testonly,
         tags = tags + ["cc"],
         **kwargs
     )
 
+def bzd_cc_test(name, target = "//cc/targets:auto", tags = [], bdls = [], hdrs = [], srcs = [], deps = [], testonly = True, **kwargs):
+    """Rule that defines a bzd C++ test binary.
+
+    Args:
+        name: Name for the target.
+        target: The target name.
+        tags: Tags to be added to the rules.
+        bdls: BDLs to be added to the rule.
+        hdrs: Headers to be added to the rule.
+        srcs: Sources to be added to the rule.
+        deps: Dependencies to be added to the rule.
+        testonly: If this is a testonly target.
+        **kwargs: Additional attributes to be added to the `bdl_system` rule.
+    """
+
+    _bzd_cc_test_impl(name = name, target = target, tags = tags, bdls = bdls, hdrs = hdrs, srcs = srcs, deps = deps, testonly = testonly, optimized = False, **kwargs)
+
+def _optimized_transition_impl(_settings, _attr):
+    return {
+        "//command_line_option:compilation_mode": "opt",
+    }
+
+_optimized_transition = transition(
+    implementation = _optimized_transition_impl,
+    inputs = [],
+    outputs = [
+        "//command_line_option:compilation_mode",
+    ],
+)
+
+def _bzd_cc_optimized_binary_impl(ctx):
+    # Due to the transition, the target becomes an array.
+    binary = ctx.attr.binary[0]
+    ctx.actions.symlink(
+        output = ctx.outputs.executable,
+        target_file = binary[DefaultInfo].files_to_run.executable,
+        is_executable = True,
+    )
+    return DefaultInfo(
+        executable = ctx.outputs.executable,
+        runfiles = binary[DefaultInfo].default_runfiles,
+    )
+
+_bzd_cc_optimized_binary = rule(
+    doc = "Build a binary in optimized mode, regardless of the compilation mode requested.",
+    implementation = _bzd_cc_optimized_binary_impl,
+    attrs = {
+        "binary": attr.label(
+            executable = True,
+            mandatory = True,
+            cfg = _optimized_transition,
+        ),
+    },
+    executable = True,
+)
+
+def bzd_cc_benchmark(name, target = "//cc/targets:auto", tags = [], bdls = [], hdrs = [], srcs = [], deps = [], testonly = True, **kwargs):
+    """Rule that defines a bzd C++ benchmark binary.
+
+    This is a test, always built in optimized mode, with allocation counting enabled. It is tagged with `benchmark`
+    so it can be selected with `--test_tag_filters=benchmark`, or excluded with `--test_tag_filters=-benchmark`.
+
+    Args:
+        name: Name for the target.
+        target: The target name.
+        tags: Tags to be added to the rules.
+        bdls: BDLs to be added to the rule.
+        hdrs: Headers to be added to the rule.
+        srcs: Sources to be added to the rule.
+        deps: Dependencies to be added to the rule.
+        testonly: If this is a testonly target.
+        **kwargs: Additional attributes to be added to the `bdl_system` rule.
+    """
+
+    _bzd_cc_test_impl(
+        name = name,
+        target = target,
+        tags = tags + ["benchmark", "exclusive"],
+        bdls = bdls,
+        hdrs = hdrs,
+        srcs = srcs,
+        deps = deps + [Label("//cc/bzd/test:allocation_counter")],
+        testonly = testonly,
+        optimized = True,
+        **kwargs
+    )
+
 def _bzd_cc_library_impl(ctx):
     # Build the list of public headers
     hdrs = sets.make(ctx.files.hdrs)
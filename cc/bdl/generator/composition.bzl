@@ -87,6 +87,8 @@ def _generator_cc_composition_impl(name, visibility, target_name, target, compos
         ],
         deps = [
             Label("//cc/bdl/generator/impl/adapter:context"),
+            Label("//cc/bzd/type_traits:is_final"),
+            Label("//cc/bzd/type_traits:remove_reference"),
             "{}.generate".format(name),
         ],
         visibility = visibility,
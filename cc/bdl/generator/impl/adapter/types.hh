@@ -5,6 +5,7 @@
 #include "cc/bzd/container/span.hh"
 #include "cc/bzd/container/vector.hh"
 #include "cc/bzd/core/error.hh"
+#include "cc/bzd/core/serialization/types/fields.hh"
 #include "cc/bzd/meta/string_literal.hh"
 #include "cc/bzd/type_traits/derived_from.hh"
 #include "cc/bzd/type_traits/function.hh"
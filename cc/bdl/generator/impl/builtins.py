@@ -82,6 +82,11 @@ class ResultType:
 		return "bzd::Result", nested
 
 
+class OptionalType:
+	constexpr = False
+	toType = "bzd::Optional"
+
+
 class AsyncType:
 	constexpr = False
 
@@ -170,5 +175,6 @@ builtins: typing.Dict[str, typing.Any] = {
 	"Array": ArrayType,
 	"Vector": VectorType,
 	"Result": ResultType,
+	"Optional": OptionalType,
 	"Callable": CallableType,
 }
@@ -1,4 +1,6 @@
 #include "cc/bdl/generator/impl/tests/manifest.hh"
+#include "cc/bzd/container/string.hh"
+#include "cc/bzd/core/serialization/serialization.hh"
 #include "cc/bzd/test/test.hh"
 
 TEST(File, Compile)
@@ -23,3 +25,40 @@ TEST(File, Compile)
 		ASSERT_EQ(listB.capacity(), 23U);
 	}
 }
+
+TEST(File, Serialization)
+{
+	bzd::test::MySerializable s;
+	s.enabled = true;
+	s.value = -12;
+	s.values.pushBack(1.5f);
+	s.values.pushBack(-2.f);
+	s.name = "bdl";
+	s.maybe = 42;
+
+	bzd::String<64u> buffer;
+	const auto size = bzd::serialize(buffer.appender(), s);
+	ASSERT_TRUE(size);
+	ASSERT_EQ(size.value(), 1u + 2u + 4u + 2u * 4u + 4u + 3u + 1u + 4u);
+
+	bzd::test::MySerializable decoded;
+	ASSERT_EQ(bzd::deserialize(buffer, decoded), size);
+	ASSERT_TRUE(decoded.enabled);
+	ASSERT_EQ(decoded.value, -12);
+	ASSERT_EQ(decoded.values.size(), 2u);
+	ASSERT_NEAR(decoded.values[1u], -2.f, 0.01);
+	ASSERT_EQ(decoded.name, "bdl"_sv);
+	ASSERT_TRUE(decoded.maybe);
+	ASSERT_EQ(decoded.maybe.value(), 42);
+
+	buffer.clear();
+	const auto compactSize = bzd::serializeCompact(buffer.appender(), s);
+	ASSERT_TRUE(compactSize);
+	ASSERT_LT(compactSize.value(), size.value());
+	ASSERT_EQ(bzd::deserializeCompact(buffer, decoded), compactSize);
+	ASSERT_EQ(decoded.value, -12);
+
+	bzd::test::Error error{bzd::test::Error::A};
+	ASSERT_EQ(bzd::deserialize(bzd::StringView{"\x02", 1u}, error).value(), 1u);
+	ASSERT_EQ(error, bzd::test::Error::C);
+}
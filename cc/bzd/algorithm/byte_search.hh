@@ -0,0 +1,280 @@
+#pragma once
+
+#include "cc/bzd/platform/types.hh"
+#include "cc/bzd/type_traits/is_enum.hh"
+#include "cc/bzd/type_traits/is_integral.hh"
+#include "cc/bzd/type_traits/is_same.hh"
+#include "cc/bzd/type_traits/iterator.hh"
+#include "cc/bzd/type_traits/remove_cvref.hh"
+#include "cc/bzd/utility/address_of.hh"
+#include "cc/bzd/utility/bit/count_lsb_zero.hh"
+#include "cc/bzd/utility/bit/count_msb_zero.hh"
+#include "cc/bzd/utility/bit/endian.hh"
+
+namespace bzd::algorithm::impl {
+
+/// Needles longer than this are searched with the Two-Way algorithm, which guarantees a linear complexity.
+inline constexpr Size byteSearchTwoWayThreshold{64u};
+
+/// Whether the elements of a contiguous iterator can be compared by their byte representation.
+template <class Iterator, class Sentinel>
+concept byteSearchable = concepts::contiguousIterator<Iterator> && typeTraits::isSame<Iterator, Sentinel> &&
+						 sizeof(typeTraits::IteratorValue<Iterator>) == 1u &&
+						 (typeTraits::isIntegral<typeTraits::RemoveCVRef<typeTraits::IteratorValue<Iterator>>> ||
+						  typeTraits::isEnum<typeTraits::RemoveCVRef<typeTraits::IteratorValue<Iterator>>>);
+
+template <class Iterator>
+[[nodiscard]] const UInt8* asBytes(const Iterator it) noexcept
+{
+	return reinterpret_cast<const UInt8*>(bzd::addressOf(*it));
+}
+
+/// Load 8 bytes from an unaligned address.
+[[nodiscard]] inline UInt64 byteSearchLoad(const UInt8* data) noexcept
+{
+	UInt64 value;
+	__builtin_memcpy(&value, data, sizeof(value));
+	return value;
+}
+
+/// Find the first occurrence of a byte.
+///
+/// \return A pointer to the first occurrence or nullptr if not found.
+[[nodiscard]] inline const UInt8* byteFind(const UInt8* haystack, const Size size, const UInt8 value) noexcept
+{
+	return static_cast<const UInt8*>(__builtin_memchr(haystack, value, size));
+}
+
+/// Search for short needles by filtering candidates on their first and last bytes, 8 positions at a time
+/// using SIMD within a register (SWAR). Only positions matching both bytes are compared in full.
+///
+/// \pre 2 <= needleSize <= haystackSize.
+[[nodiscard]] inline const UInt8* byteSearchFilter(const UInt8* haystack,
+												   const Size haystackSize,
+												   const UInt8* needle,
+												   const Size needleSize) noexcept
+{
+	constexpr UInt64 lsbs{0x0101010101010101ull};
+	constexpr UInt64 msbs{0x8080808080808080ull};
+	const UInt64 first = lsbs * needle[0];
+	const UInt64 last = lsbs * needle[needleSize - 1u];
+
+	Size offset{0u};
+	for (; offset + needleSize + 7u <= haystackSize; offset += 8u)
+	{
+		// A byte is null only where both the first and last bytes match.
+		const UInt64 x = (byteSearchLoad(haystack + offset) ^ first) | (byteSearchLoad(haystack + offset + needleSize - 1u) ^ last);
+		// False positives are possible in bytes more significant than a true positive, candidates are verified anyway.
+		UInt64 mask = (x - lsbs) & ~x & msbs;
+		while (mask)
+		{
+			Size index;
+			if constexpr (bzd::Endian::native == bzd::Endian::little)
+			{
+				index = bzd::countLSBZero(mask) / 8u;
+				mask &= mask - 1u;
+			}
+			else
+			{
+				index = bzd::countMSBZero(mask) / 8u;
+				mask &= ~(UInt64{1u} << (63u - index * 8u));
+			}
+			const auto* candidate = haystack + offset + index;
+			if (__builtin_memcmp(candidate, needle, needleSize) == 0)
+			{
+				return candidate;
+			}
+		}
+	}
+
+	for (; offset + needleSize <= haystackSize; ++offset)
+	{
+		if (haystack[offset] == needle[0] && __builtin_memcmp(haystack + offset, needle, needleSize) == 0)
+		{
+			return haystack + offset;
+		}
+	}
+	return nullptr;
+}
+
+/// Compute the critical factorization of the needle, used by the Two-Way algorithm.
+///
+/// \param[out] period The period of the right half of the needle.
+/// \return The position of the critical factorization.
+[[nodiscard]] inline Size byteSearchCriticalFactorization(const UInt8* needle, const Size needleSize, Size& period) noexcept
+{
+	// Maximal suffix for both orderings, Size(-1) stands for the empty suffix and wraps with the offsets.
+	const auto maximalSuffix = [&](const bool reversed, Size& suffixPeriod) {
+		Size suffix{static_cast<Size>(-1)};
+		Size j{0u};
+		Size k{1u};
+		suffixPeriod = 1u;
+		while (j + k < needleSize)
+		{
+			const auto a = needle[j + k];
+			const auto b = needle[suffix + k];
+			if ((reversed) ? (b < a) : (a < b))
+			{
+				j += k;
+				k = 1u;
+				suffixPeriod = j - suffix;
+			}
+			else if (a == b)
+			{
+				if (k != suffixPeriod)
+				{
+					++k;
+				}
+				else
+				{
+					j += suffixPeriod;
+					k = 1u;
+				}
+			}
+			else
+			{
+				suffix = j++;
+				k = suffixPeriod = 1u;
+			}
+		}
+		return suffix;
+	};
+
+	Size periodReversed;
+	const auto suffix = maximalSuffix(false, period);
+	const auto suffixReversed = maximalSuffix(true, periodReversed);
+	if (suffixReversed + 1u < suffix + 1u)
+	{
+		return suffix + 1u;
+	}
+	period = periodReversed;
+	return suffixReversed + 1u;
+}
+
+/// Search using the Two-Way algorithm from Crochemore and Perrin, in linear time and constant space.
+///
+/// It is combined with a bad byte shift on the last byte of the window (Horspool), which allows to skip
+/// most of the haystack on typical inputs. Shifts are capped to 255 to keep the table small.
+///
+/// \pre 2 <= needleSize <= haystackSize.
+[[nodiscard]] inline const UInt8* byteSearchTwoWay(const UInt8* haystack,
+												   const Size haystackSize,
+												   const UInt8* needle,
+												   const Size needleSize) noexcept
+{
+	Size period;
+	const auto suffix = byteSearchCriticalFactorization(needle, needleSize, period);
+
+	UInt8 shifts[256];
+	const auto maxShift = static_cast<UInt8>((needleSize < 255u) ? needleSize : 255u);
+	for (auto& shift : shifts)
+	{
+		shift = maxShift;
+	}
+	for (Size i = 0u; i < needleSize; ++i)
+	{
+		const auto distance = needleSize - i - 1u;
+		shifts[needle[i]] = static_cast<UInt8>((distance < maxShift) ? distance : maxShift);
+	}
+
+	const auto last = needleSize - 1u;
+	if (__builtin_memcmp(needle, needle + period, suffix) == 0)
+	{
+		// The needle is periodic, remember the prefix already matched to not scan it again.
+		Size memory{0u};
+		for (Size j = 0u; j <= haystackSize - needleSize;)
+		{
+			if (const auto shift = shifts[haystack[j + last]]; shift)
+			{
+				j += shift;
+				memory = 0u;
+				continue;
+			}
+			Size i = (suffix > memory) ? suffix : memory;
+			while (i < last && needle[i] == haystack[i + j])
+			{
+				++i;
+			}
+			if (i >= last)
+			{
+				i = suffix - 1u;
+				while (memory < i + 1u && needle[i] == haystack[i + j])
+				{
+					--i;
+				}
+				if (i + 1u < memory + 1u)
+				{
+					return haystack + j;
+				}
+				j += period;
+				memory = needleSize - period;
+			}
+			else
+			{
+				j += i - suffix + 1u;
+				memory = 0u;
+			}
+		}
+	}
+	else
+	{
+		// The halves of the needle are distinct, a mismatch allows a shift larger than the period.
+		const Size periodShift = ((suffix > needleSize - suffix) ? suffix : needleSize - suffix) + 1u;
+		for (Size j = 0u; j <= haystackSize - needleSize;)
+		{
+			if (const auto shift = shifts[haystack[j + last]]; shift)
+			{
+				j += shift;
+				continue;
+			}
+			Size i = suffix;
+			while (i < last && needle[i] == haystack[i + j])
+			{
+				++i;
+			}
+			if (i >= last)
+			{
+				i = suffix - 1u;
+				while (i != static_cast<Size>(-1) && needle[i] == haystack[i + j])
+				{
+					--i;
+				}
+				if (i == static_cast<Size>(-1))
+				{
+					return haystack + j;
+				}
+				j += periodShift;
+			}
+			else
+			{
+				j += i - suffix + 1u;
+			}
+		}
+	}
+	return nullptr;
+}
+
+/// Search for the first occurrence of a needle, selecting the best strategy based on its size.
+///
+/// \return A pointer to the first occurrence or nullptr if not found.
+[[nodiscard]] inline const UInt8* byteSearch(const UInt8* haystack,
+											 const Size haystackSize,
+											 const UInt8* needle,
+											 const Size needleSize) noexcept
+{
+	if (needleSize > haystackSize)
+	{
+		return nullptr;
+	}
+	if (needleSize == 1u)
+	{
+		return byteFind(haystack, haystackSize, needle[0]);
+	}
+	if (needleSize <= byteSearchTwoWayThreshold)
+	{
+		return byteSearchFilter(haystack, haystackSize, needle, needleSize);
+	}
+	return byteSearchTwoWay(haystack, haystackSize, needle, needleSize);
+}
+
+} // namespace bzd::algorithm::impl
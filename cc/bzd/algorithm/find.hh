@@ -1,8 +1,10 @@
 #pragma once
 
+#include "cc/bzd/algorithm/byte_search.hh"
 #include "cc/bzd/algorithm/find_if.hh"
 #include "cc/bzd/type_traits/sentinel_for.hh"
 #include "cc/bzd/utility/forward.hh"
+#include "cc/bzd/utility/is_constant_evaluated.hh"
 
 namespace bzd::algorithm {
 
@@ -11,9 +13,26 @@ namespace bzd::algorithm {
 /// \param[in] first The beginning of the range of elements to examine.
 /// \param[in] last The ending of the range of elements to examine.
 /// \param[in] value The value to be searched.
+///
+/// At runtime, contiguous ranges of bytes are searched with memchr.
 template <concepts::forwardIterator Iterator, concepts::sentinelFor<Iterator> Sentinel, class T>
 [[nodiscard]] constexpr Iterator find(Iterator first, Sentinel last, const T& value) noexcept
 {
+	if constexpr (impl::byteSearchable<Iterator, Sentinel> &&
+				  typeTraits::isSame<typeTraits::RemoveCVRef<T>, typeTraits::RemoveCVRef<typeTraits::IteratorValue<Iterator>>>)
+	{
+		if (!bzd::isConstantEvaluated())
+		{
+			const auto size = static_cast<Size>(last - first);
+			if (size == 0u)
+			{
+				return last;
+			}
+			const auto* data = impl::asBytes(first);
+			const auto* found = impl::byteFind(data, size, *reinterpret_cast<const UInt8*>(bzd::addressOf(value)));
+			return (found) ? first + (found - data) : last;
+		}
+	}
 	return bzd::algorithm::findIf(first, last, [&value](const auto& item) { return item == value; });
 }
 
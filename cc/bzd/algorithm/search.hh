@@ -1,11 +1,13 @@
 #pragma once
 
+#include "cc/bzd/algorithm/byte_search.hh"
 #include "cc/bzd/type_traits/iterator.hh"
 #include "cc/bzd/type_traits/predicate.hh"
 #include "cc/bzd/type_traits/range.hh"
 #include "cc/bzd/type_traits/sentinel_for.hh"
 #include "cc/bzd/utility/comparison/equal_to.hh"
 #include "cc/bzd/utility/forward.hh"
+#include "cc/bzd/utility/is_constant_evaluated.hh"
 
 namespace bzd::algorithm {
 
@@ -18,6 +20,10 @@ namespace bzd::algorithm {
 /// \param[in] predicate The binary predicate which returns \c ​true for the same elements.
 /// \return Iterator to the beginning of first occurrence of the sequence [first2, last2[ in the range [first1, last1[.
 /// If no such occurrence is found, last1 is returned.
+///
+/// At runtime, contiguous ranges of bytes compared for equality are searched with a vectorized algorithm:
+/// candidates are filtered on their first and last bytes for short sequences, while long sequences use
+/// the Two-Way algorithm, which is linear in the worst case.
 template <concepts::forwardIterator Iterator1,
 		  concepts::sentinelFor<Iterator1> Sentinel1,
 		  concepts::forwardIterator Iterator2,
@@ -27,6 +33,30 @@ template <concepts::forwardIterator Iterator1,
 [[nodiscard]] constexpr Iterator1 search(
 	Iterator1 first1, Sentinel1 last1, Iterator2 first2, Sentinel2 last2, BinaryPredicate predicate = BinaryPredicate{}) noexcept
 {
+	if constexpr (impl::byteSearchable<Iterator1, Sentinel1> && impl::byteSearchable<Iterator2, Sentinel2> &&
+				  typeTraits::isSame<typeTraits::RemoveCVRef<typeTraits::IteratorValue<Iterator1>>,
+									 typeTraits::RemoveCVRef<typeTraits::IteratorValue<Iterator2>>> &&
+				  typeTraits::isSame<BinaryPredicate,
+									 bzd::EqualTo<typeTraits::IteratorValue<Iterator1>, typeTraits::IteratorValue<Iterator2>>>)
+	{
+		if (!bzd::isConstantEvaluated())
+		{
+			const auto size1 = static_cast<Size>(last1 - first1);
+			const auto size2 = static_cast<Size>(last2 - first2);
+			if (size2 == 0u)
+			{
+				return first1;
+			}
+			if (size1 == 0u)
+			{
+				return last1;
+			}
+			const auto* data = impl::asBytes(first1);
+			const auto* found = impl::byteSearch(data, size1, impl::asBytes(first2), size2);
+			return (found) ? first1 + (found - data) : last1;
+		}
+	}
+
 	while (true)
 	{
 		auto it1 = first1;
@@ -1,18 +1,43 @@
 #pragma once
 
+#include "cc/bzd/platform/types.hh"
+#include "cc/bzd/type_traits/is_arithmetic.hh"
+#include "cc/bzd/type_traits/is_same.hh"
 #include "cc/bzd/type_traits/iterator.hh"
 #include "cc/bzd/type_traits/predicate.hh"
 #include "cc/bzd/type_traits/range.hh"
 #include "cc/bzd/type_traits/remove_cvref.hh"
 #include "cc/bzd/type_traits/sentinel_for.hh"
+#include "cc/bzd/utility/comparison/greater.hh"
 #include "cc/bzd/utility/comparison/less.hh"
 #include "cc/bzd/utility/forward.hh"
 #include "cc/bzd/utility/iterators/distance.hh"
+#include "cc/bzd/utility/move.hh"
 #include "cc/bzd/utility/swap.hh"
 
-namespace bzd::algorithm {
+namespace bzd::algorithm::impl {
+
+/// Ranges smaller than this are sorted with insertion sort.
+inline constexpr Size sortInsertionThreshold{24u};
+/// Ranges larger than this use the pseudo median of 9 elements as a pivot.
+inline constexpr Size sortNintherThreshold{128u};
+/// Maximum number of element moves allowed by partialInsertionSort before giving up.
+inline constexpr Size sortPartialInsertionLimit{8u};
+/// Number of elements processed at once by the branchless partitioning.
+inline constexpr Size sortBlockSize{64u};
+
+/// Branchless partitioning only pays off for cheap comparisons that compile to a flag, not a branch.
+template <class T, class Compare>
+inline constexpr Bool isBranchlessSort =
+	typeTraits::isArithmetic<T> && (typeTraits::isSame<Compare, bzd::Less<T>> || typeTraits::isSame<Compare, bzd::Greater<T>>);
+
+template <class Iterator>
+struct PartitionResult
+{
+	Iterator pivot;
+	Bool alreadyPartitioned;
+};
 
-namespace impl {
 /// Build a max heap where the value of each child is always smaller
 /// than the value of its parent.
 template <class Iterator, class Compare>
@@ -37,28 +62,16 @@ constexpr void makeHeap(Iterator first, Iterator last, Compare& comparison) noex
 		}
 	}
 }
-} // namespace impl
 
-/// Sorts the elements in the range [first, last) in non-descending order. The order of equal elements is not guaranteed to be preserved.
-///
-/// This implementation uses heap sort (n*log(n) complexity), sorts elements in-place
-/// and does not require extra memory (stack or other) to process.
+/// Heap sort (n*log(n) complexity), used as a fallback when the quicksort degenerates.
 /// The implementation is inspired by: https://www.geeksforgeeks.org/iterative-heap-sort/
-///
-/// \param[in,out] first The beginning of the range of elements to be sorted.
-/// \param[in,out] last The ending of the range of elements to be sorted.
-/// \param[in] comparison Comparison function object which returns ​true if the first argument is less than (i.e. is ordered before) the
-/// second.
-template <concepts::randomAccessIterator Iterator,
-		  concepts::sentinelFor<Iterator> Sentinel,
-		  concepts::predicate<typeTraits::IteratorValue<Iterator>, typeTraits::IteratorValue<Iterator>> Compare =
-			  bzd::Less<typeTraits::IteratorValue<Iterator>>>
-constexpr void sort(Iterator first, Sentinel last, Compare comparison = Compare{}) noexcept
+template <class Iterator, class Compare>
+constexpr void heapSort(Iterator first, Iterator last, Compare& comparison) noexcept
 {
 	const auto size = bzd::distance(first, last);
 	using IndexType = typeTraits::RemoveCVRef<decltype(size)>;
 
-	impl::makeHeap(first, last, comparison);
+	makeHeap(first, last, comparison);
 
 	for (IndexType i = size - 1; i > 0; i--)
 	{
@@ -91,6 +104,533 @@ constexpr void sort(Iterator first, Sentinel last, Compare comparison = Compare{
 	}
 }
 
+/// Order 2 elements, without branches for arithmetic types.
+template <class Iterator, class Compare>
+constexpr void sort2(Iterator a, Iterator b, Compare& comparison) noexcept
+{
+	using Value = typeTraits::IteratorValue<Iterator>;
+	if constexpr (isBranchlessSort<Value, Compare>)
+	{
+		const Bool swap = comparison(*b, *a);
+		const Value smaller = swap ? *b : *a;
+		*b = swap ? *a : *b;
+		*a = smaller;
+	}
+	else
+	{
+		if (comparison(*b, *a))
+		{
+			bzd::swap(*a, *b);
+		}
+	}
+}
+
+/// Order 3 elements.
+template <class Iterator, class Compare>
+constexpr void sort3(Iterator a, Iterator b, Iterator c, Compare& comparison) noexcept
+{
+	sort2(a, b, comparison);
+	sort2(b, c, comparison);
+	sort2(a, b, comparison);
+}
+
+/// Sort ranges of up to 5 elements with optimal sorting networks.
+///
+/// \return true if the range was sorted, false if it is too large.
+template <class Iterator, class Compare>
+constexpr Bool sortNetwork(Iterator first, const Size size, Compare& comparison) noexcept
+{
+	switch (size)
+	{
+	case 0u:
+	case 1u:
+		return true;
+	case 2u:
+		sort2(first, first + 1, comparison);
+		return true;
+	case 3u:
+		sort3(first, first + 1, first + 2, comparison);
+		return true;
+	case 4u:
+		sort2(first, first + 1, comparison);
+		sort2(first + 2, first + 3, comparison);
+		sort2(first, first + 2, comparison);
+		sort2(first + 1, first + 3, comparison);
+		sort2(first + 1, first + 2, comparison);
+		return true;
+	case 5u:
+		sort2(first, first + 1, comparison);
+		sort2(first + 3, first + 4, comparison);
+		sort2(first + 2, first + 4, comparison);
+		sort2(first + 2, first + 3, comparison);
+		sort2(first, first + 3, comparison);
+		sort2(first, first + 2, comparison);
+		sort2(first + 1, first + 4, comparison);
+		sort2(first + 1, first + 3, comparison);
+		sort2(first + 1, first + 2, comparison);
+		return true;
+	default:
+		return false;
+	}
+}
+
+/// Insertion sort, guarded means that it does not assume an element smaller or equal exists before the range.
+template <Bool guarded, class Iterator, class Compare>
+constexpr void insertionSort(Iterator first, Iterator last, Compare& comparison) noexcept
+{
+	if (first == last)
+	{
+		return;
+	}
+	for (auto current = first + 1; current != last; ++current)
+	{
+		auto sift = current;
+		auto previous = current - 1;
+		if (comparison(*sift, *previous))
+		{
+			auto temp = bzd::move(*sift);
+			do
+			{
+				*sift-- = bzd::move(*previous);
+			} while ((!guarded || sift != first) && comparison(temp, *--previous));
+			*sift = bzd::move(temp);
+		}
+	}
+}
+
+/// Attempt an insertion sort, but give up if too many elements had to be moved.
+///
+/// \return true if the range is sorted, false otherwise.
+template <class Iterator, class Compare>
+constexpr Bool partialInsertionSort(Iterator first, Iterator last, Compare& comparison) noexcept
+{
+	if (first == last)
+	{
+		return true;
+	}
+	Size moves{0u};
+	for (auto current = first + 1; current != last; ++current)
+	{
+		auto sift = current;
+		auto previous = current - 1;
+		if (comparison(*sift, *previous))
+		{
+			auto temp = bzd::move(*sift);
+			do
+			{
+				*sift-- = bzd::move(*previous);
+			} while (sift != first && comparison(temp, *--previous));
+			*sift = bzd::move(temp);
+			moves += static_cast<Size>(current - sift);
+		}
+		if (moves > sortPartialInsertionLimit)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+/// Partition [first, last) around the pivot *first, elements equal to the pivot go to the right.
+/// It assumes that an element greater or equal to the pivot exists at or after last - 1, and one smaller
+/// or equal before first + 1 (the pivot itself).
+template <class Iterator, class Compare>
+constexpr PartitionResult<Iterator> partitionRight(const Iterator begin, const Iterator end, Compare& comparison) noexcept
+{
+	auto pivot = bzd::move(*begin);
+	auto first = begin;
+	auto last = end;
+
+	// Find the first element greater or equal than the pivot (the median of 3 guarantees it exists).
+	while (comparison(*++first, pivot))
+	{
+	}
+	// Find the first element strictly smaller than the pivot, guard it only if there was no element before.
+	if (first - 1 == begin)
+	{
+		while ((last - first) > 0 && !comparison(*--last, pivot))
+		{
+		}
+	}
+	else
+	{
+		while (!comparison(*--last, pivot))
+		{
+		}
+	}
+
+	const Bool alreadyPartitioned = ((last - first) <= 0);
+	while ((last - first) > 0)
+	{
+		bzd::swap(*first, *last);
+		while (comparison(*++first, pivot))
+		{
+		}
+		while (!comparison(*--last, pivot))
+		{
+		}
+	}
+
+	const auto pivotPosition = first - 1;
+	*begin = bzd::move(*pivotPosition);
+	*pivotPosition = bzd::move(pivot);
+	return {pivotPosition, alreadyPartitioned};
+}
+
+/// Swap the elements located at the offsets, with a cyclic permutation when possible which halves the number of moves.
+template <class Iterator>
+constexpr void swapOffsets(const Iterator first,
+						   const Iterator last,
+						   const UInt8* offsetsLeft,
+						   const UInt8* offsetsRight,
+						   const Size count,
+						   const Bool useSwaps) noexcept
+{
+	if (useSwaps)
+	{
+		// Needed when the number of elements is the same on both sides, to avoid a permutation cycle that would be incorrect.
+		for (Size i = 0u; i < count; ++i)
+		{
+			bzd::swap(*(first + offsetsLeft[i]), *(last - offsetsRight[i]));
+		}
+	}
+	else if (count > 0u)
+	{
+		auto left = first + offsetsLeft[0];
+		auto right = last - offsetsRight[0];
+		auto temp = bzd::move(*left);
+		*left = bzd::move(*right);
+		for (Size i = 1u; i < count; ++i)
+		{
+			left = first + offsetsLeft[i];
+			*right = bzd::move(*left);
+			right = last - offsetsRight[i];
+			*left = bzd::move(*right);
+		}
+		*right = bzd::move(temp);
+	}
+}
+
+/// Same as partitionRight but the comparison results are stored into offset blocks instead of branching on them.
+/// This is the BlockQuicksort approach: it avoids branch mispredictions which dominate when comparisons are cheap.
+template <class Iterator, class Compare>
+constexpr PartitionResult<Iterator> partitionRightBranchless(const Iterator begin, const Iterator end, Compare& comparison) noexcept
+{
+	auto pivot = bzd::move(*begin);
+	auto first = begin;
+	auto last = end;
+
+	while (comparison(*++first, pivot))
+	{
+	}
+	if (first - 1 == begin)
+	{
+		while ((last - first) > 0 && !comparison(*--last, pivot))
+		{
+		}
+	}
+	else
+	{
+		while (!comparison(*--last, pivot))
+		{
+		}
+	}
+
+	const Bool alreadyPartitioned = ((last - first) <= 0);
+	if (!alreadyPartitioned)
+	{
+		bzd::swap(*first, *last);
+		++first;
+
+		UInt8 offsetsLeft[sortBlockSize]{};
+		UInt8 offsetsRight[sortBlockSize]{};
+		auto offsetsLeftBase = first;
+		auto offsetsRightBase = last;
+		Size countLeft{0u};
+		Size countRight{0u};
+		Size startLeft{0u};
+		Size startRight{0u};
+
+		while ((last - first) > 0)
+		{
+			// Fill the offset blocks with elements that are on the wrong side.
+			const auto unknown = static_cast<Size>(last - first);
+			const Size leftSplit = (countLeft == 0u) ? ((countRight == 0u) ? unknown / 2u : unknown) : 0u;
+			const Size rightSplit = (countRight == 0u) ? (unknown - leftSplit) : 0u;
+
+			const Size leftBlock = (leftSplit < sortBlockSize) ? leftSplit : sortBlockSize;
+			for (Size i = 0u; i < leftBlock; ++i, ++first)
+			{
+				offsetsLeft[countLeft] = static_cast<UInt8>(i);
+				countLeft += !comparison(*first, pivot);
+			}
+			const Size rightBlock = (rightSplit < sortBlockSize) ? rightSplit : sortBlockSize;
+			for (Size i = 0u; i < rightBlock;)
+			{
+				offsetsRight[countRight] = static_cast<UInt8>(++i);
+				countRight += comparison(*--last, pivot);
+			}
+
+			// Swap the elements and update the blocks.
+			const Size count = (countLeft < countRight) ? countLeft : countRight;
+			swapOffsets(offsetsLeftBase,
+						offsetsRightBase,
+						offsetsLeft + startLeft,
+						offsetsRight + startRight,
+						count,
+						countLeft == countRight);
+			countLeft -= count;
+			countRight -= count;
+			startLeft += count;
+			startRight += count;
+			if (countLeft == 0u)
+			{
+				startLeft = 0u;
+				offsetsLeftBase = first;
+			}
+			if (countRight == 0u)
+			{
+				startRight = 0u;
+				offsetsRightBase = last;
+			}
+		}
+
+		// At most one block has remaining elements, move them to the frontier.
+		if (countLeft)
+		{
+			const UInt8* offsets = offsetsLeft + startLeft;
+			while (countLeft--)
+			{
+				bzd::swap(*(offsetsLeftBase + offsets[countLeft]), *--last);
+			}
+			first = last;
+		}
+		if (countRight)
+		{
+			const UInt8* offsets = offsetsRight + startRight;
+			while (countRight--)
+			{
+				bzd::swap(*(offsetsRightBase - offsets[countRight]), *first);
+				++first;
+			}
+			last = first;
+		}
+	}
+
+	const auto pivotPosition = first - 1;
+	*begin = bzd::move(*pivotPosition);
+	*pivotPosition = bzd::move(pivot);
+	return {pivotPosition, alreadyPartitioned};
+}
+
+/// Partition [first, last) around the pivot *first, elements equal to the pivot go to the left.
+/// This is used when the pivot is equal to the element preceding the range, in which case all
+/// elements equal to the pivot are already at their final position.
+template <class Iterator, class Compare>
+constexpr Iterator partitionLeft(const Iterator begin, const Iterator end, Compare& comparison) noexcept
+{
+	auto pivot = bzd::move(*begin);
+	auto first = begin;
+	auto last = end;
+
+	while (comparison(pivot, *--last))
+	{
+	}
+	if (last + 1 == end)
+	{
+		while ((last - first) > 0 && !comparison(pivot, *++first))
+		{
+		}
+	}
+	else
+	{
+		while (!comparison(pivot, *++first))
+		{
+		}
+	}
+
+	while ((last - first) > 0)
+	{
+		bzd::swap(*first, *last);
+		while (comparison(pivot, *--last))
+		{
+		}
+		while (!comparison(pivot, *++first))
+		{
+		}
+	}
+
+	const auto pivotPosition = last;
+	*begin = bzd::move(*pivotPosition);
+	*pivotPosition = bzd::move(pivot);
+	return pivotPosition;
+}
+
+/// Select the pivot and move it at the beginning of the range.
+template <class Iterator, class Compare>
+constexpr void selectPivot(const Iterator first, const Iterator last, Compare& comparison) noexcept
+{
+	const auto size = static_cast<Size>(last - first);
+	const auto half = size / 2u;
+	if (size > sortNintherThreshold)
+	{
+		// Tukey's ninther, the median of the medians of 3 groups.
+		sort3(first, first + half, last - 1, comparison);
+		sort3(first + 1, first + (half - 1), last - 2, comparison);
+		sort3(first + 2, first + (half + 1), last - 3, comparison);
+		sort3(first + (half - 1), first + half, first + (half + 1), comparison);
+		bzd::swap(*first, *(first + half));
+	}
+	else
+	{
+		sort3(first + half, first, last - 1, comparison);
+	}
+}
+
+/// Swap a few elements to break patterns that made the partition unbalanced.
+template <class Iterator>
+constexpr void breakPatterns(const Iterator first, const Iterator last) noexcept
+{
+	const auto size = static_cast<Size>(last - first);
+	if (size >= sortInsertionThreshold)
+	{
+		const auto quarter = size / 4u;
+		bzd::swap(*first, *(first + quarter));
+		bzd::swap(*(last - 1), *(last - quarter));
+		if (size > sortNintherThreshold)
+		{
+			bzd::swap(*(first + 1), *(first + (quarter + 1u)));
+			bzd::swap(*(first + 2), *(first + (quarter + 2u)));
+			bzd::swap(*(last - 2), *(last - (quarter + 1u)));
+			bzd::swap(*(last - 3), *(last - (quarter + 2u)));
+		}
+	}
+}
+
+/// Partition the range with the best strategy for this comparison.
+template <class Iterator, class Compare>
+constexpr PartitionResult<Iterator> partition(const Iterator first, const Iterator last, Compare& comparison) noexcept
+{
+	if constexpr (isBranchlessSort<typeTraits::IteratorValue<Iterator>, Compare>)
+	{
+		return partitionRightBranchless(first, last, comparison);
+	}
+	else
+	{
+		return partitionRight(first, last, comparison);
+	}
+}
+
+/// Pattern-defeating quicksort.
+///
+/// \param badAllowed Number of unbalanced partitions allowed before falling back to heap sort.
+/// \param leftmost Whether the range is the leftmost part, if not, the element preceding the range
+/// is smaller or equal to all the elements of the range.
+template <class Iterator, class Compare>
+constexpr void patternDefeatingQuickSort(Iterator first, Iterator last, Compare& comparison, Size badAllowed, Bool leftmost) noexcept
+{
+	while (true)
+	{
+		const auto size = static_cast<Size>(last - first);
+		if (sortNetwork(first, size, comparison))
+		{
+			return;
+		}
+		if (size < sortInsertionThreshold)
+		{
+			if (leftmost)
+			{
+				insertionSort</*guarded*/ true>(first, last, comparison);
+			}
+			else
+			{
+				insertionSort</*guarded*/ false>(first, last, comparison);
+			}
+			return;
+		}
+
+		selectPivot(first, last, comparison);
+
+		// If the pivot is equal to the preceding element (the pivot of a previous partition), this range
+		// contains many equal elements, put them all on the left side, they are at their final position.
+		if (!leftmost && !comparison(*(first - 1), *first))
+		{
+			first = partitionLeft(first, last, comparison) + 1;
+			continue;
+		}
+
+		const auto [pivot, alreadyPartitioned] = impl::partition(first, last, comparison);
+		const auto sizeLeft = static_cast<Size>(pivot - first);
+		const auto sizeRight = static_cast<Size>(last - (pivot + 1));
+
+		if (sizeLeft < size / 8u || sizeRight < size / 8u)
+		{
+			if (--badAllowed == 0u)
+			{
+				heapSort(first, last, comparison);
+				return;
+			}
+			breakPatterns(first, pivot);
+			breakPatterns(pivot + 1, last);
+		}
+		else if (alreadyPartitioned && partialInsertionSort(first, pivot, comparison) &&
+				 partialInsertionSort(pivot + 1, last, comparison))
+		{
+			// The range was very likely already sorted.
+			return;
+		}
+
+		// Recurse into the smaller part and iterate over the larger one, to bound the stack usage to log(n).
+		if (sizeLeft < sizeRight)
+		{
+			patternDefeatingQuickSort(first, pivot, comparison, badAllowed, leftmost);
+			first = pivot + 1;
+			leftmost = false;
+		}
+		else
+		{
+			patternDefeatingQuickSort(pivot + 1, last, comparison, badAllowed, /*leftmost*/ false);
+			last = pivot;
+		}
+	}
+}
+
+/// Number of unbalanced partitions tolerated for a range of this size, log2(size).
+constexpr Size sortBadAllowed(Size size) noexcept
+{
+	Size log{0u};
+	while (size >>= 1u)
+	{
+		++log;
+	}
+	return log;
+}
+
+} // namespace bzd::algorithm::impl
+
+namespace bzd::algorithm {
+
+/// Sorts the elements in the range [first, last) in non-descending order. The order of equal elements is not guaranteed to be preserved.
+///
+/// This implementation uses a pattern-defeating quicksort (n*log(n) complexity), with sorting networks and insertion sort
+/// for small ranges, branchless block partitioning for arithmetic types and a heap sort fallback on adversarial inputs.
+/// It sorts elements in-place and does not require extra memory other than a bounded amount of stack.
+///
+/// \param[in,out] first The beginning of the range of elements to be sorted.
+/// \param[in,out] last The ending of the range of elements to be sorted.
+/// \param[in] comparison Comparison function object which returns ​true if the first argument is less than (i.e. is ordered before) the
+/// second.
+template <concepts::randomAccessIterator Iterator,
+		  concepts::sentinelFor<Iterator> Sentinel,
+		  concepts::predicate<typeTraits::IteratorValue<Iterator>, typeTraits::IteratorValue<Iterator>> Compare =
+			  bzd::Less<typeTraits::IteratorValue<Iterator>>>
+constexpr void sort(Iterator first, Sentinel last, Compare comparison = Compare{}) noexcept
+{
+	const auto size = bzd::distance(first, last);
+	const auto end = first + size;
+	impl::patternDefeatingQuickSort(first, end, comparison, impl::sortBadAllowed(static_cast<Size>(size)), /*leftmost*/ true);
+}
+
 /// \copydoc sort
 /// \param[in,out] range The range of elements to be sorted.
 template <concepts::randomAccessRange Range, class... Args>
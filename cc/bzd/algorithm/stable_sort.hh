@@ -0,0 +1,207 @@
+#pragma once
+
+#include "cc/bzd/algorithm/lower_bound.hh"
+#include "cc/bzd/algorithm/reverse.hh"
+#include "cc/bzd/algorithm/sort.hh"
+#include "cc/bzd/algorithm/upper_bound.hh"
+#include "cc/bzd/platform/types.hh"
+#include "cc/bzd/type_traits/iterator.hh"
+#include "cc/bzd/type_traits/predicate.hh"
+#include "cc/bzd/type_traits/range.hh"
+#include "cc/bzd/type_traits/sentinel_for.hh"
+#include "cc/bzd/utility/comparison/less.hh"
+#include "cc/bzd/utility/forward.hh"
+#include "cc/bzd/utility/iterators/distance.hh"
+#include "cc/bzd/utility/move.hh"
+
+namespace bzd::algorithm::impl {
+
+/// Size of the runs sorted with insertion sort before being merged.
+inline constexpr Size stableSortRunSize{16u};
+
+/// Merge [first, middle) and [middle, last) using the buffer, which must hold at least the smallest of both halves.
+template <class Iterator, class BufferIterator, class Compare>
+constexpr void mergeWithBuffer(Iterator first,
+							   Iterator middle,
+							   Iterator last,
+							   const Size sizeLeft,
+							   const Size sizeRight,
+							   BufferIterator buffer,
+							   Compare& comparison) noexcept
+{
+	if (sizeLeft <= sizeRight)
+	{
+		// Move the left half into the buffer and merge forward.
+		auto bufferLast = buffer;
+		for (auto it = first; it != middle; ++it, ++bufferLast)
+		{
+			*bufferLast = bzd::move(*it);
+		}
+		auto left = buffer;
+		auto output = first;
+		while (left != bufferLast && middle != last)
+		{
+			// Take from the right only if strictly smaller, to preserve the order of equal elements.
+			if (comparison(*middle, *left))
+			{
+				*output++ = bzd::move(*middle++);
+			}
+			else
+			{
+				*output++ = bzd::move(*left++);
+			}
+		}
+		while (left != bufferLast)
+		{
+			*output++ = bzd::move(*left++);
+		}
+	}
+	else
+	{
+		// Move the right half into the buffer and merge backward.
+		auto bufferLast = buffer;
+		for (auto it = middle; it != last; ++it, ++bufferLast)
+		{
+			*bufferLast = bzd::move(*it);
+		}
+		auto right = bufferLast;
+		auto output = last;
+		while (right != buffer && middle != first)
+		{
+			if (comparison(*(right - 1), *(middle - 1)))
+			{
+				*--output = bzd::move(*--middle);
+			}
+			else
+			{
+				*--output = bzd::move(*--right);
+			}
+		}
+		while (right != buffer)
+		{
+			*--output = bzd::move(*--right);
+		}
+	}
+}
+
+/// Exchange [first, middle) and [middle, last).
+///
+/// \return The new position of first.
+template <class Iterator>
+constexpr Iterator rotate(Iterator first, Iterator middle, Iterator last) noexcept
+{
+	bzd::algorithm::reverse(first, middle);
+	bzd::algorithm::reverse(middle, last);
+	bzd::algorithm::reverse(first, last);
+	return first + (last - middle);
+}
+
+/// Merge [first, middle) and [middle, last), using the buffer when it is large enough, otherwise split
+/// the problem with rotations until it is.
+template <class Iterator, class BufferIterator, class Compare>
+constexpr void merge(Iterator first,
+					 Iterator middle,
+					 Iterator last,
+					 const Size sizeLeft,
+					 const Size sizeRight,
+					 BufferIterator buffer,
+					 const Size bufferSize,
+					 Compare& comparison) noexcept
+{
+	if (sizeLeft == 0u || sizeRight == 0u)
+	{
+		return;
+	}
+	// Nothing to do if the halves are already in order.
+	if (!comparison(*middle, *(middle - 1)))
+	{
+		return;
+	}
+	if (sizeLeft + sizeRight == 2u)
+	{
+		bzd::swap(*first, *middle);
+		return;
+	}
+	if (sizeLeft <= bufferSize || sizeRight <= bufferSize)
+	{
+		mergeWithBuffer(first, middle, last, sizeLeft, sizeRight, buffer, comparison);
+		return;
+	}
+
+	Iterator cutLeft{first};
+	Iterator cutRight{middle};
+	if (sizeLeft > sizeRight)
+	{
+		cutLeft = first + sizeLeft / 2u;
+		cutRight = bzd::algorithm::lowerBound(middle, last, *cutLeft, comparison);
+	}
+	else
+	{
+		cutRight = middle + sizeRight / 2u;
+		cutLeft = bzd::algorithm::upperBound(first, middle, *cutRight, comparison);
+	}
+	const auto newMiddle = impl::rotate(cutLeft, middle, cutRight);
+	const auto sizeCutLeft = static_cast<Size>(cutLeft - first);
+	const auto sizeCutRight = static_cast<Size>(cutRight - middle);
+	impl::merge(first, cutLeft, newMiddle, sizeCutLeft, sizeCutRight, buffer, bufferSize, comparison);
+	impl::merge(newMiddle, cutRight, last, sizeLeft - sizeCutLeft, sizeRight - sizeCutRight, buffer, bufferSize, comparison);
+}
+
+} // namespace bzd::algorithm::impl
+
+namespace bzd::algorithm {
+
+/// Sorts the elements in the range [first, last) in non-descending order. The order of equal elements is preserved.
+///
+/// This implementation is a bottom-up merge sort over runs sorted with insertion sort. It uses the buffer
+/// provided by the caller: with a buffer of at least half the size of the range, the complexity is n*log(n),
+/// with a smaller buffer (or none), merges fall back to rotations and the complexity degrades to n*log(n)^2.
+///
+/// \param[in,out] first The beginning of the range of elements to be sorted.
+/// \param[in,out] last The ending of the range of elements to be sorted.
+/// \param[in,out] buffer A scratch range of elements used during the merges, its content is unspecified after the call.
+/// \param[in] comparison Comparison function object which returns ​true if the first argument is less than (i.e. is ordered before) the
+/// second.
+template <concepts::randomAccessIterator Iterator,
+		  concepts::sentinelFor<Iterator> Sentinel,
+		  concepts::randomAccessRange Buffer,
+		  concepts::predicate<typeTraits::IteratorValue<Iterator>, typeTraits::IteratorValue<Iterator>> Compare =
+			  bzd::Less<typeTraits::IteratorValue<Iterator>>>
+constexpr void stableSort(Iterator first, Sentinel last, Buffer&& buffer, Compare comparison = Compare{}) noexcept
+{
+	const auto size = static_cast<Size>(bzd::distance(first, last));
+	const auto bufferFirst = bzd::begin(buffer);
+	const auto bufferSize = static_cast<Size>(bzd::size(buffer));
+
+	for (Size index = 0u; index < size; index += impl::stableSortRunSize)
+	{
+		const auto runSize = (size - index < impl::stableSortRunSize) ? size - index : impl::stableSortRunSize;
+		impl::insertionSort</*guarded*/ true>(first + index, first + (index + runSize), comparison);
+	}
+
+	for (Size width = impl::stableSortRunSize; width < size; width *= 2u)
+	{
+		for (Size index = 0u; index + width < size; index += 2u * width)
+		{
+			const auto sizeRight = (size - index - width < width) ? size - index - width : width;
+			impl::merge(first + index,
+						first + (index + width),
+						first + (index + width + sizeRight),
+						width,
+						sizeRight,
+						bufferFirst,
+						bufferSize,
+						comparison);
+		}
+	}
+}
+
+/// \copydoc stableSort
+/// \param[in,out] range The range of elements to be sorted.
+template <concepts::randomAccessRange Range, concepts::randomAccessRange Buffer, class... Args>
+constexpr void stableSort(Range&& range, Buffer&& buffer, Args&&... args) noexcept
+{
+	bzd::algorithm::stableSort(bzd::begin(range), bzd::end(range), bzd::forward<Buffer>(buffer), bzd::forward<Args>(args)...);
+}
+
+} // namespace bzd::algorithm
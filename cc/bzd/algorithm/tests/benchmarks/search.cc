@@ -0,0 +1,100 @@
+#include "cc/bzd/algorithm/find.hh"
+#include "cc/bzd/algorithm/search.hh"
+#include "cc/bzd/container/array.hh"
+#include "cc/bzd/test/test.hh"
+
+#include <algorithm>
+
+namespace {
+
+/// Haystack made of lowercase letters only, so the needles below only match at its end.
+template <bzd::Size size>
+auto& makeHaystack(auto& test) noexcept
+{
+	static bzd::Array<char, size> haystack;
+	for (auto& c : haystack)
+	{
+		c = static_cast<char>('a' + test.template random<bzd::UInt32, 0, 25>());
+	}
+	return haystack;
+}
+
+} // namespace
+
+// Outside of the anonymous namespace to keep the benchmark names short.
+struct Bzd
+{
+	static auto find(const auto& range, const char c) { return bzd::algorithm::find(range.begin(), range.end(), c); }
+	static auto search(const auto& range, const auto& needle)
+	{
+		return bzd::algorithm::search(range.begin(), range.end(), needle.begin(), needle.end());
+	}
+};
+
+struct Std
+{
+	static auto find(const auto& range, const char c) { return std::find(range.data(), range.data() + range.size(), c); }
+	static auto search(const auto& range, const auto& needle)
+	{
+		return std::search(range.data(), range.data() + range.size(), needle.data(), needle.data() + needle.size());
+	}
+};
+
+/// Implementation to benchmark with the size of the haystack.
+template <class Impl, bzd::Size haystackSize>
+struct Haystack : Impl
+{
+	static constexpr bzd::Size size{haystackSize};
+};
+
+#define BENCHMARK_HAYSTACKS                                                                                                                \
+	(Haystack<Bzd, 256u>,                                                                                                                  \
+	 Haystack<Std, 256u>,                                                                                                                  \
+	 Haystack<Bzd, 4096u>,                                                                                                                 \
+	 Haystack<Std, 4096u>,                                                                                                                 \
+	 Haystack<Bzd, 65536u>,                                                                                                                \
+	 Haystack<Std, 65536u>)
+
+BENCHMARK(ByteSearch, Find, BENCHMARK_HAYSTACKS)
+{
+	auto& haystack = makeHaystack<TestType::size>(test);
+	haystack[TestType::size - 1u] = '#';
+
+	benchmark.setBytesPerIteration(TestType::size);
+	for (auto _ : benchmark)
+	{
+		bzd::test::doNotOptimize(TestType::find(haystack, '#'));
+	}
+}
+
+BENCHMARK(ByteSearch, Short, BENCHMARK_HAYSTACKS)
+{
+	auto& haystack = makeHaystack<TestType::size>(test);
+	const bzd::StringView needle{"#needle#"};
+	bzd::algorithm::copy(needle, haystack.end() - needle.size());
+
+	benchmark.setBytesPerIteration(TestType::size);
+	for (auto _ : benchmark)
+	{
+		bzd::test::doNotOptimize(TestType::search(haystack, needle));
+	}
+}
+
+BENCHMARK(ByteSearch, Long, BENCHMARK_HAYSTACKS)
+{
+	auto& haystack = makeHaystack<TestType::size>(test);
+	// Long needle matching partially at many positions.
+	static bzd::Array<char, 256u> needle;
+	for (auto& c : needle)
+	{
+		c = 'a';
+	}
+	needle[needle.size() - 1u] = '#';
+	bzd::algorithm::copy(needle, haystack.end() - needle.size());
+
+	benchmark.setBytesPerIteration(TestType::size);
+	for (auto _ : benchmark)
+	{
+		bzd::test::doNotOptimize(TestType::search(haystack, needle));
+	}
+}
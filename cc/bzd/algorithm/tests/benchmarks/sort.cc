@@ -0,0 +1,87 @@
+#include "cc/bzd/algorithm/copy.hh"
+#include "cc/bzd/algorithm/reverse.hh"
+#include "cc/bzd/algorithm/sort.hh"
+#include "cc/bzd/algorithm/stable_sort.hh"
+#include "cc/bzd/container/array.hh"
+#include "cc/bzd/test/test.hh"
+
+#include <algorithm>
+
+namespace {
+
+constexpr bzd::Size size{4096u};
+
+} // namespace
+
+// Outside of the anonymous namespace to keep the benchmark names short.
+struct Sort
+{
+	static void sort(auto& array) { bzd::algorithm::sort(array.begin(), array.end()); }
+};
+
+struct StableSort
+{
+	static void sort(auto& array)
+	{
+		static bzd::Array<bzd::UInt32, size> buffer;
+		bzd::algorithm::stableSort(array, buffer);
+	}
+};
+
+struct StdSort
+{
+	static void sort(auto& array) { std::sort(array.data(), array.data() + array.size()); }
+};
+
+struct StdStableSort
+{
+	static void sort(auto& array) { std::stable_sort(array.data(), array.data() + array.size()); }
+};
+
+BENCHMARK(Sort, Random, (Sort, StdSort, StableSort, StdStableSort))
+{
+	static bzd::Array<bzd::UInt32, size> input;
+	static bzd::Array<bzd::UInt32, size> array;
+	test.fillRandom(input);
+
+	benchmark.setItemsPerIteration(size);
+	for (auto _ : benchmark)
+	{
+		bzd::algorithm::copy(input, array);
+		TestType::sort(array);
+		bzd::test::clobberMemory();
+	}
+}
+
+BENCHMARK(Sort, Ascending, (Sort, StdSort, StableSort, StdStableSort))
+{
+	static bzd::Array<bzd::UInt32, size> input;
+	static bzd::Array<bzd::UInt32, size> array;
+	test.fillRandom(input);
+	bzd::algorithm::sort(input.begin(), input.end());
+
+	benchmark.setItemsPerIteration(size);
+	for (auto _ : benchmark)
+	{
+		bzd::algorithm::copy(input, array);
+		TestType::sort(array);
+		bzd::test::clobberMemory();
+	}
+}
+
+BENCHMARK(Sort, Descending, (Sort, StdSort, StableSort, StdStableSort))
+{
+	static bzd::Array<bzd::UInt32, size> input;
+	static bzd::Array<bzd::UInt32, size> array;
+	test.fillRandom(input);
+	bzd::algorithm::sort(input.begin(), input.end());
+	bzd::algorithm::reverse(input);
+
+	benchmark.setItemsPerIteration(size);
+	for (auto _ : benchmark)
+	{
+		bzd::algorithm::copy(input, array);
+		TestType::sort(array);
+		bzd::test::clobberMemory();
+	}
+}
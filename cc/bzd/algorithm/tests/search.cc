@@ -1,6 +1,9 @@
 #include "cc/bzd/algorithm/search.hh"
 
+#include "cc/bzd/algorithm/find.hh"
+#include "cc/bzd/algorithm/rsearch.hh"
 #include "cc/bzd/container/array.hh"
+#include "cc/bzd/container/string_view.hh"
 #include "cc/bzd/test/test.hh"
 
 TEST(Search, Base)
@@ -43,3 +46,91 @@ TEST(Search, Base)
 		EXPECT_EQ(it, array1.begin());
 	}
 }
+
+TEST(Search, Bytes)
+{
+	const auto haystack = "the quick brown fox jumps over the lazy dog, the quick brown fox jumps over the lazy cat"_sv;
+
+	EXPECT_EQ(haystack.find("t"_sv), 0u);
+	EXPECT_EQ(haystack.find("fox"_sv), 16u);
+	EXPECT_EQ(haystack.find("fox"_sv, 17u), 61u);
+	EXPECT_EQ(haystack.find("cat"_sv), 85u);
+	EXPECT_EQ(haystack.find("cow"_sv), bzd::npos);
+	EXPECT_EQ(haystack.find(""_sv), 0u);
+	EXPECT_EQ(haystack.find('z'), 37u);
+	EXPECT_EQ(haystack.find('!'), bzd::npos);
+	EXPECT_EQ(""_sv.find("a"_sv), bzd::npos);
+	EXPECT_EQ(haystack.find(haystack), 0u);
+
+	// Long needles.
+	EXPECT_EQ(haystack.find("jumps over the lazy dog, the quick brown fox jumps over the lazy cat"_sv), 20u);
+	EXPECT_EQ(haystack.find("jumps over the lazy dog, the quick brown fox jumps over the lazy cow"_sv), bzd::npos);
+}
+
+TEST(Search, BytesPeriodic)
+{
+	// Highly periodic inputs are the worst case of naive algorithms.
+	bzd::Array<char, 1000> haystack;
+	bzd::Array<char, 100> needle;
+	for (auto& c : haystack)
+	{
+		c = 'a';
+	}
+	for (auto& c : needle)
+	{
+		c = 'a';
+	}
+	EXPECT_EQ(bzd::algorithm::search(haystack, needle), haystack.begin());
+
+	needle[99] = 'b';
+	EXPECT_EQ(bzd::algorithm::search(haystack, needle), haystack.end());
+	haystack[999] = 'b';
+	EXPECT_EQ(bzd::algorithm::search(haystack, needle), haystack.begin() + 900);
+
+	needle[0] = 'b';
+	needle[99] = 'a';
+	haystack[999] = 'a';
+	haystack[500] = 'b';
+	EXPECT_EQ(bzd::algorithm::search(haystack, needle), haystack.begin() + 500);
+}
+
+TEST(Search, BytesRandom)
+{
+	// Compare against the generic implementation, selected with a custom predicate.
+	const auto generic = [](const auto& a, const auto& b) { return a == b; };
+	bzd::Array<bzd::UInt8, 512> haystack;
+	bzd::Array<bzd::UInt8, 512> needle;
+	for (bzd::Size iteration = 0; iteration < 200; ++iteration)
+	{
+		test.fillRandom(haystack);
+		test.fillRandom(needle);
+		// Use a small alphabet to have many partial matches.
+		for (auto& c : haystack)
+		{
+			c %= 3u;
+		}
+		const auto needleSize = 1u + (needle[0] % 96u);
+		const auto offset = needle[1] % (haystack.size() - needleSize);
+		for (bzd::Size i = 0; i < needleSize; ++i)
+		{
+			needle[i] = (iteration % 2) ? haystack[offset + i] : needle[i] % 3u;
+		}
+		const auto it = bzd::algorithm::search(haystack.begin(), haystack.end(), needle.begin(), needle.begin() + needleSize);
+		const auto expected =
+			bzd::algorithm::search(haystack.begin(), haystack.end(), needle.begin(), needle.begin() + needleSize, generic);
+		EXPECT_EQ(it, expected);
+
+		const auto itFind = bzd::algorithm::find(haystack, needle[0]);
+		const auto expectedFind = bzd::algorithm::search(haystack.begin(), haystack.end(), needle.begin(), needle.begin() + 1, generic);
+		EXPECT_EQ(itFind, expectedFind);
+	}
+}
+
+TEST_CONSTEXPR_BEGIN(Search, Constexpr)
+{
+	const auto haystack = "hello world"_sv;
+	EXPECT_EQ(haystack.find("world"_sv), 6u);
+	EXPECT_EQ(haystack.find('w'), 6u);
+	EXPECT_EQ(haystack.find("word"_sv), bzd::npos);
+}
+TEST_CONSTEXPR_END(Search, Constexpr)
@@ -44,6 +44,130 @@ TEST(Sort, CustomComparator)
 	}
 }
 
+namespace {
+template <class Container>
+bool isSorted(const Container& container)
+{
+	for (bzd::Size i = 1; i < container.size(); ++i)
+	{
+		if (container[i] < container[i - 1])
+		{
+			return false;
+		}
+	}
+	return true;
+}
+} // namespace
+
+TEST(Sort, AllSizes)
+{
+	bzd::Array<bzd::UInt32, 300> array;
+	for (bzd::Size size = 0; size <= array.size(); ++size)
+	{
+		test.fillRandom(array);
+		bzd::UInt64 sum{0};
+		for (bzd::Size i = 0; i < size; ++i)
+		{
+			array[i] %= 50;
+			sum += array[i];
+		}
+		bzd::algorithm::sort(array.begin(), array.begin() + size);
+
+		bzd::UInt64 sumSorted{0};
+		for (bzd::Size i = 0; i < size; ++i)
+		{
+			sumSorted += array[i];
+			if (i > 0)
+			{
+				EXPECT_LE(array[i - 1], array[i]);
+			}
+		}
+		EXPECT_EQ(sum, sumSorted);
+	}
+}
+
+TEST(Sort, Patterns)
+{
+	bzd::Array<bzd::UInt32, 10000> array;
+
+	// Sorted.
+	for (bzd::Size i = 0; i < array.size(); ++i)
+	{
+		array[i] = i;
+	}
+	bzd::algorithm::sort(array);
+	EXPECT_TRUE(isSorted(array));
+
+	// Reverse sorted.
+	for (bzd::Size i = 0; i < array.size(); ++i)
+	{
+		array[i] = array.size() - i;
+	}
+	bzd::algorithm::sort(array);
+	EXPECT_TRUE(isSorted(array));
+
+	// All equal.
+	for (auto& value : array)
+	{
+		value = 42;
+	}
+	bzd::algorithm::sort(array);
+	EXPECT_TRUE(isSorted(array));
+
+	// Organ pipe.
+	for (bzd::Size i = 0; i < array.size(); ++i)
+	{
+		array[i] = (i < array.size() / 2) ? i : array.size() - i;
+	}
+	bzd::algorithm::sort(array);
+	EXPECT_TRUE(isSorted(array));
+
+	// Sawtooth.
+	for (bzd::Size i = 0; i < array.size(); ++i)
+	{
+		array[i] = i % 64;
+	}
+	bzd::algorithm::sort(array);
+	EXPECT_TRUE(isSorted(array));
+
+	// Random with few distinct values.
+	test.fillRandom(array);
+	for (auto& value : array)
+	{
+		value %= 4;
+	}
+	bzd::algorithm::sort(array);
+	EXPECT_TRUE(isSorted(array));
+
+	// Random.
+	test.fillRandom(array);
+	bzd::algorithm::sort(array);
+	EXPECT_TRUE(isSorted(array));
+}
+
+TEST(Sort, NonArithmetic)
+{
+	struct Item
+	{
+		bzd::UInt32 key;
+		bzd::UInt32 other;
+	};
+	bzd::Array<Item, 1000> array;
+	bzd::Array<bzd::UInt32, 1000> keys;
+	test.fillRandom(keys);
+	for (bzd::Size i = 0; i < array.size(); ++i)
+	{
+		array[i].key = keys[i] % 100;
+		array[i].other = array[i].key * 2;
+	}
+	bzd::algorithm::sort(array, [](const Item& a, const Item& b) { return a.key < b.key; });
+	for (bzd::Size i = 1; i < array.size(); ++i)
+	{
+		EXPECT_LE(array[i - 1].key, array[i].key);
+		EXPECT_EQ(array[i].other, array[i].key * 2);
+	}
+}
+
 TEST_CONSTEXPR_BEGIN(Sort, Constexpr)
 {
 	bzd::Array<bzd::UInt32, 10> array{9, 8, 7, 6, 5, 4, 3, 2, 1, 0};
@@ -57,3 +181,21 @@ TEST_CONSTEXPR_BEGIN(Sort, Constexpr)
 	}
 }
 TEST_CONSTEXPR_END(Sort, Constexpr)
+
+TEST_CONSTEXPR_BEGIN(Sort, ConstexprLarge)
+{
+	bzd::Array<bzd::UInt32, 200> array{};
+	for (bzd::Size i = 0; i < array.size(); ++i)
+	{
+		array[i] = (i * 7919u) % 211u;
+	}
+	bzd::algorithm::sort(array);
+
+	bzd::UInt32 previous = 0;
+	for (const auto& value : array)
+	{
+		EXPECT_GE(value, previous);
+		previous = value;
+	}
+}
+TEST_CONSTEXPR_END(Sort, ConstexprLarge)
@@ -0,0 +1,111 @@
+#include "cc/bzd/algorithm/stable_sort.hh"
+
+#include "cc/bzd/container/array.hh"
+#include "cc/bzd/test/test.hh"
+#include "cc/bzd/utility/comparison/greater.hh"
+
+namespace {
+struct Item
+{
+	bzd::UInt32 key;
+	bzd::UInt32 index;
+};
+
+constexpr bool compareKeys(const Item& a, const Item& b) noexcept { return a.key < b.key; }
+
+template <class Container>
+bool isStablySorted(const Container& container)
+{
+	for (bzd::Size i = 1; i < container.size(); ++i)
+	{
+		if (container[i].key < container[i - 1].key)
+		{
+			return false;
+		}
+		if (container[i].key == container[i - 1].key && container[i].index < container[i - 1].index)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+} // namespace
+
+TEST(StableSort, Base)
+{
+	bzd::Array<Item, 1000> array;
+	bzd::Array<Item, 500> buffer;
+	bzd::Array<bzd::UInt32, 1000> keys;
+	for (bzd::Size iteration = 0; iteration < 10; ++iteration)
+	{
+		test.fillRandom(keys);
+		for (bzd::Size i = 0; i < array.size(); ++i)
+		{
+			array[i] = Item{keys[i] % 20u, static_cast<bzd::UInt32>(i)};
+		}
+		bzd::algorithm::stableSort(array, buffer, compareKeys);
+		EXPECT_TRUE(isStablySorted(array));
+	}
+}
+
+TEST(StableSort, SmallBuffer)
+{
+	bzd::Array<Item, 1000> array;
+	bzd::Array<Item, 7> buffer;
+	bzd::Array<bzd::UInt32, array.size()> keys;
+	test.fillRandom(keys);
+	for (bzd::Size i = 0; i < array.size(); ++i)
+	{
+		array[i] = Item{keys[i] % 20u, static_cast<bzd::UInt32>(i)};
+	}
+	bzd::algorithm::stableSort(array, buffer, compareKeys);
+	EXPECT_TRUE(isStablySorted(array));
+}
+
+TEST(StableSort, NoBuffer)
+{
+	bzd::Array<Item, 777> array;
+	bzd::Array<Item, 0> buffer;
+	bzd::Array<bzd::UInt32, array.size()> keys;
+	test.fillRandom(keys);
+	for (bzd::Size i = 0; i < array.size(); ++i)
+	{
+		array[i] = Item{keys[i] % 50u, static_cast<bzd::UInt32>(i)};
+	}
+	bzd::algorithm::stableSort(array.begin(), array.end(), buffer, compareKeys);
+	EXPECT_TRUE(isStablySorted(array));
+}
+
+TEST(StableSort, CustomComparator)
+{
+	bzd::Array<bzd::UInt32, 100> array;
+	bzd::Array<bzd::UInt32, 50> buffer;
+	test.fillRandom(array);
+	bzd::algorithm::stableSort(array, buffer, bzd::Greater<bzd::UInt32>{});
+
+	bzd::UInt32 previous = bzd::NumericLimits<bzd::UInt32>::max();
+	for (const auto& value : array)
+	{
+		EXPECT_LE(value, previous);
+		previous = value;
+	}
+}
+
+TEST_CONSTEXPR_BEGIN(StableSort, Constexpr)
+{
+	bzd::Array<bzd::UInt32, 40> array{};
+	bzd::Array<bzd::UInt32, 20> buffer{};
+	for (bzd::Size i = 0; i < array.size(); ++i)
+	{
+		array[i] = static_cast<bzd::UInt32>(array.size() - i);
+	}
+	bzd::algorithm::stableSort(array, buffer);
+
+	bzd::UInt32 previous = 0;
+	for (const auto& value : array)
+	{
+		EXPECT_GE(value, previous);
+		previous = value;
+	}
+}
+TEST_CONSTEXPR_END(StableSort, Constexpr)
@@ -1,108 +1,754 @@
 #pragma once
 
+#include "cc/bzd/container/optional.hh"
 #include "cc/bzd/container/pool.hh"
-#include "cc/bzd/container/tuple.hh"
-#include "cc/bzd/container/vector.hh"
+#include "cc/bzd/core/assert/minimal.hh"
+#include "cc/bzd/platform/processor.hh"
 #include "cc/bzd/platform/types.hh"
+#include "cc/bzd/type_traits/is_arithmetic.hh"
+#include "cc/bzd/type_traits/is_same.hh"
+#include "cc/bzd/type_traits/iterator.hh"
+#include "cc/bzd/utility/comparison/less.hh"
+#include "cc/bzd/utility/forward.hh"
+#include "cc/bzd/utility/max.hh"
+#include "cc/bzd/utility/move.hh"
+#include "cc/bzd/utility/ranges/subrange.hh"
 
 namespace bzd::impl {
-/// Implementation of a B-tree.
+
+/// Default order of a B-tree, so that the keys of a node span about 2 cache lines.
+template <class K>
+inline constexpr Size bTreeDefaultOrder = bzd::max(Size{4u}, (2u * bzd::platform::cacheLineSize) / sizeof(K) + 1u);
+
+/// Implementation of a B+tree.
 ///
-/// A B-Tree of order M has the following properties:
+/// A B+tree of order M has the following properties:
 /// - Every node has at most *M* children.
-/// - A non-leaf node with k children contains k-1 keys.
-/// - The root has at least 2 children if it is not a leaf node.
-/// - Every non-leaf node (except root) has at least M / 2 children.
-/// - All leaves appear in the same level.
+/// - A non-leaf node with k children contains k-1 keys, used only to guide the search.
+/// - Every node (except the root) is at least half full.
+/// - All leaves appear in the same level and hold all the key/value pairs, sorted.
+/// - Leaves are chained, which makes ordered iteration and range queries a simple walk.
 ///
-/// Non-leaf nodes are implemented as non-sorted arrays.
-template <class K, class V, Size Order>
+/// Nodes are stored in contiguous sorted arrays, the search within a node is done with a
+/// branchless linear scan for arithmetic keys (which compilers vectorize), and with a binary
+/// search otherwise.
+template <class K, class V, Size Order, class Compare>
 class BTree
 {
-protected:
-	struct Node
+	static_assert(Order >= 3u, "The order of a B-tree must be at least 3.");
+
+public:
+	/// Maximum number of keys per node.
+	static constexpr Size maxKeys = Order - 1u;
+	/// Minimum number of keys for leaves and inner nodes, except the root.
+	static constexpr Size minLeafKeys = (maxKeys + 1u) / 2u;
+	static constexpr Size minInnerKeys = maxKeys / 2u;
+
+	/// Nodes have room for one extra key, so that an insertion can be done before splitting the node.
+	struct Leaf
+	{
+		Size count{0u};
+		Leaf* next{nullptr};
+		K keys[maxKeys + 1u]{};
+		V values[maxKeys + 1u]{};
+	};
+
+	struct Inner
 	{
-		bzd::Vector<bzd::Tuple<K, Node*>, Order - 1> keys_;
-		Node* last_;
-		// bzd::Vector<Node*, Order> next_;
+		Size count{0u};
+		K keys[maxKeys + 1u]{};
+		void* children[maxKeys + 2u]{};
 	};
 
+	/// Reference to an element of the tree.
+	template <class T>
+	struct ElementReference
+	{
+		const K& first;
+		T& second;
+
+		constexpr const ElementReference* operator->() const noexcept { return this; }
+	};
+
+	template <class T>
+	class BTreeIterator : public typeTraits::IteratorBase
+	{
+	public: // Traits
+		using Self = BTreeIterator<T>;
+		using DifferenceType = bzd::Int32;
+		using ValueType = ElementReference<T>;
+		static constexpr auto category = typeTraits::IteratorCategory::forward;
+
+	public:
+		constexpr BTreeIterator() noexcept = default;
+		constexpr BTreeIterator(Leaf* leaf, const Size index) noexcept : leaf_{leaf}, index_{index} { normalize(); }
+
+	public: // Modifiers.
+		constexpr Self& operator++() noexcept
+		{
+			++index_;
+			normalize();
+			return *this;
+		}
+
+		constexpr Self operator++(int) noexcept
+		{
+			Self it{*this};
+			++(*this);
+			return it;
+		}
+
+	public: // Comparators.
+		template <class U>
+		[[nodiscard]] constexpr bool operator==(const BTreeIterator<U>& other) const noexcept
+		{
+			return (leaf_ == other.leaf_) && (index_ == other.index_);
+		}
+		template <class U>
+		[[nodiscard]] constexpr bool operator!=(const BTreeIterator<U>& other) const noexcept
+		{
+			return !(*this == other);
+		}
+
+	public: // Accessors.
+		[[nodiscard]] constexpr ValueType operator*() const noexcept { return ValueType{leaf_->keys[index_], leaf_->values[index_]}; }
+		[[nodiscard]] constexpr ValueType operator->() const noexcept { return **this; }
+
+	private:
+		/// Move to the next leaf if the end of the current one is reached.
+		constexpr void normalize() noexcept
+		{
+			while (leaf_ && index_ >= leaf_->count)
+			{
+				leaf_ = leaf_->next;
+				index_ = 0u;
+			}
+		}
+
+	private:
+		template <class>
+		friend class BTreeIterator;
+
+		Leaf* leaf_{nullptr};
+		Size index_{0u};
+	};
+
+	using Iterator = BTreeIterator<V>;
+	using ConstIterator = BTreeIterator<const V>;
+
 public:
-	constexpr explicit BTree(const Size capacity, Node** root, bzd::interface::Pool<Node>& nodes) :
-		capacity_(capacity), root_(root), nodes_(nodes)
+	constexpr explicit BTree(const Size capacity, bzd::interface::Pool<Leaf>& leaves, bzd::interface::Pool<Inner>& inners) noexcept :
+		capacity_{capacity}, leaves_{leaves}, inners_{inners}
+	{
+	}
+
+	BTree(const BTree&) = delete;
+	BTree& operator=(const BTree&) = delete;
+	BTree(BTree&&) = delete;
+	BTree& operator=(BTree&&) = delete;
+	~BTree() = default;
+
+public: // Iterators
+	[[nodiscard]] constexpr Iterator begin() noexcept { return Iterator{firstLeaf(), 0u}; }
+	[[nodiscard]] constexpr ConstIterator begin() const noexcept { return ConstIterator{firstLeaf(), 0u}; }
+	[[nodiscard]] constexpr Iterator end() noexcept { return Iterator{}; }
+	[[nodiscard]] constexpr ConstIterator end() const noexcept { return ConstIterator{}; }
+
+public: // API
+	/// Whether or not the tree contains elements.
+	[[nodiscard]] constexpr bool empty() const noexcept { return (size_ == 0u); }
+
+	/// Get the number of elements in the tree.
+	[[nodiscard]] constexpr Size size() const noexcept { return size_; }
+
+	/// \brief Returns the maximum number of elements the tree can hold.
+	[[nodiscard]] constexpr Size capacity() const noexcept { return capacity_; }
+
+	/// Search for a specific element in the tree.
+	[[nodiscard]] constexpr Iterator find(const K& key) noexcept { return findAs<Iterator>(key); }
+
+	/// \copydoc find
+	[[nodiscard]] constexpr ConstIterator find(const K& key) const noexcept { return findAs<ConstIterator>(key); }
+
+	[[nodiscard]] constexpr bool contains(const K& key) const noexcept { return (find(key) != end()); }
+
+	[[nodiscard]] constexpr V& operator[](const K& key) noexcept
+	{
+		auto it = find(key);
+		bzd::assert::isTrue(it != end(), "Key does not exists");
+		return it->second;
+	}
+
+	[[nodiscard]] constexpr const V& operator[](const K& key) const noexcept
+	{
+		auto it = find(key);
+		bzd::assert::isTrue(it != end(), "Key does not exists");
+		return it->second;
+	}
+
+	/// Iterator to the first element not less than the key.
+	[[nodiscard]] constexpr Iterator lowerBound(const K& key) noexcept { return lowerBoundAs<Iterator>(key); }
+
+	/// \copydoc lowerBound
+	[[nodiscard]] constexpr ConstIterator lowerBound(const K& key) const noexcept { return lowerBoundAs<ConstIterator>(key); }
+
+	/// Iterator to the first element greater than the key.
+	[[nodiscard]] constexpr Iterator upperBound(const K& key) noexcept { return upperBoundAs<Iterator>(key); }
+
+	/// \copydoc upperBound
+	[[nodiscard]] constexpr ConstIterator upperBound(const K& key) const noexcept { return upperBoundAs<ConstIterator>(key); }
+
+	/// Ordered range of the elements with a key within [first, last).
+	[[nodiscard]] constexpr auto range(const K& first, const K& last) noexcept
+	{
+		return bzd::ranges::SubRange{lowerBound(first), lowerBound(last)};
+	}
+
+	/// \copydoc range
+	[[nodiscard]] constexpr auto range(const K& first, const K& last) const noexcept
+	{
+		return bzd::ranges::SubRange{lowerBound(first), lowerBound(last)};
+	}
+
+	/// Insert a new element or replace the existing one.
+	template <class U>
+	constexpr void insert(const K& key, U&& value) noexcept
+	{
+		if (!root_)
+		{
+			root_ = &reserveLeaf();
+			height_ = 0u;
+		}
+
+		Bool inserted{false};
+		if (auto maybeSplit = insertInto(root_, 0u, key, bzd::forward<U>(value), inserted); maybeSplit)
+		{
+			auto& root = reserveInner();
+			root.count = 1u;
+			root.keys[0] = bzd::move(maybeSplit->separator);
+			root.children[0] = root_;
+			root.children[1] = maybeSplit->right;
+			root_ = &root;
+			++height_;
+		}
+		if (inserted)
+		{
+			++size_;
+		}
+	}
+
+	/// Remove an element from the tree.
+	///
+	/// \return true if the element was found and removed, false otherwise.
+	constexpr Bool erase(const K& key) noexcept
+	{
+		if (!root_ || !eraseFrom(root_, 0u, key))
+		{
+			return false;
+		}
+		--size_;
+
+		// Shrink the tree if the root became useless.
+		if (height_ == 0u)
+		{
+			if (asLeaf(root_).count == 0u)
+			{
+				leaves_.release(asLeaf(root_));
+				root_ = nullptr;
+			}
+		}
+		else if (asInner(root_).count == 0u)
+		{
+			auto& root = asInner(root_);
+			root_ = root.children[0];
+			inners_.release(root);
+			--height_;
+		}
+		return true;
+	}
+
+	/// Remove all elements from the tree.
+	constexpr void clear() noexcept
+	{
+		if (root_)
+		{
+			releaseAll(root_, 0u);
+			root_ = nullptr;
+		}
+		size_ = 0u;
+		height_ = 0u;
+	}
+
+private:
+	struct Split
+	{
+		K separator;
+		void* right;
+	};
+
+	constexpr Leaf& asLeaf(void* node) const noexcept { return *static_cast<Leaf*>(node); }
+	constexpr Inner& asInner(void* node) const noexcept { return *static_cast<Inner*>(node); }
+
+	constexpr Leaf& reserveLeaf() noexcept
+	{
+		auto& leaf = leaves_.reserve();
+		leaf.count = 0u;
+		leaf.next = nullptr;
+		return leaf;
+	}
+
+	constexpr Inner& reserveInner() noexcept
+	{
+		auto& inner = inners_.reserve();
+		inner.count = 0u;
+		return inner;
+	}
+
+	/// Number of keys strictly less than the key.
+	template <class Node>
+	[[nodiscard]] constexpr Size lowerIndex(const Node& node, const K& key) const noexcept
+	{
+		if constexpr (isBranchless)
+		{
+			Size index{0u};
+			for (Size i = 0u; i < node.count; ++i)
+			{
+				index += compare_(node.keys[i], key);
+			}
+			return index;
+		}
+		else
+		{
+			Size first{0u};
+			Size count{node.count};
+			while (count)
+			{
+				const auto step = count / 2u;
+				if (compare_(node.keys[first + step], key))
+				{
+					first += step + 1u;
+					count -= step + 1u;
+				}
+				else
+				{
+					count = step;
+				}
+			}
+			return first;
+		}
+	}
+
+	/// Number of keys less or equal to the key.
+	template <class Node>
+	[[nodiscard]] constexpr Size upperIndex(const Node& node, const K& key) const noexcept
+	{
+		if constexpr (isBranchless)
+		{
+			Size index{0u};
+			for (Size i = 0u; i < node.count; ++i)
+			{
+				index += !compare_(key, node.keys[i]);
+			}
+			return index;
+		}
+		else
+		{
+			Size first{0u};
+			Size count{node.count};
+			while (count)
+			{
+				const auto step = count / 2u;
+				if (!compare_(key, node.keys[first + step]))
+				{
+					first += step + 1u;
+					count -= step + 1u;
+				}
+				else
+				{
+					count = step;
+				}
+			}
+			return first;
+		}
+	}
+
+	template <class It>
+	[[nodiscard]] constexpr It findAs(const K& key) const noexcept
+	{
+		if (!root_)
+		{
+			return It{};
+		}
+		auto& leaf = findLeaf(key);
+		const auto index = lowerIndex(leaf, key);
+		if (index < leaf.count && !compare_(key, leaf.keys[index]))
+		{
+			return It{&leaf, index};
+		}
+		return It{};
+	}
+
+	template <class It>
+	[[nodiscard]] constexpr It lowerBoundAs(const K& key) const noexcept
+	{
+		if (!root_)
+		{
+			return It{};
+		}
+		auto& leaf = findLeaf(key);
+		return It{&leaf, lowerIndex(leaf, key)};
+	}
+
+	template <class It>
+	[[nodiscard]] constexpr It upperBoundAs(const K& key) const noexcept
 	{
+		if (!root_)
+		{
+			return It{};
+		}
+		auto& leaf = findLeaf(key);
+		return It{&leaf, upperIndex(leaf, key)};
 	}
 
-	/**
-	 * Insert a new element into the B-Tree.
-	 *
-	 * Inserting into a B-Tree of order M is done as follows:
-	 * 1. Find the leaf node where the item should be inserted.
-	 * 2. If the leaf node can accommodate another item (it has no more than M - 1
-	 * items), insert the item into the correct location in the node.
-	 * 3. If the leaf node is full, split the node in 2, with the smaller half of
-	 * the items in one node and the larger half in the other. "Promote" the
-	 * median item to the parent node. If the parent node is full, split and
-	 * repeat...
-	 */
-	void insert(const K& key, const V& /*value*/)
+	[[nodiscard]] constexpr Leaf* firstLeaf() const noexcept
 	{
-		Node* node = *root_;
+		void* node = root_;
+		for (Size depth = 0u; node && depth < height_; ++depth)
+		{
+			node = asInner(node).children[0];
+		}
+		return static_cast<Leaf*>(node);
+	}
 
-		// If there is no node yet, create one
-		if (!*root_)
+	[[nodiscard]] constexpr Leaf& findLeaf(const K& key) const noexcept
+	{
+		void* node = root_;
+		for (Size depth = 0u; depth < height_; ++depth)
 		{
-			*root_ = &nodes_.reserve();
-			node = *root_;
+			auto& inner = asInner(node);
+			node = inner.children[upperIndex(inner, key)];
 		}
+		return asLeaf(node);
+	}
 
-		// Look for the right node
-		Node* subNode = nullptr;
-		for (const auto& nodeKey : node->keys_)
+	template <class U>
+	constexpr bzd::Optional<Split> insertInto(void* node, const Size depth, const K& key, U&& value, Bool& inserted) noexcept
+	{
+		if (depth == height_)
 		{
-			if (key >= nodeKey.template get<0>())
+			auto& leaf = asLeaf(node);
+			const auto index = lowerIndex(leaf, key);
+			if (index < leaf.count && !compare_(key, leaf.keys[index]))
+			{
+				leaf.values[index] = bzd::forward<U>(value);
+				return bzd::nullopt;
+			}
+			bzd::assert::isTrue(size_ < capacity_, "Out of bound");
+			for (Size i = leaf.count; i > index; --i)
+			{
+				leaf.keys[i] = bzd::move(leaf.keys[i - 1u]);
+				leaf.values[i] = bzd::move(leaf.values[i - 1u]);
+			}
+			leaf.keys[index] = key;
+			leaf.values[index] = bzd::forward<U>(value);
+			++leaf.count;
+			inserted = true;
+			if (leaf.count <= maxKeys)
 			{
-				subNode = nodeKey.template get<1>();
+				return bzd::nullopt;
 			}
+
+			// Split the leaf, the upper half goes to a new leaf.
+			auto& right = reserveLeaf();
+			const auto leftCount = (leaf.count + 1u) / 2u;
+			for (Size i = leftCount; i < leaf.count; ++i)
+			{
+				right.keys[i - leftCount] = bzd::move(leaf.keys[i]);
+				right.values[i - leftCount] = bzd::move(leaf.values[i]);
+				leaf.values[i] = V{};
+			}
+			right.count = leaf.count - leftCount;
+			leaf.count = leftCount;
+			right.next = leaf.next;
+			leaf.next = &right;
+			return Split{right.keys[0], &right};
+		}
+
+		auto& inner = asInner(node);
+		const auto index = upperIndex(inner, key);
+		auto maybeSplit = insertInto(inner.children[index], depth + 1u, key, bzd::forward<U>(value), inserted);
+		if (!maybeSplit)
+		{
+			return bzd::nullopt;
+		}
+		for (Size i = inner.count; i > index; --i)
+		{
+			inner.keys[i] = bzd::move(inner.keys[i - 1u]);
+			inner.children[i + 1u] = inner.children[i];
 		}
-		if (!subNode)
+		inner.keys[index] = bzd::move(maybeSplit->separator);
+		inner.children[index + 1u] = maybeSplit->right;
+		++inner.count;
+		if (inner.count <= maxKeys)
 		{
-			subNode = node->last_;
+			return bzd::nullopt;
 		}
 
-		// If the current node is full, create a new one
-		if (node->keys_.size() == node->keys_.capacity())
+		// Split the inner node, the median key moves up to the parent.
+		auto& right = reserveInner();
+		const auto middle = inner.count / 2u;
+		for (Size i = middle + 1u; i < inner.count; ++i)
 		{
+			right.keys[i - middle - 1u] = bzd::move(inner.keys[i]);
 		}
+		for (Size i = middle + 1u; i <= inner.count; ++i)
+		{
+			right.children[i - middle - 1u] = inner.children[i];
+		}
+		right.count = inner.count - middle - 1u;
+		inner.count = middle;
+		return Split{bzd::move(inner.keys[middle]), &right};
+	}
 
-		node->keys_.emplaceBack(bzd::inPlace, key);
+	constexpr Bool eraseFrom(void* node, const Size depth, const K& key) noexcept
+	{
+		if (depth == height_)
+		{
+			auto& leaf = asLeaf(node);
+			const auto index = lowerIndex(leaf, key);
+			if (index == leaf.count || compare_(key, leaf.keys[index]))
+			{
+				return false;
+			}
+			for (Size i = index + 1u; i < leaf.count; ++i)
+			{
+				leaf.keys[i - 1u] = bzd::move(leaf.keys[i]);
+				leaf.values[i - 1u] = bzd::move(leaf.values[i]);
+			}
+			--leaf.count;
+			leaf.values[leaf.count] = V{};
+			return true;
+		}
+
+		auto& inner = asInner(node);
+		const auto index = upperIndex(inner, key);
+		if (!eraseFrom(inner.children[index], depth + 1u, key))
+		{
+			return false;
+		}
+		if (depth + 1u == height_)
+		{
+			if (asLeaf(inner.children[index]).count < minLeafKeys)
+			{
+				rebalanceLeaf(inner, index);
+			}
+		}
+		else if (asInner(inner.children[index]).count < minInnerKeys)
+		{
+			rebalanceInner(inner, index);
+		}
+		return true;
 	}
 
-protected:
+	/// Remove the key at keyIndex and the child at childIndex from an inner node.
+	constexpr void removeFromInner(Inner& inner, const Size keyIndex, const Size childIndex) noexcept
+	{
+		for (Size i = keyIndex + 1u; i < inner.count; ++i)
+		{
+			inner.keys[i - 1u] = bzd::move(inner.keys[i]);
+		}
+		for (Size i = childIndex + 1u; i <= inner.count; ++i)
+		{
+			inner.children[i - 1u] = inner.children[i];
+		}
+		--inner.count;
+	}
+
+	/// Fix the leaf at index of the parent which has too few keys, by borrowing from a sibling or merging with it.
+	constexpr void rebalanceLeaf(Inner& parent, const Size index) noexcept
+	{
+		auto& leaf = asLeaf(parent.children[index]);
+		if (index > 0u && asLeaf(parent.children[index - 1u]).count > minLeafKeys)
+		{
+			auto& left = asLeaf(parent.children[index - 1u]);
+			for (Size i = leaf.count; i > 0u; --i)
+			{
+				leaf.keys[i] = bzd::move(leaf.keys[i - 1u]);
+				leaf.values[i] = bzd::move(leaf.values[i - 1u]);
+			}
+			--left.count;
+			leaf.keys[0] = bzd::move(left.keys[left.count]);
+			leaf.values[0] = bzd::move(left.values[left.count]);
+			left.values[left.count] = V{};
+			++leaf.count;
+			parent.keys[index - 1u] = leaf.keys[0];
+		}
+		else if (index < parent.count && asLeaf(parent.children[index + 1u]).count > minLeafKeys)
+		{
+			auto& right = asLeaf(parent.children[index + 1u]);
+			leaf.keys[leaf.count] = bzd::move(right.keys[0]);
+			leaf.values[leaf.count] = bzd::move(right.values[0]);
+			++leaf.count;
+			for (Size i = 1u; i < right.count; ++i)
+			{
+				right.keys[i - 1u] = bzd::move(right.keys[i]);
+				right.values[i - 1u] = bzd::move(right.values[i]);
+			}
+			--right.count;
+			right.values[right.count] = V{};
+			parent.keys[index] = right.keys[0];
+		}
+		else
+		{
+			// Merge the right leaf of the pair into the left one.
+			const auto leftIndex = (index > 0u) ? index - 1u : index;
+			auto& left = asLeaf(parent.children[leftIndex]);
+			auto& right = asLeaf(parent.children[leftIndex + 1u]);
+			for (Size i = 0u; i < right.count; ++i)
+			{
+				left.keys[left.count + i] = bzd::move(right.keys[i]);
+				left.values[left.count + i] = bzd::move(right.values[i]);
+				right.values[i] = V{};
+			}
+			left.count += right.count;
+			left.next = right.next;
+			leaves_.release(right);
+			removeFromInner(parent, leftIndex, leftIndex + 1u);
+		}
+	}
+
+	/// Fix the inner node at index of the parent which has too few keys, by borrowing from a sibling or merging with it.
+	constexpr void rebalanceInner(Inner& parent, const Size index) noexcept
+	{
+		auto& node = asInner(parent.children[index]);
+		if (index > 0u && asInner(parent.children[index - 1u]).count > minInnerKeys)
+		{
+			auto& left = asInner(parent.children[index - 1u]);
+			node.children[node.count + 1u] = node.children[node.count];
+			for (Size i = node.count; i > 0u; --i)
+			{
+				node.keys[i] = bzd::move(node.keys[i - 1u]);
+				node.children[i] = node.children[i - 1u];
+			}
+			node.keys[0] = bzd::move(parent.keys[index - 1u]);
+			node.children[0] = left.children[left.count];
+			++node.count;
+			parent.keys[index - 1u] = bzd::move(left.keys[left.count - 1u]);
+			--left.count;
+		}
+		else if (index < parent.count && asInner(parent.children[index + 1u]).count > minInnerKeys)
+		{
+			auto& right = asInner(parent.children[index + 1u]);
+			node.keys[node.count] = bzd::move(parent.keys[index]);
+			node.children[node.count + 1u] = right.children[0];
+			++node.count;
+			parent.keys[index] = bzd::move(right.keys[0]);
+			removeFromInner(right, 0u, 0u);
+		}
+		else
+		{
+			// Merge the right node of the pair and the separator into the left one.
+			const auto leftIndex = (index > 0u) ? index - 1u : index;
+			auto& left = asInner(parent.children[leftIndex]);
+			auto& right = asInner(parent.children[leftIndex + 1u]);
+			left.keys[left.count] = bzd::move(parent.keys[leftIndex]);
+			for (Size i = 0u; i < right.count; ++i)
+			{
+				left.keys[left.count + 1u + i] = bzd::move(right.keys[i]);
+			}
+			for (Size i = 0u; i <= right.count; ++i)
+			{
+				left.children[left.count + 1u + i] = right.children[i];
+			}
+			left.count += right.count + 1u;
+			inners_.release(right);
+			removeFromInner(parent, leftIndex, leftIndex + 1u);
+		}
+	}
+
+	constexpr void releaseAll(void* node, const Size depth) noexcept
+	{
+		if (depth == height_)
+		{
+			auto& leaf = asLeaf(node);
+			for (Size i = 0u; i < leaf.count; ++i)
+			{
+				leaf.values[i] = V{};
+			}
+			leaves_.release(leaf);
+			return;
+		}
+		auto& inner = asInner(node);
+		for (Size i = 0u; i <= inner.count; ++i)
+		{
+			releaseAll(inner.children[i], depth + 1u);
+		}
+		inners_.release(inner);
+	}
+
+private:
+	static constexpr Bool isBranchless = typeTraits::isArithmetic<K> && typeTraits::isSame<Compare, bzd::Less<K>>;
+
 	const Size capacity_;
-	Node** root_;
-	bzd::interface::Pool<Node>& nodes_;
+	bzd::interface::Pool<Leaf>& leaves_;
+	bzd::interface::Pool<Inner>& inners_;
+	void* root_{nullptr};
+	Size height_{0u};
+	Size size_{0u};
+	[[no_unique_address]] Compare compare_{};
 };
+
+/// Maximum number of leaves needed to store N elements.
+template <Size N, Size maxKeys>
+inline constexpr Size bTreeLeafCount = N / ((maxKeys + 1u) / 2u) + 1u;
+
+/// Maximum number of inner nodes needed to store N elements.
+template <Size N, Size maxKeys>
+constexpr Size bTreeInnerCount() noexcept
+{
+	Size total{1u};
+	for (Size count = bTreeLeafCount<N, maxKeys>; count > 1u;)
+	{
+		count = (count + maxKeys / 2u) / (maxKeys / 2u + 1u);
+		total += count;
+	}
+	return total;
+}
+
 } // namespace bzd::impl
 
 namespace bzd::interface {
-template <class K, class V, Size Order>
-using BTree = impl::BTree<K, V, Order>;
+template <class K, class V, Size Order = impl::bTreeDefaultOrder<K>, class Compare = bzd::Less<K>>
+using BTree = impl::BTree<K, V, Order, Compare>;
 }
 
 namespace bzd {
-template <class K, class V, Size N, Size Order>
-class BTree : public interface::BTree<K, V, Order>
+
+/// Fixed capacity ordered map implemented as a B+tree.
+///
+/// Unlike bzd::Map, insertion and removal are logarithmic, which makes it suitable for large ordered indexes.
+/// Keys and values must be default constructible.
+///
+/// \tparam K The key type.
+/// \tparam V The value type.
+/// \tparam N The maximum number of elements.
+/// \tparam Order The maximum number of children per node, by default nodes span about 2 cache lines.
+/// \tparam Compare The comparison function object.
+template <class K, class V, Size N, Size Order = impl::bTreeDefaultOrder<K>, class Compare = bzd::Less<K>>
+class BTree : public interface::BTree<K, V, Order, Compare>
 {
 private:
-	using typename interface::BTree<K, V, Order>::Node;
+	using Parent = interface::BTree<K, V, Order, Compare>;
+	using typename Parent::Inner;
+	using typename Parent::Leaf;
 
 public:
-	constexpr BTree() : interface::BTree<K, V, Order>(N, &root_, nodes_) {}
+	constexpr BTree() noexcept : Parent{N, leaves_, inners_} {}
+	~BTree() { this->clear(); }
 
-protected:
-	bzd::Pool<Node, 10> nodes_;
-	Node* root_ = nullptr;
-	V data_[N];
+private:
+	bzd::Pool<Leaf, impl::bTreeLeafCount<N, Parent::maxKeys>> leaves_;
+	bzd::Pool<Inner, impl::bTreeInnerCount<N, Parent::maxKeys>()> inners_;
 };
+
 } // namespace bzd
@@ -0,0 +1,522 @@
+#pragma once
+
+#include "cc/bzd/container/string_view.hh"
+#include "cc/bzd/core/assert/minimal.hh"
+#include "cc/bzd/platform/types.hh"
+#include "cc/bzd/type_traits/is_convertible.hh"
+#include "cc/bzd/type_traits/iterator.hh"
+#include "cc/bzd/type_traits/range.hh"
+#include "cc/bzd/utility/bit/count_lsb_zero.hh"
+#include "cc/bzd/utility/bit/count_msb_zero.hh"
+#include "cc/bzd/utility/forward.hh"
+#include "cc/bzd/utility/hash.hh"
+#include "cc/bzd/utility/move.hh"
+#include "cc/bzd/utility/swap.hh"
+
+#include <initializer_list>
+
+namespace bzd::impl {
+
+/// Key equality used by default by the hash maps, it compares strings and byte ranges by content,
+/// which allows heterogeneous lookups, for example a map with bzd::StringView keys can be searched
+/// with a bzd::String.
+struct HashMapKeyEqual
+{
+	template <class A, class B>
+	constexpr Bool operator()(const A& a, const B& b) const noexcept
+	{
+		if constexpr (typeTraits::isConvertible<A, const char*>)
+		{
+			return (*this)(bzd::StringView{a}, b);
+		}
+		else if constexpr (typeTraits::isConvertible<B, const char*>)
+		{
+			return (*this)(a, bzd::StringView{b});
+		}
+		else if constexpr (concepts::randomAccessByteCopyableRange<A> && concepts::randomAccessByteCopyableRange<B>)
+		{
+			const auto size = bzd::size(a);
+			if (static_cast<Size>(size) != static_cast<Size>(bzd::size(b)))
+			{
+				return false;
+			}
+			auto itA = bzd::begin(a);
+			auto itB = bzd::begin(b);
+			for (Size index = 0u; index < static_cast<Size>(size); ++index, ++itA, ++itB)
+			{
+				if (!(*itA == *itB))
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+		else
+		{
+			return a == b;
+		}
+	}
+};
+
+/// Control byte of a hash map slot. Full slots store the 7 lowest bits of the hash of their key,
+/// while empty and deleted slots have their most significant bit set.
+inline constexpr UInt8 hashMapEmpty{0x80};
+inline constexpr UInt8 hashMapDeleted{0xfe};
+
+/// Group of control bytes probed at once, using SIMD within a register (SWAR) on a 64-bit word.
+///
+/// This is portable and allows to test 8 slots with a few arithmetic instructions.
+class HashMapGroup
+{
+public:
+	static constexpr Size width{8u};
+
+public:
+	constexpr explicit HashMapGroup(const UInt8* control) noexcept
+	{
+		for (Size index = 0u; index < width; ++index)
+		{
+			value_ |= static_cast<UInt64>(control[index]) << (index * 8u);
+		}
+	}
+
+	/// Bit mask with the most significant bit of every byte matching the tag set.
+	/// Note, false positives are possible but only on full slots, hence keys must be compared anyway.
+	[[nodiscard]] constexpr UInt64 match(const UInt8 tag) const noexcept
+	{
+		const auto x = value_ ^ (lsbs * tag);
+		return (x - lsbs) & ~x & msbs;
+	}
+
+	/// Bit mask with the most significant bit of every empty byte set.
+	[[nodiscard]] constexpr UInt64 matchEmpty() const noexcept { return value_ & (~value_ << 6u) & msbs; }
+
+	/// Bit mask with the most significant bit of every empty or deleted byte set.
+	[[nodiscard]] constexpr UInt64 matchEmptyOrDeleted() const noexcept { return value_ & ~(value_ << 7u) & msbs; }
+
+	/// Consume the lowest bit of the mask and return its byte index.
+	static constexpr Size next(UInt64& mask) noexcept
+	{
+		const auto index = bzd::countLSBZero(mask) / 8u;
+		mask &= mask - 1u;
+		return index;
+	}
+
+private:
+	static constexpr UInt64 lsbs{0x0101010101010101ull};
+	static constexpr UInt64 msbs{0x8080808080808080ull};
+	UInt64 value_{0u};
+};
+
+/// Number of slots needed to store `capacity` elements with a maximum load factor of 7/8.
+constexpr Size hashMapSlotCount(const Size capacity) noexcept
+{
+	const auto minimum = capacity + (capacity + 6u) / 7u;
+	Size count{HashMapGroup::width};
+	while (count < minimum)
+	{
+		count *= 2u;
+	}
+	return count;
+}
+
+/// \brief Open addressing hash map implementation.
+///
+/// Slots are probed by groups of control bytes, following a triangular sequence of groups
+/// which visits all the slots of the table.
+/// As the capacity is fixed, deleted slots cannot be dropped by growing the table, instead it is
+/// rehashed in place once they exceed 1/8th of the slots, to keep the probe sequences short.
+template <class K, class V, class Hash, class KeyEqual>
+class HashMap
+{
+public:
+	using Self = HashMap<K, V, Hash, KeyEqual>;
+	struct Element
+	{
+		K first;
+		V second;
+	};
+
+	template <class T>
+	class HashMapIterator : public typeTraits::IteratorBase
+	{
+	public: // Traits
+		using Self = HashMapIterator<T>;
+		using DifferenceType = bzd::Int32;
+		using ValueType = T;
+		static constexpr auto category = typeTraits::IteratorCategory::forward;
+
+	public:
+		constexpr HashMapIterator(const HashMap& map, const Size index) noexcept : map_{&map}, index_{index} { skip(); }
+
+	public: // Modifiers.
+		constexpr Self& operator++() noexcept
+		{
+			++index_;
+			skip();
+			return *this;
+		}
+
+		constexpr Self operator++(int) noexcept
+		{
+			Self it{*this};
+			++(*this);
+			return it;
+		}
+
+	public: // Comparators.
+		[[nodiscard]] constexpr bool operator==(const Self& other) const noexcept { return (index_ == other.index_); }
+		[[nodiscard]] constexpr bool operator!=(const Self& other) const noexcept { return !(other == *this); }
+
+	public: // Accessors.
+		[[nodiscard]] constexpr ValueType& operator*() const noexcept { return map_->slots_[index_]; }
+		[[nodiscard]] constexpr ValueType* operator->() const noexcept { return &map_->slots_[index_]; }
+
+	private:
+		constexpr void skip() noexcept
+		{
+			while (index_ < map_->slotCount_ && !isFull(map_->control_[index_]))
+			{
+				++index_;
+			}
+		}
+
+	private:
+		const HashMap* map_;
+		Size index_;
+	};
+
+	using Iterator = HashMapIterator<Element>;
+	using ConstIterator = HashMapIterator<const Element>;
+
+protected:
+	constexpr HashMap(Element* slots, UInt8* control, const Size slotCount, const Size capacity) noexcept :
+		slots_{slots}, control_{control}, slotCount_{slotCount}, capacity_{capacity}
+	{
+	}
+
+public: // Iterators
+	[[nodiscard]] constexpr Iterator begin() noexcept { return Iterator{*this, 0u}; }
+	[[nodiscard]] constexpr ConstIterator begin() const noexcept { return ConstIterator{*this, 0u}; }
+	[[nodiscard]] constexpr Iterator end() noexcept { return Iterator{*this, slotCount_}; }
+	[[nodiscard]] constexpr ConstIterator end() const noexcept { return ConstIterator{*this, slotCount_}; }
+
+public:
+	/// Search for a specific element in the map.
+	///
+	/// \param key The key to look for, it can be of any type that is hashable and comparable with the key type.
+	/// \return An iterator to the element if found, end() otherwise.
+	template <class U>
+	[[nodiscard]] constexpr Iterator find(const U& key) noexcept
+	{
+		return Iterator{*this, lookup(key, hash_(key))};
+	}
+
+	/// \copydoc find
+	template <class U>
+	[[nodiscard]] constexpr ConstIterator find(const U& key) const noexcept
+	{
+		return ConstIterator{*this, lookup(key, hash_(key))};
+	}
+
+	template <class U>
+	[[nodiscard]] constexpr V& operator[](const U& key) noexcept
+	{
+		const auto index = lookup(key, hash_(key));
+		bzd::assert::isTrue(index != slotCount_, "Key does not exists");
+		return slots_[index].second;
+	}
+
+	template <class U>
+	[[nodiscard]] constexpr const V& operator[](const U& key) const noexcept
+	{
+		const auto index = lookup(key, hash_(key));
+		bzd::assert::isTrue(index != slotCount_, "Key does not exists");
+		return slots_[index].second;
+	}
+
+	template <class U>
+	[[nodiscard]] constexpr bool contains(const U& key) const noexcept
+	{
+		return (lookup(key, hash_(key)) != slotCount_);
+	}
+
+	/// Whether or not the map contains elements.
+	[[nodiscard]] constexpr bool empty() const noexcept { return (size_ == 0u); }
+
+	/// Get the number of elements in the map.
+	[[nodiscard]] constexpr Size size() const noexcept { return size_; }
+
+	/// \brief Returns the maximum number of elements the map can hold.
+	///
+	/// \return Maximum number of element this map can hold.
+	[[nodiscard]] constexpr Size capacity() const noexcept { return capacity_; }
+
+	/// Insert a new element or replace the existing one.
+	///
+	/// \return An iterator to the inserted element.
+	template <class U>
+	constexpr Iterator insert(const K& key, U&& value) noexcept
+	{
+		const auto hash = hash_(key);
+		if (const auto index = lookup(key, hash); index != slotCount_)
+		{
+			slots_[index].second = bzd::forward<U>(value);
+			return Iterator{*this, index};
+		}
+
+		bzd::assert::isTrue(size_ < capacity_, "Out of bound");
+		if (deleted_ * 8u > slotCount_)
+		{
+			rehash();
+		}
+		const auto index = findFree(hash);
+		if (control_[index] == hashMapDeleted)
+		{
+			--deleted_;
+		}
+		slots_[index].first = key;
+		slots_[index].second = bzd::forward<U>(value);
+		setControl(index, h2(hash));
+		++size_;
+		return Iterator{*this, index};
+	}
+
+	/// Remove an element from the map.
+	///
+	/// \return true if the element was found and removed, false otherwise.
+	template <class U>
+	constexpr Bool erase(const U& key) noexcept
+	{
+		const auto index = lookup(key, hash_(key));
+		if (index == slotCount_)
+		{
+			return false;
+		}
+		slots_[index] = Element{};
+		--size_;
+		// If the group around this slot was never full, no probe sequence could have gone past it,
+		// so it can be marked as empty instead of deleted.
+		const auto indexBefore = (index - HashMapGroup::width) & (slotCount_ - 1u);
+		const auto emptyBefore = HashMapGroup{control_ + indexBefore}.matchEmpty();
+		const auto emptyAfter = HashMapGroup{control_ + index}.matchEmpty();
+		const Bool wasNeverFull = emptyBefore && emptyAfter &&
+								  (bzd::countLSBZero(emptyAfter) / 8u + bzd::countMSBZero(emptyBefore) / 8u) < HashMapGroup::width;
+		setControl(index, (wasNeverFull) ? hashMapEmpty : hashMapDeleted);
+		deleted_ += (wasNeverFull) ? 0u : 1u;
+		if (size_ == 0u)
+		{
+			clear();
+		}
+		return true;
+	}
+
+	/// Remove all elements from the map.
+	constexpr void clear() noexcept
+	{
+		for (Size index = 0u; index < slotCount_; ++index)
+		{
+			if (isFull(control_[index]))
+			{
+				slots_[index] = Element{};
+			}
+		}
+		for (Size index = 0u; index < slotCount_ + HashMapGroup::width; ++index)
+		{
+			control_[index] = hashMapEmpty;
+		}
+		size_ = 0u;
+		deleted_ = 0u;
+	}
+
+private:
+	/// Triangular probing sequence over the groups.
+	class Probe
+	{
+	public:
+		constexpr Probe(const UInt64 hash, const Size mask) noexcept : mask_{mask}, offset_{static_cast<Size>(hash) & mask} {}
+		constexpr void next() noexcept
+		{
+			index_ += HashMapGroup::width;
+			offset_ = (offset_ + index_) & mask_;
+		}
+		[[nodiscard]] constexpr Size offset() const noexcept { return offset_; }
+		[[nodiscard]] constexpr Size offset(const Size i) const noexcept { return (offset_ + i) & mask_; }
+		[[nodiscard]] constexpr Size index() const noexcept { return index_; }
+
+	private:
+		Size mask_;
+		Size offset_;
+		Size index_{0u};
+	};
+
+	static constexpr Bool isFull(const UInt8 control) noexcept { return (control & 0x80) == 0u; }
+	static constexpr UInt64 h1(const UInt64 hash) noexcept { return hash >> 7u; }
+	static constexpr UInt8 h2(const UInt64 hash) noexcept { return static_cast<UInt8>(hash & 0x7f); }
+
+	/// Set a control byte, the first group is mirrored after the end so that groups can be read without wrapping.
+	constexpr void setControl(const Size index, const UInt8 control) noexcept
+	{
+		control_[index] = control;
+		if (index < HashMapGroup::width)
+		{
+			control_[slotCount_ + index] = control;
+		}
+	}
+
+	/// Find the first empty or deleted slot in the probe sequence of a hash.
+	[[nodiscard]] constexpr Size findFree(const UInt64 hash) const noexcept
+	{
+		for (Probe probe{h1(hash), slotCount_ - 1u};; probe.next())
+		{
+			HashMapGroup group{control_ + probe.offset()};
+			if (auto mask = group.matchEmptyOrDeleted())
+			{
+				return probe.offset(HashMapGroup::next(mask));
+			}
+		}
+	}
+
+	/// Drop all deleted slots by moving the elements to their best position, without extra memory.
+	///
+	/// Deleted slots are first marked as empty and full slots as deleted, then each of these is
+	/// either kept if it falls within the same group as its best position, moved to an empty slot,
+	/// or swapped with a not yet processed element which is then processed in turn.
+	constexpr void rehash() noexcept
+	{
+		for (Size index = 0u; index < slotCount_; ++index)
+		{
+			control_[index] = (isFull(control_[index])) ? hashMapDeleted : hashMapEmpty;
+		}
+		for (Size index = 0u; index < HashMapGroup::width; ++index)
+		{
+			control_[slotCount_ + index] = control_[index];
+		}
+
+		for (Size index = 0u; index < slotCount_; ++index)
+		{
+			if (control_[index] != hashMapDeleted)
+			{
+				continue;
+			}
+			const auto hash = hash_(slots_[index].first);
+			const auto target = findFree(hash);
+			const auto start = static_cast<Size>(h1(hash)) & (slotCount_ - 1u);
+			const auto group = [&](const Size i) { return ((i - start) & (slotCount_ - 1u)) / HashMapGroup::width; };
+			if (group(index) == group(target))
+			{
+				setControl(index, h2(hash));
+			}
+			else if (control_[target] == hashMapEmpty)
+			{
+				slots_[target] = bzd::move(slots_[index]);
+				slots_[index] = Element{};
+				setControl(target, h2(hash));
+				setControl(index, hashMapEmpty);
+			}
+			else
+			{
+				bzd::swap(slots_[index], slots_[target]);
+				setControl(target, h2(hash));
+				// Process the element swapped into this slot.
+				--index;
+			}
+		}
+		deleted_ = 0u;
+	}
+
+	/// Find the slot index of a key or slotCount_ if not found.
+	template <class U>
+	[[nodiscard]] constexpr Size lookup(const U& key, const UInt64 hash) const noexcept
+	{
+		const auto tag = h2(hash);
+		for (Probe probe{h1(hash), slotCount_ - 1u}; probe.index() < slotCount_; probe.next())
+		{
+			HashMapGroup group{control_ + probe.offset()};
+			for (auto mask = group.match(tag); mask;)
+			{
+				const auto index = probe.offset(HashMapGroup::next(mask));
+				if (equal_(slots_[index].first, key)) [[likely]]
+				{
+					return index;
+				}
+			}
+			if (group.matchEmpty()) [[likely]]
+			{
+				break;
+			}
+		}
+		return slotCount_;
+	}
+
+private:
+	Element* slots_;
+	UInt8* control_;
+	Size slotCount_;
+	Size capacity_;
+	Size size_{0u};
+	Size deleted_{0u};
+	[[no_unique_address]] Hash hash_{};
+	[[no_unique_address]] KeyEqual equal_{};
+};
+
+} // namespace bzd::impl
+
+namespace bzd::interface {
+template <class K, class V, class Hash = bzd::Hash, class KeyEqual = impl::HashMapKeyEqual>
+using HashMap = impl::HashMap<K, V, Hash, KeyEqual>;
+}
+
+namespace bzd {
+
+/// Fixed capacity hash map with open addressing.
+///
+/// It provides constant time lookup, insertion and removal without any dynamic allocation.
+/// Keys and values must be default constructible, like for bzd::Vector. Iteration order is unspecified.
+///
+/// \tparam K The key type.
+/// \tparam V The value type.
+/// \tparam N The maximum number of elements.
+/// \tparam Hash The hash function object, see bzd::Hash.
+/// \tparam KeyEqual The key comparison function object.
+template <class K, class V, Size N, class Hash = bzd::Hash, class KeyEqual = impl::HashMapKeyEqual>
+class HashMap : public interface::HashMap<K, V, Hash, KeyEqual>
+{
+private:
+	using Parent = interface::HashMap<K, V, Hash, KeyEqual>;
+	using Self = HashMap<K, V, N, Hash, KeyEqual>;
+	using typename Parent::Element;
+	static constexpr Size slotCount = impl::hashMapSlotCount(N);
+
+public:
+	constexpr HashMap() noexcept : Parent{slots_, control_, slotCount, N} { this->clear(); }
+	constexpr HashMap(std::initializer_list<Element> list) noexcept : HashMap{}
+	{
+		for (const auto& element : list)
+		{
+			this->insert(element.first, element.second);
+		}
+	}
+	constexpr HashMap(const Self& other) noexcept : HashMap{} { *this = other; }
+	constexpr Self& operator=(const Self& other) noexcept
+	{
+		if (this != &other)
+		{
+			this->clear();
+			for (const auto& element : other)
+			{
+				this->insert(element.first, element.second);
+			}
+		}
+		return *this;
+	}
+	HashMap(Self&&) = delete;
+	Self& operator=(Self&&) = delete;
+	constexpr ~HashMap() noexcept = default;
+
+private:
+	Element slots_[slotCount]{};
+	UInt8 control_[slotCount + impl::HashMapGroup::width]{};
+};
+
+} // namespace bzd
@@ -1,7 +1,9 @@
 #pragma once
 
 #include "cc/bzd/container/impl/span.hh"
+#include "cc/bzd/core/assert/minimal.hh"
 #include "cc/bzd/type_traits/is_convertible.hh"
+#include "cc/bzd/type_traits/is_default_constructible.hh"
 #include "cc/bzd/type_traits/is_trivially_copyable.hh"
 #include "cc/bzd/type_traits/is_trivially_default_constructible.hh"
 #include "cc/bzd/type_traits/is_trivially_destructible.hh"
@@ -92,11 +94,19 @@ public: // Modifiers.
 		auto it = this->end();
 		if constexpr (!concepts::triviallyDefaultConstructible<T>)
 		{
-			// Create new elements.
-			for (int n = 0; n < nbNew; ++n)
+			// Create new elements, this is only possible with default constructible types,
+			// others can only shrink.
+			if constexpr (typeTraits::isDefaultConstructible<T>)
 			{
-				bzd::constructAt(&(*it));
-				++it;
+				for (int n = 0; n < nbNew; ++n)
+				{
+					bzd::constructAt(&(*it));
+					++it;
+				}
+			}
+			else
+			{
+				bzd::assert::isTrue(nbNew <= 0, "Cannot grow a container of non default constructible elements.");
 			}
 		}
 		if constexpr (!concepts::triviallyDestructible<T>)
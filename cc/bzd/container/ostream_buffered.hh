@@ -16,26 +16,55 @@ template <Size capacityBytes>
 class OStreamBuffered : public bzd::OStream
 {
 public:
+	/// Maximum number of segments handed over at once to the underlying stream, this matches the batch
+	/// size of the writev based proactors.
+	static constexpr Size maxSegments{16u};
+
 	/// Create an output stream buffered object from an existing string.
 	constexpr explicit OStreamBuffered(bzd::OStream& stream) noexcept : stream_{stream} {}
 
-	/// Write new data to the buffer, if full the data is automatically flushed.
+	/// Write new data to the buffer.
+	///
+	/// If the data does not fit, the content of the buffer and the new data are handed over
+	/// together to the underlying stream, without copying the new data.
 	bzd::Async<> write(const bzd::Span<const bzd::Byte> data) noexcept override
 	{
-		auto dataLeft = data;
-		while (dataLeft.size())
+		if (data.size() <= buffer_.capacity() - buffer_.size())
 		{
-			const auto sizeLeft = buffer_.capacity() - buffer_.size();
-			if (sizeLeft < dataLeft.size())
+			buffer_.pushBack(data);
+			co_return {};
+		}
+		const bzd::Span<const bzd::Byte> segments[] = {buffer_.asBytes(), data};
+		co_await !stream_.writeVectored(segments);
+		buffer_.clear();
+		co_return {};
+	}
+
+	/// Write multiple segments to the buffer.
+	///
+	/// Segments are buffered as long as they fit. From the first segment that does not fit, the content of
+	/// the buffer and the remaining segments are handed over together to the underlying stream, as a single
+	/// vectored write of up to `maxSegments` segments.
+	bzd::Async<> writeVectored(const bzd::Span<const bzd::Span<const bzd::Byte>> segments) noexcept override
+	{
+		bzd::Size index{0u};
+		for (; index < segments.size() && segments[index].size() <= buffer_.capacity() - buffer_.size(); ++index)
+		{
+			buffer_.pushBack(segments[index]);
+		}
+		if (index < segments.size())
+		{
+			bzd::Vector<bzd::Span<const bzd::Byte>, maxSegments> batch;
+			batch.emplaceBack(buffer_.asBytes());
+			for (; index < segments.size() && !batch.full(); ++index)
 			{
-				buffer_.pushBack(dataLeft.first(sizeLeft));
-				dataLeft = dataLeft.subSpan(sizeLeft);
-				co_await !flush();
+				batch.emplaceBack(segments[index]);
 			}
-			else
+			co_await !stream_.writeVectored(batch.asSpan());
+			buffer_.clear();
+			if (index < segments.size())
 			{
-				buffer_.pushBack(dataLeft);
-				dataLeft = dataLeft.subSpan(dataLeft.size());
+				co_await !stream_.writeVectored(segments.subSpan(index));
 			}
 		}
 		co_return {};
@@ -44,8 +73,11 @@ public:
 	/// Flush the current data.
 	bzd::Async<> flush() noexcept
 	{
-		co_await !stream_.write(buffer_.asBytes());
-		buffer_.clear();
+		if (!buffer_.empty())
+		{
+			co_await !stream_.write(buffer_.asBytes());
+			buffer_.clear();
+		}
 		co_return {};
 	}
 
@@ -0,0 +1,201 @@
+#pragma once
+
+#include "cc/bzd/container/array.hh"
+#include "cc/bzd/container/hash_map.hh"
+#include "cc/bzd/core/assert/minimal.hh"
+#include "cc/bzd/platform/types.hh"
+#include "cc/bzd/utility/hash.hh"
+
+#include <initializer_list>
+
+namespace bzd {
+
+/// Immutable hash map using a minimal perfect hash function.
+///
+/// The hash function is computed at construction, which is meant to happen at compile time:
+/// \code
+/// static constexpr bzd::StaticHashMap<bzd::StringView, int, 3> map{{"a"_sv, 1}, {"b"_sv, 2}, {"c"_sv, 3}};
+/// \endcode
+/// Keys are first distributed into buckets, then for each bucket, starting with the largest, a seed
+/// is searched for so that all the keys of the bucket land in free slots (hash and displace).
+/// A lookup then costs 2 hashes and a single key comparison, with no probing.
+///
+/// \tparam K The key type.
+/// \tparam V The value type.
+/// \tparam N The number of elements, it must match the number of elements given at construction.
+/// \tparam Hash The hash function object, see bzd::Hash.
+/// \tparam KeyEqual The key comparison function object.
+template <class K, class V, Size N, class Hash = bzd::Hash, class KeyEqual = impl::HashMapKeyEqual>
+class StaticHashMap
+{
+public:
+	struct Element
+	{
+		K first;
+		V second;
+	};
+	using Iterator = typename bzd::Array<Element, N>::ConstIterator;
+
+private:
+	static constexpr Size bucketCount{(N / 2u) ? (N / 2u) : 1u};
+	static constexpr UInt32 maxSeed{1u << 20u};
+
+public:
+	constexpr StaticHashMap(std::initializer_list<Element> list) noexcept
+	{
+		bzd::assert::isTrue(list.size() == N, "The number of elements must match the capacity");
+
+		// Distribute the keys into buckets.
+		Size bucketSizes[bucketCount]{};
+		Size bucketOf[N ? N : 1u]{};
+		Size index{0u};
+		for (const auto& element : list)
+		{
+			bucketOf[index] = bucket(element.first);
+			++bucketSizes[bucketOf[index]];
+			++index;
+		}
+
+		// Process the buckets from the largest to the smallest, as they are the hardest to place.
+		Bool used[N ? N : 1u]{};
+		Size slots[N ? N : 1u]{};
+		for (Size remaining = bucketCount; remaining; --remaining)
+		{
+			Size current{0u};
+			for (Size b = 1u; b < bucketCount; ++b)
+			{
+				if (bucketSizes[b] > bucketSizes[current])
+				{
+					current = b;
+				}
+			}
+			if (bucketSizes[current] == 0u)
+			{
+				break;
+			}
+			bucketSizes[current] = 0u;
+			seeds_[current] = findSeed(list, bucketOf, current, used, slots);
+		}
+
+		index = 0u;
+		for (const auto& element : list)
+		{
+			data_[slots[index]] = element;
+			++index;
+		}
+	}
+
+public: // Iterators
+	[[nodiscard]] constexpr Iterator begin() const noexcept { return data_.begin(); }
+	[[nodiscard]] constexpr Iterator end() const noexcept { return data_.end(); }
+
+public:
+	/// Search for a specific element in the map.
+	///
+	/// \param key The key to look for, it can be of any type that is hashable and comparable with the key type.
+	/// \return An iterator to the element if found, end() otherwise.
+	template <class U>
+	[[nodiscard]] constexpr Iterator find(const U& key) const noexcept
+	{
+		if constexpr (N == 0u)
+		{
+			return end();
+		}
+		else
+		{
+			const auto index = slot(key, seeds_[bucket(key)]);
+			if (equal_(data_[index].first, key))
+			{
+				return begin() + index;
+			}
+			return end();
+		}
+	}
+
+	template <class U>
+	[[nodiscard]] constexpr const V& operator[](const U& key) const noexcept
+	{
+		const auto it = find(key);
+		bzd::assert::isTrue(it != end(), "Key does not exists");
+		return it->second;
+	}
+
+	template <class U>
+	[[nodiscard]] constexpr bool contains(const U& key) const noexcept
+	{
+		return (find(key) != end());
+	}
+
+	[[nodiscard]] constexpr bool empty() const noexcept { return (N == 0u); }
+	[[nodiscard]] constexpr Size size() const noexcept { return N; }
+
+private:
+	template <class U>
+	[[nodiscard]] constexpr Size bucket(const U& key) const noexcept
+	{
+		return reduce(hash_(key), bucketCount);
+	}
+
+	template <class U>
+	[[nodiscard]] constexpr Size slot(const U& key, const UInt32 seed) const noexcept
+	{
+		return reduce(hash_(key, seed), N);
+	}
+
+	/// Map a hash uniformly into [0, range), without a division.
+	static constexpr Size reduce(const UInt64 hash, const Size range) noexcept
+	{
+		return static_cast<Size>(((hash >> 32u) * static_cast<UInt64>(range)) >> 32u);
+	}
+
+	/// Find a seed that places all the keys of a bucket into distinct free slots, and reserve them.
+	constexpr UInt32 findSeed(std::initializer_list<Element> list,
+							  const Size* bucketOf,
+							  const Size current,
+							  Bool* used,
+							  Size* slots) const noexcept
+	{
+		for (UInt32 seed = 1u; seed < maxSeed; ++seed)
+		{
+			Size index{0u};
+			Bool success{true};
+			for (const auto& element : list)
+			{
+				if (bucketOf[index] == current)
+				{
+					const auto candidate = slot(element.first, seed);
+					if (used[candidate])
+					{
+						success = false;
+						break;
+					}
+					used[candidate] = true;
+					slots[index] = candidate;
+				}
+				++index;
+			}
+			if (success)
+			{
+				return seed;
+			}
+			// Release the slots reserved by this attempt.
+			for (Size i = 0u; i < index; ++i)
+			{
+				if (bucketOf[i] == current)
+				{
+					used[slots[i]] = false;
+				}
+			}
+		}
+		bzd::assert::isTrue(false, "No perfect hash found, keys might be duplicated.");
+		return 0u;
+	}
+
+private:
+	bzd::Array<Element, N> data_{};
+	UInt32 seeds_[bucketCount]{};
+	[[no_unique_address]] Hash hash_{};
+	[[no_unique_address]] KeyEqual equal_{};
+};
+
+} // namespace bzd
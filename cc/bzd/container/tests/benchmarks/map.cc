@@ -0,0 +1,107 @@
+#include "cc/bzd/container/array.hh"
+#include "cc/bzd/container/btree.hh"
+#include "cc/bzd/container/hash_map.hh"
+#include "cc/bzd/container/map.hh"
+#include "cc/bzd/container/static_hash_map.hh"
+#include "cc/bzd/test/test.hh"
+
+#include <utility>
+
+namespace {
+
+constexpr bzd::Size size{256u};
+constexpr bzd::Size maxSize{4096u};
+
+/// Scrambled but deterministic keys, as the immutable maps are built from a fixed set of elements.
+constexpr bzd::UInt32 key(const bzd::Size index) noexcept { return static_cast<bzd::UInt32>(index * 2654435761u); }
+
+template <class T, bzd::Size... indexes>
+T makeMap(std::index_sequence<indexes...>) noexcept
+{
+	return T{{key(indexes), static_cast<bzd::UInt32>(indexes)}...};
+}
+
+} // namespace
+
+// Outside of the anonymous namespace to keep the benchmark names short.
+template <bzd::Size n>
+struct HashMap
+{
+	using Type = bzd::HashMap<bzd::UInt32, bzd::UInt32, n>;
+};
+
+template <bzd::Size n>
+struct BTree
+{
+	using Type = bzd::BTree<bzd::UInt32, bzd::UInt32, n>;
+};
+
+template <bzd::Size n>
+struct Map
+{
+	using Type = bzd::Map<bzd::UInt32, bzd::UInt32, n>;
+};
+
+struct StaticHashMap
+{
+	using Type = bzd::StaticHashMap<bzd::UInt32, bzd::UInt32, size>;
+};
+
+// Each container is filled up to its capacity, which is swept to show how the lookup cost scales.
+#define BENCHMARK_MAPS                                                                                                                     \
+	(HashMap<16u>, BTree<16u>, Map<16u>,                                                                                                   \
+	 HashMap<size>, BTree<size>, Map<size>,                                                                                                \
+	 HashMap<maxSize>, BTree<maxSize>, Map<maxSize>)
+
+BENCHMARK(Map, Insert, BENCHMARK_MAPS)
+{
+	static bzd::Array<bzd::UInt32, maxSize> keys;
+	test.fillRandom(keys);
+	const auto count = typename TestType::Type{}.capacity();
+
+	benchmark.setItemsPerIteration(count);
+	for (auto _ : benchmark)
+	{
+		typename TestType::Type map;
+		for (bzd::Size index = 0u; index < count; ++index)
+		{
+			map.insert(keys[index], keys[index]);
+		}
+		bzd::test::doNotOptimize(map);
+	}
+}
+
+BENCHMARK(Map, Find, BENCHMARK_MAPS)
+{
+	static bzd::Array<bzd::UInt32, maxSize> keys;
+	test.fillRandom(keys);
+	typename TestType::Type map;
+	const auto count = map.capacity();
+	for (bzd::Size index = 0u; index < count; ++index)
+	{
+		map.insert(keys[index], keys[index]);
+	}
+
+	benchmark.setItemsPerIteration(count);
+	for (auto _ : benchmark)
+	{
+		for (bzd::Size index = 0u; index < count; ++index)
+		{
+			bzd::test::doNotOptimize(map.find(keys[index]));
+		}
+	}
+}
+
+BENCHMARK(Map, FindImmutable, (HashMap<size>, StaticHashMap))
+{
+	const auto map = makeMap<typename TestType::Type>(std::make_index_sequence<size>{});
+
+	benchmark.setItemsPerIteration(size);
+	for (auto _ : benchmark)
+	{
+		for (bzd::Size index = 0u; index < size; ++index)
+		{
+			bzd::test::doNotOptimize(map.find(key(index)));
+		}
+	}
+}
@@ -0,0 +1,79 @@
+#include "cc/bzd/container/ostream_buffered.hh"
+#include "cc/bzd/test/test.hh"
+#include "cc/bzd/utility/pattern/to_stream.hh"
+
+namespace {
+
+constexpr bzd::Size lineCount{64u};
+
+/// Sink counting the calls made to it, each call maps to a system call on a file descriptor backed stream.
+class Sink : public bzd::OStream
+{
+public:
+	bzd::Async<> write(const bzd::Span<const bzd::Byte> data) noexcept override
+	{
+		++calls;
+		bytes += data.size();
+		bzd::test::doNotOptimize(data);
+		co_return {};
+	}
+
+	bzd::Size calls{0u};
+	bzd::Size bytes{0u};
+};
+
+} // namespace
+
+// Outside of the anonymous namespace to keep the benchmark names short.
+
+/// Previous path, the segments are written one by one, with one write per segment.
+struct PerSegment : Sink
+{
+};
+
+/// Scatter-gather path, all the segments are handed over with a single writev.
+struct Vectored : Sink
+{
+	bzd::Async<> writeVectored(const bzd::Span<const bzd::Span<const bzd::Byte>> segments) noexcept override
+	{
+		++calls;
+		for (const auto& segment : segments)
+		{
+			bytes += segment.size();
+			bzd::test::doNotOptimize(segment);
+		}
+		co_return {};
+	}
+};
+
+// Formatted log lines written through a buffer smaller than a batch of lines, the items reported are the
+// number of calls to the sink, so items/s is the rate of write or writev system calls.
+BENCHMARK_ASYNC(OStreamBuffered, Logging, (PerSegment, Vectored))
+{
+	TestType sink;
+	bzd::OStreamBuffered<256u> stream{sink};
+	const auto logLines = [&]() -> bzd::Async<> {
+		for (bzd::Size line = 0u; line < lineCount; ++line)
+		{
+			co_await !bzd::toStream(stream,
+									"[{:d}] connection {} sent {:d} bytes in {:f}s\n"_csv,
+									line,
+									"127.0.0.1:8080"_sv,
+									1234u,
+									0.0125);
+		}
+		co_await !stream.flush();
+		co_return {};
+	};
+
+	// The calls and bytes are the same for every batch of lines.
+	co_await !logLines();
+	benchmark.setItemsPerIteration(sink.calls);
+	benchmark.setBytesPerIteration(sink.bytes);
+
+	for (auto _ : benchmark)
+	{
+		co_await !logLines();
+	}
+	co_return {};
+}
@@ -1,12 +1,202 @@
 #include "cc/bzd/container/btree.hh"
 
+#include "cc/bzd/container/array.hh"
+#include "cc/bzd/container/string_view.hh"
 #include "cc/bzd/test/test.hh"
+#include "cc/bzd/type_traits/is_same.hh"
 
 TEST(ContainerBTree, base)
 {
-	bzd::BTree<int, int, 10, 2> tree;
+	bzd::BTree<int, int, 10> tree;
+	EXPECT_TRUE(tree.empty());
+	EXPECT_EQ(tree.capacity(), 10u);
 
 	tree.insert(12, 22);
+	EXPECT_EQ(tree.size(), 1u);
 
-	EXPECT_EQ(true, true);
+	{
+		const auto it = tree.find(42);
+		EXPECT_EQ(it, tree.end());
+	}
+	{
+		const auto it = tree.find(12);
+		EXPECT_NE(it, tree.end());
+		EXPECT_EQ(it->first, 12);
+		EXPECT_EQ(it->second, 22);
+		EXPECT_EQ(tree[12], 22);
+	}
+
+	// Replace.
+	tree.insert(12, 7);
+	EXPECT_EQ(tree.size(), 1u);
+	EXPECT_EQ(tree[12], 7);
+
+	EXPECT_TRUE(tree.erase(12));
+	EXPECT_FALSE(tree.erase(12));
+	EXPECT_TRUE(tree.empty());
+	EXPECT_EQ(tree.begin(), tree.end());
+}
+
+TEST(ContainerBTree, ordered)
+{
+	bzd::BTree<bzd::UInt32, bzd::UInt32, 500, 4> tree;
+	// Insert in a scrambled order.
+	for (bzd::UInt32 i = 0; i < 500; ++i)
+	{
+		const auto key = (i * 7919u) % 500u;
+		tree.insert(key, key * 2u);
+	}
+	EXPECT_EQ(tree.size(), 500u);
+
+	bzd::UInt32 expected{0};
+	for (const auto& element : tree)
+	{
+		EXPECT_EQ(element.first, expected);
+		EXPECT_EQ(element.second, expected * 2u);
+		++expected;
+	}
+	EXPECT_EQ(expected, 500u);
+
+	// Values are mutable through the iterator.
+	for (auto element : tree)
+	{
+		element.second = element.first + 1u;
+	}
+	EXPECT_EQ(tree[123u], 124u);
+}
+
+TEST(ContainerBTree, range)
+{
+	bzd::BTree<bzd::UInt32, bzd::UInt32, 100, 5> tree;
+	for (bzd::UInt32 i = 0; i < 100; ++i)
+	{
+		tree.insert(i * 10u, i);
+	}
+
+	EXPECT_EQ(tree.lowerBound(25u)->first, 30u);
+	EXPECT_EQ(tree.lowerBound(30u)->first, 30u);
+	EXPECT_EQ(tree.upperBound(30u)->first, 40u);
+	EXPECT_EQ(tree.lowerBound(991u), tree.end());
+	EXPECT_EQ(tree.upperBound(990u), tree.end());
+
+	bzd::Size count{0};
+	bzd::UInt32 sum{0};
+	for (const auto& element : tree.range(95u, 200u))
+	{
+		++count;
+		sum += element.second;
+	}
+	EXPECT_EQ(count, 10u);
+	EXPECT_EQ(sum, 145u);
+
+	EXPECT_EQ(tree.range(21u, 29u).begin(), tree.range(21u, 29u).end());
+}
+
+TEST(ContainerBTree, constness)
+{
+	bzd::BTree<int, int, 10> tree;
+	tree.insert(1, 2);
+	tree.insert(3, 4);
+
+	const auto& constTree = tree;
+	static_assert(bzd::typeTraits::isSame<decltype(constTree.find(1)), bzd::BTree<int, int, 10>::ConstIterator>);
+	static_assert(bzd::typeTraits::isSame<decltype(constTree[1]), const int&>);
+	static_assert(bzd::typeTraits::isSame<decltype(tree[1]), int&>);
+	EXPECT_EQ(constTree.find(3)->second, 4);
+	EXPECT_EQ(constTree.find(2), constTree.end());
+	EXPECT_EQ(constTree[1], 2);
+	EXPECT_EQ(constTree.lowerBound(2)->first, 3);
+	EXPECT_EQ(constTree.upperBound(1)->first, 3);
+
+	tree.find(3)->second = 5;
+	tree[1] = 6;
+	EXPECT_EQ(constTree[3], 5);
+	EXPECT_EQ(constTree[1], 6);
+}
+
+TEST(ContainerBTree, erase)
+{
+	bzd::BTree<bzd::UInt32, bzd::UInt32, 300, 3> tree;
+	// Repeatedly fill and empty the tree, to exercise all the rebalancing paths.
+	for (bzd::UInt32 iteration = 0; iteration < 10; ++iteration)
+	{
+		for (bzd::UInt32 i = 0; i < 300; ++i)
+		{
+			tree.insert(i, i);
+		}
+		EXPECT_EQ(tree.size(), 300u);
+		for (bzd::UInt32 i = iteration % 2; i < 300; i += 2)
+		{
+			EXPECT_TRUE(tree.erase(i));
+		}
+		EXPECT_EQ(tree.size(), 150u);
+		for (bzd::UInt32 i = 0; i < 300; ++i)
+		{
+			EXPECT_EQ(tree.contains(i), (i % 2) != (iteration % 2));
+		}
+		// Erase from the end to the start.
+		for (bzd::UInt32 i = 300; i > 0; --i)
+		{
+			tree.erase(i - 1u);
+		}
+		EXPECT_TRUE(tree.empty());
+	}
+}
+
+TEST(ContainerBTree, random)
+{
+	bzd::BTree<bzd::UInt32, bzd::UInt32, 256, 4> tree;
+	bzd::Array<bzd::UInt32, 256> values;
+	bzd::Array<bool, 1024> reference{};
+	bzd::Size size{0};
+	for (bzd::Size iteration = 0; iteration < 20; ++iteration)
+	{
+		test.fillRandom(values);
+		for (const auto value : values)
+		{
+			const auto key = value % 1024u;
+			if (value & 0x10000u)
+			{
+				EXPECT_EQ(tree.erase(key), reference[key]);
+				size -= (reference[key]) ? 1u : 0u;
+				reference[key] = false;
+			}
+			else if (size < tree.capacity() || reference[key])
+			{
+				tree.insert(key, key);
+				size += (reference[key]) ? 0u : 1u;
+				reference[key] = true;
+			}
+		}
+		EXPECT_EQ(tree.size(), size);
+
+		// The content and its order must match the reference.
+		auto it = tree.begin();
+		for (bzd::UInt32 key = 0; key < reference.size(); ++key)
+		{
+			if (reference[key])
+			{
+				EXPECT_NE(it, tree.end());
+				EXPECT_EQ(it->first, key);
+				++it;
+			}
+		}
+		EXPECT_EQ(it, tree.end());
+	}
+}
+
+TEST(ContainerBTree, strings)
+{
+	bzd::BTree<bzd::StringView, int, 20> tree;
+	tree.insert("world"_sv, 2);
+	tree.insert("hello"_sv, 1);
+	tree.insert("abc"_sv, 0);
+	EXPECT_EQ(tree.size(), 3u);
+	EXPECT_EQ(tree["hello"_sv], 1);
+	EXPECT_EQ(tree.begin()->first, "abc"_sv);
+
+	tree.clear();
+	EXPECT_TRUE(tree.empty());
+	tree.insert("again"_sv, 3);
+	EXPECT_EQ(tree.size(), 1u);
 }
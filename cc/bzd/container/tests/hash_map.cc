@@ -0,0 +1,218 @@
+#include "cc/bzd/container/hash_map.hh"
+
+#include "cc/bzd/container/static_hash_map.hh"
+#include "cc/bzd/container/string.hh"
+#include "cc/bzd/container/string_view.hh"
+#include "cc/bzd/test/test.hh"
+
+TEST(ContainerHashMap, single)
+{
+	bzd::HashMap<int, int, 12> map;
+	EXPECT_TRUE(map.empty());
+	EXPECT_EQ(map.capacity(), 12u);
+
+	map.insert(12, 5);
+
+	{
+		const auto it = map.find(42);
+		EXPECT_EQ(it, map.end());
+	}
+	{
+		const auto it = map.find(12);
+		EXPECT_NE(it, map.end());
+		EXPECT_EQ(it->second, 5);
+		EXPECT_EQ(map[12], 5);
+	}
+
+	// Replace.
+	map.insert(12, 7);
+	EXPECT_EQ(map.size(), 1u);
+	EXPECT_EQ(map[12], 7);
+}
+
+TEST(ContainerHashMap, full)
+{
+	bzd::HashMap<bzd::UInt32, bzd::UInt32, 100> map;
+	for (bzd::UInt32 i = 0; i < map.capacity(); ++i)
+	{
+		map.insert(i * 16u, i);
+	}
+	EXPECT_EQ(map.size(), 100u);
+	for (bzd::UInt32 i = 0; i < map.capacity(); ++i)
+	{
+		EXPECT_TRUE(map.contains(i * 16u));
+		EXPECT_EQ(map[i * 16u], i);
+		EXPECT_FALSE(map.contains(i * 16u + 1u));
+	}
+
+	bzd::Size count{0};
+	bzd::UInt64 sum{0};
+	for (const auto& element : map)
+	{
+		++count;
+		sum += element.second;
+	}
+	EXPECT_EQ(count, 100u);
+	EXPECT_EQ(sum, 4950u);
+}
+
+TEST(ContainerHashMap, erase)
+{
+	bzd::HashMap<bzd::UInt32, bzd::UInt32, 64> map;
+	// Repeatedly fill and empty the map, to exercise deleted slots.
+	for (bzd::UInt32 iteration = 0; iteration < 50; ++iteration)
+	{
+		for (bzd::UInt32 i = 0; i < 64; ++i)
+		{
+			map.insert(iteration * 1000u + i, i);
+		}
+		EXPECT_EQ(map.size(), 64u);
+		for (bzd::UInt32 i = 0; i < 64; i += 2)
+		{
+			EXPECT_TRUE(map.erase(iteration * 1000u + i));
+		}
+		EXPECT_FALSE(map.erase(iteration * 1000u));
+		EXPECT_EQ(map.size(), 32u);
+		for (bzd::UInt32 i = 0; i < 64; ++i)
+		{
+			EXPECT_EQ(map.contains(iteration * 1000u + i), (i % 2) == 1);
+		}
+		for (bzd::UInt32 i = 1; i < 64; i += 2)
+		{
+			EXPECT_TRUE(map.erase(iteration * 1000u + i));
+		}
+		EXPECT_TRUE(map.empty());
+	}
+}
+
+TEST(ContainerHashMap, random)
+{
+	bzd::HashMap<bzd::UInt32, bzd::UInt32, 200> map;
+	bzd::Array<bzd::UInt32, 200> keys;
+	for (bzd::Size iteration = 0; iteration < 20; ++iteration)
+	{
+		test.fillRandom(keys);
+		map.clear();
+		for (bzd::Size i = 0; i < keys.size(); ++i)
+		{
+			map.insert(keys[i], static_cast<bzd::UInt32>(i));
+		}
+		for (bzd::Size i = 0; i < keys.size(); ++i)
+		{
+			EXPECT_TRUE(map.contains(keys[i]));
+		}
+		for (bzd::Size i = 0; i < keys.size(); i += 3)
+		{
+			map.erase(keys[i]);
+		}
+		for (bzd::Size i = 1; i < keys.size(); i += 3)
+		{
+			EXPECT_TRUE(map.contains(keys[i]));
+		}
+	}
+}
+
+TEST(ContainerHashMap, rehash)
+{
+	bzd::HashMap<bzd::UInt32, bzd::UInt32, 56> map;
+	for (bzd::UInt32 i = 0; i < map.capacity(); ++i)
+	{
+		map.insert(i, i);
+	}
+	// Keep the map full while replacing its elements, to accumulate deleted slots and rehash many times.
+	for (bzd::UInt32 i = 0; i < 2000; ++i)
+	{
+		EXPECT_TRUE(map.erase(i));
+		map.insert(i + 56u, i + 56u);
+		EXPECT_EQ(map.size(), 56u);
+	}
+	for (bzd::UInt32 i = 0; i < 2000; ++i)
+	{
+		EXPECT_FALSE(map.contains(i));
+	}
+	for (bzd::UInt32 i = 2000; i < 2056; ++i)
+	{
+		EXPECT_EQ(map[i], i);
+	}
+	bzd::Size count{0};
+	for ([[maybe_unused]] const auto& element : map)
+	{
+		++count;
+	}
+	EXPECT_EQ(count, 56u);
+}
+
+TEST(ContainerHashMap, heterogeneous)
+{
+	bzd::HashMap<bzd::StringView, int, 8> map{{"hello"_sv, 1}, {"world"_sv, 2}};
+	EXPECT_EQ(map.size(), 2u);
+	EXPECT_EQ(map["hello"_sv], 1);
+	EXPECT_EQ(map["world"], 2);
+	EXPECT_FALSE(map.contains("hell"_sv));
+
+	bzd::String<16> key{"world"_sv};
+	EXPECT_TRUE(map.contains(key));
+	EXPECT_EQ(map[key], 2);
+}
+
+TEST(ContainerHashMap, copy)
+{
+	bzd::HashMap<int, int, 8> map{{1, 2}, {3, 4}};
+	bzd::HashMap<int, int, 8> copy{map};
+	map.insert(5, 6);
+	EXPECT_EQ(copy.size(), 2u);
+	EXPECT_EQ(copy[3], 4);
+	EXPECT_FALSE(copy.contains(5));
+}
+
+TEST(ContainerStaticHashMap, base)
+{
+	static constexpr bzd::StaticHashMap<bzd::StringView, int, 6> map{
+		{"chunked"_sv, 1}, {"compress"_sv, 2}, {"deflate"_sv, 3}, {"gzip"_sv, 4}, {"identity"_sv, 5}, {"br"_sv, 6}};
+	EXPECT_EQ(map.size(), 6u);
+	EXPECT_EQ(map["chunked"_sv], 1);
+	EXPECT_EQ(map["compress"], 2);
+	EXPECT_EQ(map["deflate"_sv], 3);
+	EXPECT_EQ(map["gzip"_sv], 4);
+	EXPECT_EQ(map["identity"_sv], 5);
+	EXPECT_EQ(map["br"_sv], 6);
+	EXPECT_FALSE(map.contains("zip"_sv));
+	EXPECT_FALSE(map.contains(""_sv));
+
+	int sum{0};
+	for (const auto& element : map)
+	{
+		sum += element.second;
+	}
+	EXPECT_EQ(sum, 21);
+}
+
+TEST(ContainerStaticHashMap, integers)
+{
+	bzd::StaticHashMap<bzd::UInt32, bzd::UInt32, 50> map{
+		{0, 0},	  {1, 1},	{2, 2},	  {3, 3},	{4, 4},	  {5, 5},	{6, 6},	  {7, 7},	{8, 8},	  {9, 9},
+		{10, 10}, {11, 11}, {12, 12}, {13, 13}, {14, 14}, {15, 15}, {16, 16}, {17, 17}, {18, 18}, {19, 19},
+		{20, 20}, {21, 21}, {22, 22}, {23, 23}, {24, 24}, {25, 25}, {26, 26}, {27, 27}, {28, 28}, {29, 29},
+		{30, 30}, {31, 31}, {32, 32}, {33, 33}, {34, 34}, {35, 35}, {36, 36}, {37, 37}, {38, 38}, {39, 39},
+		{40, 40}, {41, 41}, {42, 42}, {43, 43}, {44, 44}, {45, 45}, {46, 46}, {47, 47}, {48, 48}, {49, 49}};
+	for (bzd::UInt32 i = 0; i < 50; ++i)
+	{
+		EXPECT_EQ(map[i], i);
+	}
+	EXPECT_FALSE(map.contains(50u));
+}
+
+TEST_CONSTEXPR_BEGIN(ContainerHashMap, Constexpr)
+{
+	bzd::HashMap<int, int, 12> map{{12, 32}, {1, 2}, {4, 8}, {-31, 4}, {122, 0}};
+	EXPECT_EQ(map.size(), 5U);
+	EXPECT_EQ(map[4], 8);
+	EXPECT_EQ(map[-31], 4);
+	EXPECT_TRUE(map.erase(4));
+	EXPECT_FALSE(map.contains(4));
+
+	bzd::StaticHashMap<int, int, 3> staticMap{{1, 10}, {2, 20}, {3, 30}};
+	EXPECT_EQ(staticMap[2], 20);
+	EXPECT_FALSE(staticMap.contains(4));
+}
+TEST_CONSTEXPR_END(ContainerHashMap, Constexpr)
@@ -0,0 +1,103 @@
+#include "cc/bzd/container/ostream_buffered.hh"
+
+#include "cc/bzd/container/string_stream.hh"
+#include "cc/bzd/test/test.hh"
+
+namespace {
+/// Stream recording the number of calls made to it.
+class StreamRecorder : public bzd::StringStream<128>
+{
+public:
+	bzd::Async<> write(const bzd::Span<const bzd::Byte> data) noexcept override
+	{
+		++nbWrites;
+		co_return co_await bzd::StringStream<128>::write(data);
+	}
+
+	bzd::Async<> writeVectored(const bzd::Span<const bzd::Span<const bzd::Byte>> segments) noexcept override
+	{
+		++nbWritesVectored;
+		for (const auto& segment : segments)
+		{
+			co_await !bzd::StringStream<128>::write(segment);
+		}
+		co_return {};
+	}
+
+	bzd::Size nbWrites{0u};
+	bzd::Size nbWritesVectored{0u};
+};
+} // namespace
+
+TEST(ContainerOStreamBuffered, Base)
+{
+	StreamRecorder recorder;
+	bzd::OStreamBuffered<8u> stream{recorder};
+
+	stream.write("abc"_sv.asBytes()).sync();
+	stream.write("def"_sv.asBytes()).sync();
+	EXPECT_EQ(recorder.nbWrites, 0u);
+	EXPECT_EQ(recorder.nbWritesVectored, 0u);
+
+	stream.flush().sync();
+	EXPECT_EQ(recorder.nbWrites, 1u);
+	EXPECT_STREQ(recorder.str().data(), "abcdef");
+
+	// Nothing to flush.
+	stream.flush().sync();
+	EXPECT_EQ(recorder.nbWrites, 1u);
+}
+
+TEST(ContainerOStreamBuffered, Overflow)
+{
+	StreamRecorder recorder;
+	bzd::OStreamBuffered<8u> stream{recorder};
+
+	stream.write("abcdef"_sv.asBytes()).sync();
+	stream.write("0123456789"_sv.asBytes()).sync();
+	EXPECT_EQ(recorder.nbWrites, 0u);
+	EXPECT_EQ(recorder.nbWritesVectored, 1u);
+	EXPECT_STREQ(recorder.str().data(), "abcdef0123456789");
+
+	stream.write("xyz"_sv.asBytes()).sync();
+	stream.flush().sync();
+	EXPECT_STREQ(recorder.str().data(), "abcdef0123456789xyz");
+}
+
+TEST(ContainerOStreamBuffered, Spans)
+{
+	StreamRecorder recorder;
+	bzd::OStreamBuffered<8u> buffered{recorder};
+	bzd::OStream& stream = buffered;
+
+	{
+		bzd::Spans<const bzd::Byte, 2u> spans{bzd::inPlace, "abc"_sv.asBytes(), "def"_sv.asBytes()};
+		stream.write(spans).sync();
+		EXPECT_EQ(recorder.nbWritesVectored, 0u);
+	}
+
+	{
+		bzd::Spans<const bzd::Byte, 3u> spans{bzd::inPlace, "gh"_sv.asBytes(), "0123456789"_sv.asBytes(), "ij"_sv.asBytes()};
+		stream.write(spans).sync();
+		// The buffer and the remaining segments are written at once.
+		EXPECT_EQ(recorder.nbWritesVectored, 1u);
+		EXPECT_EQ(recorder.nbWrites, 0u);
+		EXPECT_STREQ(recorder.str().data(), "abcdefgh0123456789ij");
+	}
+}
+
+TEST(ContainerOStreamBuffered, ManySegments)
+{
+	StreamRecorder recorder;
+	bzd::OStreamBuffered<4u> buffered{recorder};
+
+	bzd::Span<const bzd::Byte> segments[20];
+	for (auto& segment : segments)
+	{
+		segment = "abcdef"_sv.asBytes();
+	}
+	buffered.writeVectored(segments).sync();
+	// The segments above the batch size are forwarded in a second write.
+	EXPECT_EQ(recorder.nbWritesVectored, 2u);
+	EXPECT_EQ(recorder.str().size(), 120u);
+}
@@ -0,0 +1,173 @@
+#pragma once
+
+#include "cc/bzd/container/non_owning_list.hh"
+#include "cc/bzd/container/optional.hh"
+#include "cc/bzd/container/threadsafe/bounded_queue.hh"
+#include "cc/bzd/core/async.hh"
+#include "cc/bzd/platform/atomic.hh"
+#include "cc/bzd/platform/types.hh"
+#include "cc/bzd/utility/ignore.hh"
+#include "cc/bzd/utility/synchronization/spin_mutex.hh"
+#include "cc/bzd/utility/synchronization/sync_lock_guard.hh"
+
+namespace bzd::threadsafe::impl {
+
+/// List of asyncs waiting for a condition to change.
+///
+/// The notifier only takes the lock if there are waiters, which keeps the fast path lock-free.
+class BoundedQueueWaiters
+{
+private:
+	struct Waiter : public bzd::NonOwningListElement
+	{
+		bzd::async::ExecutableSuspended executable{};
+	};
+
+public:
+	/// Suspend the caller unless the callable, evaluated after registering as a waiter, returns true.
+	template <class Callable>
+	bzd::Async<> waitUnless(Callable&& callable) noexcept
+	{
+		Waiter waiter;
+		auto lock = makeSyncLockGuard(mutex_);
+		++count_;
+		// Pairs with the fence of notifyOne, either the notifier sees this waiter, or the callable sees its update.
+		bzd::memoryFence();
+		if (callable())
+		{
+			--count_;
+			co_return {};
+		}
+		co_await bzd::async::suspend(
+			[&](auto&& executable) {
+				waiter.executable.own(bzd::move(executable));
+				bzd::ignore = waiters_.pushBack(waiter);
+				lock.release();
+			},
+			[&]() {
+				const auto lock = makeSyncLockGuard(mutex_);
+				if (waiters_.erase(waiter))
+				{
+					--count_;
+				}
+			});
+		co_return {};
+	}
+
+	/// Resume one of the waiters, if any.
+	void notifyOne() noexcept
+	{
+		bzd::memoryFence();
+		if (count_.load(MemoryOrder::relaxed) == 0u)
+		{
+			return;
+		}
+		const auto lock = makeSyncLockGuard(mutex_);
+		while (auto maybeWaiter = waiters_.popFront())
+		{
+			--count_;
+			if (maybeWaiter.valueMutable().executable.schedule())
+			{
+				break;
+			}
+		}
+	}
+
+private:
+	bzd::Atomic<Size> count_{0u};
+	bzd::SpinMutex mutex_{};
+	bzd::NonOwningList<Waiter> waiters_{};
+};
+
+} // namespace bzd::threadsafe::impl
+
+namespace bzd::threadsafe {
+
+/// Asynchronous wrapper around a lock-free bounded queue.
+///
+/// Producers are suspended while the queue is full and consumers while it is empty, instead of spinning.
+/// As long as the queue is neither full nor empty, push and pop are lock-free.
+template <class T, Size N, BoundedQueueType type = BoundedQueueType::mpmc>
+class AsyncBoundedQueue
+{
+public:
+	AsyncBoundedQueue() = default;
+
+	AsyncBoundedQueue(const AsyncBoundedQueue&) = delete;
+	AsyncBoundedQueue& operator=(const AsyncBoundedQueue&) = delete;
+	AsyncBoundedQueue(AsyncBoundedQueue&&) = delete;
+	AsyncBoundedQueue& operator=(AsyncBoundedQueue&&) = delete;
+	~AsyncBoundedQueue() = default;
+
+public: // API.
+	/// Push a new element at the end of the queue, wait until there is room for it if needed.
+	template <class U>
+	bzd::Async<> push(U&& value) noexcept
+	{
+		while (!queue_.push(bzd::forward<U>(value)))
+		{
+			Bool pushed{false};
+			co_await !producers_.waitUnless([&]() {
+				pushed = queue_.push(bzd::forward<U>(value));
+				return pushed;
+			});
+			if (pushed)
+			{
+				break;
+			}
+		}
+		consumers_.notifyOne();
+		co_return {};
+	}
+
+	/// Pop the element at the front of the queue, wait until there is one if needed.
+	bzd::Async<T> pop() noexcept
+	{
+		auto maybeValue = queue_.pop();
+		while (!maybeValue)
+		{
+			co_await !consumers_.waitUnless([&]() {
+				maybeValue = queue_.pop();
+				return maybeValue.hasValue();
+			});
+		}
+		producers_.notifyOne();
+		co_return bzd::move(maybeValue.valueMutable());
+	}
+
+	/// Push an element without waiting.
+	///
+	/// \return true if the element was pushed, false if the queue is full.
+	template <class U>
+	[[nodiscard]] Bool tryPush(U&& value) noexcept
+	{
+		if (queue_.push(bzd::forward<U>(value)))
+		{
+			consumers_.notifyOne();
+			return true;
+		}
+		return false;
+	}
+
+	/// Pop an element without waiting.
+	[[nodiscard]] bzd::Optional<T> tryPop() noexcept
+	{
+		auto maybeValue = queue_.pop();
+		if (maybeValue)
+		{
+			producers_.notifyOne();
+		}
+		return maybeValue;
+	}
+
+	[[nodiscard]] Size size() const noexcept { return queue_.size(); }
+	[[nodiscard]] Bool empty() const noexcept { return queue_.empty(); }
+	[[nodiscard]] static constexpr Size capacity() noexcept { return N; }
+
+private:
+	BoundedQueue<T, N, type> queue_{};
+	impl::BoundedQueueWaiters producers_{};
+	impl::BoundedQueueWaiters consumers_{};
+};
+
+} // namespace bzd::threadsafe
@@ -0,0 +1,253 @@
+#pragma once
+
+#include "cc/bzd/container/optional.hh"
+#include "cc/bzd/platform/atomic.hh"
+#include "cc/bzd/platform/processor.hh"
+#include "cc/bzd/platform/types.hh"
+#include "cc/bzd/utility/construct_at.hh"
+#include "cc/bzd/utility/destroy_at.hh"
+#include "cc/bzd/utility/forward.hh"
+#include "cc/bzd/utility/move.hh"
+
+namespace bzd::threadsafe {
+
+/// Concurrency guarantees of a bounded queue.
+enum class BoundedQueueType
+{
+	/// Any number of threads can push and pop concurrently.
+	mpmc,
+	/// At most one thread pushes and one thread pops concurrently.
+	spsc
+};
+
+/// Lock-free bounded queue owning its elements, multi-producer multi-consumer by default.
+///
+/// This is Vyukov's bounded queue: each slot has a sequence number telling whether it is ready to be written
+/// or read for the current lap. Producers and consumers only contend on their own index with a single CAS,
+/// and never on each other, unless the queue is full or empty.
+///
+/// \tparam T The type of the elements.
+/// \tparam N The maximum number of elements, it must be a power of 2.
+/// \tparam type The concurrency guarantees, see BoundedQueueType.
+template <class T, Size N, BoundedQueueType type = BoundedQueueType::mpmc>
+class BoundedQueue
+{
+	static_assert(N >= 2u && (N & (N - 1u)) == 0u, "The capacity must be a power of 2.");
+
+private:
+	struct Slot
+	{
+		constexpr Slot() noexcept {}
+		Slot(const Slot&) = delete;
+		Slot& operator=(const Slot&) = delete;
+		Slot(Slot&&) = delete;
+		Slot& operator=(Slot&&) = delete;
+		constexpr ~Slot() noexcept {}
+
+		bzd::Atomic<Size> sequence{0u};
+		union
+		{
+			T value;
+		};
+	};
+
+public:
+	BoundedQueue() noexcept
+	{
+		for (Size index = 0u; index < N; ++index)
+		{
+			slots_[index].sequence.store(index, MemoryOrder::relaxed);
+		}
+	}
+
+	BoundedQueue(const BoundedQueue&) = delete;
+	BoundedQueue& operator=(const BoundedQueue&) = delete;
+	BoundedQueue(BoundedQueue&&) = delete;
+	BoundedQueue& operator=(BoundedQueue&&) = delete;
+
+	~BoundedQueue() noexcept
+	{
+		while (pop())
+		{
+		}
+	}
+
+public: // API.
+	/// Push a new element at the end of the queue.
+	///
+	/// \return true if the element was pushed, false if the queue is full, in which case the value is left untouched.
+	template <class U>
+	[[nodiscard]] Bool push(U&& value) noexcept
+	{
+		auto position = tail_.load(MemoryOrder::relaxed);
+		while (true)
+		{
+			auto& slot = slots_[position & mask];
+			const auto sequence = slot.sequence.load(MemoryOrder::acquire);
+			const auto difference = static_cast<IntPointer>(sequence - position);
+			if (difference == 0)
+			{
+				if (tail_.compareExchange(position, position + 1u, MemoryOrder::relaxed))
+				{
+					bzd::constructAt(&slot.value, bzd::forward<U>(value));
+					slot.sequence.store(position + 1u, MemoryOrder::release);
+					return true;
+				}
+			}
+			else if (difference < 0)
+			{
+				// The slot still holds the element of the previous lap.
+				return false;
+			}
+			else
+			{
+				position = tail_.load(MemoryOrder::relaxed);
+			}
+		}
+	}
+
+	/// Pop the element at the front of the queue.
+	///
+	/// \return The element or an empty optional if the queue is empty.
+	[[nodiscard]] bzd::Optional<T> pop() noexcept
+	{
+		auto position = head_.load(MemoryOrder::relaxed);
+		while (true)
+		{
+			auto& slot = slots_[position & mask];
+			const auto sequence = slot.sequence.load(MemoryOrder::acquire);
+			const auto difference = static_cast<IntPointer>(sequence - (position + 1u));
+			if (difference == 0)
+			{
+				if (head_.compareExchange(position, position + 1u, MemoryOrder::relaxed))
+				{
+					bzd::Optional<T> result{bzd::move(slot.value)};
+					bzd::destroyAt(&slot.value);
+					slot.sequence.store(position + N, MemoryOrder::release);
+					return result;
+				}
+			}
+			else if (difference < 0)
+			{
+				// The slot has not been written yet.
+				return bzd::nullopt;
+			}
+			else
+			{
+				position = head_.load(MemoryOrder::relaxed);
+			}
+		}
+	}
+
+	/// Approximate number of elements, only exact when there is no concurrent access.
+	[[nodiscard]] Size size() const noexcept
+	{
+		const auto head = head_.load(MemoryOrder::relaxed);
+		const auto tail = tail_.load(MemoryOrder::relaxed);
+		return (tail > head) ? tail - head : 0u;
+	}
+
+	[[nodiscard]] Bool empty() const noexcept { return size() == 0u; }
+	[[nodiscard]] static constexpr Size capacity() noexcept { return N; }
+
+private:
+	static constexpr Size mask{N - 1u};
+
+	alignas(bzd::platform::cacheLineSize) bzd::Atomic<Size> tail_{0u};
+	alignas(bzd::platform::cacheLineSize) bzd::Atomic<Size> head_{0u};
+	alignas(bzd::platform::cacheLineSize) Slot slots_[N];
+};
+
+/// Single-producer single-consumer specialization.
+///
+/// Each side keeps a cached copy of the index of the other side, which is only refreshed when the queue
+/// looks full or empty. This way, in steady state, the producer and the consumer do not share any cache line.
+template <class T, Size N>
+class BoundedQueue<T, N, BoundedQueueType::spsc>
+{
+	static_assert(N >= 2u && (N & (N - 1u)) == 0u, "The capacity must be a power of 2.");
+
+private:
+	union Slot {
+		constexpr Slot() noexcept {}
+		constexpr ~Slot() noexcept {}
+		T value;
+	};
+
+public:
+	BoundedQueue() = default;
+
+	BoundedQueue(const BoundedQueue&) = delete;
+	BoundedQueue& operator=(const BoundedQueue&) = delete;
+	BoundedQueue(BoundedQueue&&) = delete;
+	BoundedQueue& operator=(BoundedQueue&&) = delete;
+
+	~BoundedQueue() noexcept
+	{
+		while (pop())
+		{
+		}
+	}
+
+public: // API.
+	/// \copydoc BoundedQueue::push
+	template <class U>
+	[[nodiscard]] Bool push(U&& value) noexcept
+	{
+		const auto tail = tail_.load(MemoryOrder::relaxed);
+		if (tail - headCache_ == N)
+		{
+			headCache_ = head_.load(MemoryOrder::acquire);
+			if (tail - headCache_ == N)
+			{
+				return false;
+			}
+		}
+		bzd::constructAt(&slots_[tail & mask].value, bzd::forward<U>(value));
+		tail_.store(tail + 1u, MemoryOrder::release);
+		return true;
+	}
+
+	/// \copydoc BoundedQueue::pop
+	[[nodiscard]] bzd::Optional<T> pop() noexcept
+	{
+		const auto head = head_.load(MemoryOrder::relaxed);
+		if (head == tailCache_)
+		{
+			tailCache_ = tail_.load(MemoryOrder::acquire);
+			if (head == tailCache_)
+			{
+				return bzd::nullopt;
+			}
+		}
+		auto& slot = slots_[head & mask];
+		bzd::Optional<T> result{bzd::move(slot.value)};
+		bzd::destroyAt(&slot.value);
+		head_.store(head + 1u, MemoryOrder::release);
+		return result;
+	}
+
+	/// \copydoc BoundedQueue::size
+	[[nodiscard]] Size size() const noexcept
+	{
+		const auto head = head_.load(MemoryOrder::relaxed);
+		const auto tail = tail_.load(MemoryOrder::relaxed);
+		return (tail > head) ? tail - head : 0u;
+	}
+
+	[[nodiscard]] Bool empty() const noexcept { return size() == 0u; }
+	[[nodiscard]] static constexpr Size capacity() noexcept { return N; }
+
+private:
+	static constexpr Size mask{N - 1u};
+
+	// Written by the producer.
+	alignas(bzd::platform::cacheLineSize) bzd::Atomic<Size> tail_{0u};
+	Size headCache_{0u};
+	// Written by the consumer.
+	alignas(bzd::platform::cacheLineSize) bzd::Atomic<Size> head_{0u};
+	Size tailCache_{0u};
+	alignas(bzd::platform::cacheLineSize) Slot slots_[N];
+};
+
+} // namespace bzd::threadsafe
@@ -0,0 +1,146 @@
+#pragma once
+
+#include "cc/bzd/platform/atomic.hh"
+#include "cc/bzd/platform/processor.hh"
+#include "cc/bzd/platform/types.hh"
+#include "cc/bzd/utility/scope_guard.hh"
+#include "cc/bzd/utility/synchronization/backoff.hh"
+
+namespace bzd::threadsafe {
+
+/// Epoch based memory reclamation.
+///
+/// Readers of a lock-free structure enter a critical section by announcing the current global epoch in one of
+/// the slots, an element removed from the structure is stamped with the epoch at which it was retired.
+/// The global epoch only advances when all active readers have announced it, therefore once it is 2 epochs
+/// ahead of the stamp, no reader can still hold a reference to the element and it can be reused.
+///
+/// Unlike a single reader counter, readers entering after the element was retired never delay its reclamation,
+/// and each slot lives on its own cache line, so readers do not contend with each other.
+///
+/// \tparam slotCount Maximum number of concurrent readers, additional readers wait for a slot to be free.
+///         Critical sections can be nested, but a thread holding all the slots waits for itself forever.
+template <Size slotCount = 16u>
+class EpochReclamation
+{
+	static_assert(slotCount > 0u, "There must be at least one slot.");
+
+public:
+	/// Epoch stamp, 0 is reserved to mark inactive slots.
+	using Epoch = Size;
+
+public:
+	constexpr EpochReclamation() noexcept = default;
+
+	EpochReclamation(const EpochReclamation&) = delete;
+	EpochReclamation& operator=(const EpochReclamation&) = delete;
+	EpochReclamation(EpochReclamation&&) = delete;
+	EpochReclamation& operator=(EpochReclamation&&) = delete;
+	~EpochReclamation() = default;
+
+public: // API.
+	/// Enter a read critical section.
+	///
+	/// This waits for a slot to be free, the caller must therefore hold less than `slotCount` scopes already.
+	///
+	/// \return A scope guard that leaves the critical section once destroyed.
+	[[nodiscard]] auto enter() noexcept
+	{
+		// The address of the stack is used as a hint to spread concurrent readers over the slots,
+		// as threads, and stackful tasks, have distinct stacks.
+		const Byte hint{};
+		auto index = static_cast<Size>(reinterpret_cast<IntPointer>(&hint) >> 12u) % slotCount;
+		bzd::Backoff backoff{};
+		while (true)
+		{
+			auto& slot = slots_[index].epoch;
+			Epoch expected{0u};
+			const auto epoch = global_.load();
+			if (slot.load(MemoryOrder::relaxed) == 0u && slot.compareExchange(expected, epoch))
+			{
+				// The announcement must be visible before any element of the structure is read.
+				bzd::memoryFence();
+				return bzd::ScopeGuard{[&slot]() { slot.store(0u, MemoryOrder::release); }};
+			}
+			if (++index == slotCount)
+			{
+				index = 0u;
+				backoff();
+			}
+		}
+	}
+
+	/// Stamp an element that has just been removed from the structure.
+	///
+	/// \return The epoch to be passed to isReclaimable.
+	[[nodiscard]] Epoch retire() noexcept
+	{
+		// The removal must be ordered before the epoch is read.
+		bzd::memoryFence();
+		return global_.load();
+	}
+
+	/// Tell whether an element retired at a specific epoch can be reused, this never blocks.
+	[[nodiscard]] Bool isReclaimable(const Epoch retired) noexcept
+	{
+		// Without readers in the way, the epoch can advance twice in a row.
+		for (Size attempt = 0u; attempt < 2u; ++attempt)
+		{
+			if (global_.load() - retired >= 2u)
+			{
+				return true;
+			}
+			if (!tryAdvance())
+			{
+				return false;
+			}
+		}
+		return global_.load() - retired >= 2u;
+	}
+
+	/// Wait until an element retired at a specific epoch can be reused.
+	///
+	/// Only the readers that were active at the time of retirement are waited for.
+	void synchronize(const Epoch retired) noexcept
+	{
+		bzd::Backoff backoff{};
+		while (!isReclaimable(retired))
+		{
+			backoff();
+		}
+	}
+
+	/// Current global epoch.
+	[[nodiscard]] Epoch epoch() const noexcept { return global_.load(MemoryOrder::relaxed); }
+
+private:
+	/// Advance the global epoch if all active readers have announced the current one.
+	///
+	/// \return true if the global epoch advanced, by this call or concurrently, false otherwise.
+	Bool tryAdvance() noexcept
+	{
+		auto epoch = global_.load();
+		for (const auto& slot : slots_)
+		{
+			const auto announced = slot.epoch.load();
+			if (announced != 0u && announced != epoch)
+			{
+				return false;
+			}
+		}
+		// Failure means that another thread advanced it already.
+		global_.compareExchange(epoch, epoch + 1u);
+		return true;
+	}
+
+private:
+	struct alignas(bzd::platform::cacheLineSize) Slot
+	{
+		bzd::Atomic<Epoch> epoch{0u};
+	};
+
+	alignas(bzd::platform::cacheLineSize) bzd::Atomic<Epoch> global_{1u};
+	Slot slots_[slotCount]{};
+};
+
+} // namespace bzd::threadsafe
@@ -3,6 +3,7 @@
 #include "cc/bzd/container/optional.hh"
 #include "cc/bzd/container/reference_wrapper.hh"
 #include "cc/bzd/container/result.hh"
+#include "cc/bzd/container/threadsafe/epoch_reclamation.hh"
 #include "cc/bzd/core/assert/minimal.hh"
 #include "cc/bzd/platform/atomic.hh"
 #include "cc/bzd/platform/types.hh"
@@ -13,7 +14,7 @@
 #include "cc/bzd/type_traits/iterator.hh"
 #include "cc/bzd/type_traits/remove_reference.hh"
 #include "cc/bzd/utility/ignore.hh"
-#include "cc/bzd/utility/scope_guard.hh"
+#include "cc/bzd/utility/move.hh"
 
 namespace bzd::threadsafe {
 enum class NonOwningForwardListErrorType
@@ -29,29 +30,30 @@ namespace bzd::threadsafe::impl {
 class NonOwningForwardListNoDiscard
 {
 protected:
-	constexpr auto discardCounterScope() const noexcept { return true; }
+	constexpr auto readerScope() const noexcept { return true; }
 };
 
+template <Size readerCount>
 class NonOwningForwardListDiscard
 {
 public:
-	constexpr void waitToDiscard() noexcept
-	{
-		while (discardCounter_.load(MemoryOrder::acquire) != 0)
-		{
-		}
-	}
+	using Epoch = typename bzd::threadsafe::EpochReclamation<readerCount>::Epoch;
 
 public:
-	constexpr auto discardCounterScope() const noexcept
-	{
-		discardCounter_.fetchAdd(1, MemoryOrder::release);
-		return bzd::ScopeGuard{[this]() { discardCounter_.fetchSub(1, MemoryOrder::release); }};
-	}
+	/// Wait until none of the readers active at the time of the call can be pointing to a removed element.
+	void waitToDiscard() noexcept { reclamation_.synchronize(reclamation_.retire()); }
+
+	/// Tell whether an element retired at a specific epoch can be discarded, this never blocks.
+	[[nodiscard]] Bool isDiscardable(const Epoch retired) const noexcept { return reclamation_.isReclaimable(retired); }
+
+protected:
+	auto readerScope() const noexcept { return reclamation_.enter(); }
+
+	[[nodiscard]] Epoch retire() const noexcept { return reclamation_.retire(); }
 
 private:
-	// When this counter is non-null it means that discarding is not possible.
-	mutable bzd::Atomic<bzd::Size> discardCounter_{0};
+	// Readers of the list announce themselves here, so that removed elements are only discarded after a grace period.
+	mutable bzd::threadsafe::EpochReclamation<readerCount> reclamation_{};
 };
 
 /// Implementation of a non-owning forward list.
@@ -63,7 +65,8 @@ private:
 ///
 /// \tparam T Element type.
 template <class T>
-class NonOwningForwardList : public typeTraits::Conditional<T::supportDiscard, NonOwningForwardListDiscard, NonOwningForwardListNoDiscard>
+class NonOwningForwardList
+	: public typeTraits::Conditional<T::supportDiscard, NonOwningForwardListDiscard<T::readerCount>, NonOwningForwardListNoDiscard>
 {
 public:
 	using Self = NonOwningForwardList<T>;
@@ -229,7 +232,7 @@ public:
 
 		while (true)
 		{
-			[[maybe_unused]] auto scope{this->discardCounterScope()};
+			[[maybe_unused]] auto scope{this->readerScope()};
 
 			// Save the next positions of current element pointers
 			const auto nodeNext = removeMarks(element.next_.load());
@@ -353,6 +356,23 @@ public:
 		return result;
 	}
 
+	/// Remove an element from the list without waiting for it to be discardable.
+	///
+	/// The element can be discarded or reused once isDiscardable returns true for the returned epoch,
+	/// which allows to batch removals and amortize the grace period.
+	///
+	/// \param element Element to be removed.
+	/// \return The epoch at which the element was retired in case of success, an error otherwise.
+	[[nodiscard]] constexpr Result<EpochReclamation<>::Epoch> popToRetire(ElementType& element) noexcept
+	requires(ElementType::supportDiscard)
+	{
+		if (auto result = pop(element); !result)
+		{
+			return bzd::move(result).propagate();
+		}
+		return this->retire();
+	}
+
 	/// Remove all elements associated with this list.
 	constexpr void clear() noexcept
 	{
@@ -465,7 +485,7 @@ struct NonOwningForwardListElementMultiContainer
 	bzd::Atomic<void*> parent_{nullptr};
 };
 
-template <bzd::Bool supportMultiContainerValue, bzd::Bool supportDiscardValue>
+template <bzd::Bool supportMultiContainerValue, bzd::Bool supportDiscardValue, bzd::Size readerCountValue>
 class NonOwningForwardListElement
 	: public bzd::typeTraits::
 		  Conditional<supportMultiContainerValue, NonOwningForwardListElementMultiContainer, NonOwningForwardListElementVoid>
@@ -473,9 +493,10 @@ class NonOwningForwardListElement
 public:
 	static const constexpr bzd::Bool supportMultiContainer{supportMultiContainerValue};
 	static const constexpr bzd::Bool supportDiscard{supportDiscardValue};
+	static const constexpr bzd::Size readerCount{readerCountValue};
 
 private:
-	using Self = NonOwningForwardListElement<supportMultiContainer, supportDiscard>;
+	using Self = NonOwningForwardListElement<supportMultiContainer, supportDiscard, readerCount>;
 	using Container = NonOwningForwardList<Self>;
 	template <class V>
 	using Result = bzd::Result<V, NonOwningForwardListErrorType>;
@@ -522,8 +543,11 @@ namespace bzd::threadsafe {
 /// \tparam supportMultiContainer Whether multicontainer should be supported or not.
 ///        This means that an element can pop from one list and push a different one.
 /// \tparam supportDiscard Allow elements to be discarded.
-template <bzd::Bool supportMultiContainer, bzd::Bool supportDiscard = false>
-using NonOwningForwardListElement = bzd::threadsafe::impl::NonOwningForwardListElement<supportMultiContainer, supportDiscard>;
+/// \tparam readerCount Maximum number of reader scopes held at once on a list of discardable elements,
+///        see `NonOwningForwardList::back`.
+template <bzd::Bool supportMultiContainer, bzd::Bool supportDiscard = false, bzd::Size readerCount = 16u>
+using NonOwningForwardListElement =
+	bzd::threadsafe::impl::NonOwningForwardListElement<supportMultiContainer, supportDiscard, readerCount>;
 
 /// Implementation of a non-owning linked list.
 ///
@@ -539,11 +563,11 @@ using NonOwningForwardListElement = bzd::threadsafe::impl::NonOwningForwardListE
 template <class T>
 class NonOwningForwardList
 	: public bzd::threadsafe::impl::NonOwningForwardList<
-		  bzd::threadsafe::NonOwningForwardListElement<T::supportMultiContainer, T::supportDiscard>>
+		  bzd::threadsafe::NonOwningForwardListElement<T::supportMultiContainer, T::supportDiscard, T::readerCount>>
 {
 public:
 	using Parent = bzd::threadsafe::impl::NonOwningForwardList<
-		bzd::threadsafe::NonOwningForwardListElement<T::supportMultiContainer, T::supportDiscard>>;
+		bzd::threadsafe::NonOwningForwardListElement<T::supportMultiContainer, T::supportDiscard, T::readerCount>>;
 
 public:
 	template <class U>
@@ -619,7 +643,7 @@ public: // Return type.
 
 public:
 	using bzd::threadsafe::impl::NonOwningForwardList<
-		bzd::threadsafe::NonOwningForwardListElement<T::supportMultiContainer, T::supportDiscard>>::NonOwningForwardList;
+		bzd::threadsafe::NonOwningForwardListElement<T::supportMultiContainer, T::supportDiscard, T::readerCount>>::NonOwningForwardList;
 
 	/// Return a begin iterator for this list.
 	///
@@ -652,9 +676,14 @@ public:
 		return ElementScope<const T>{static_cast<const T&>(*ptr)};
 	}
 
-	[[nodiscard]] constexpr auto back() noexcept -> bzd::Optional<ElementScope<T, decltype(this->discardCounterScope())>>
+	/// Access the last element of the list.
+	///
+	/// With discardable elements, the returned scope keeps a reader slot of the list until it is destroyed.
+	/// There are `T::readerCount` of them, a thread holding that many scopes of the same list
+	/// would wait forever for one of its own slots to be released.
+	[[nodiscard]] constexpr auto back() noexcept -> bzd::Optional<ElementScope<T, decltype(this->readerScope())>>
 	{
-		auto scope{this->discardCounterScope()};
+		auto scope{this->readerScope()};
 
 		const auto previous = this->findPreviousNode(&this->back_);
 		if (previous->node == &this->front_)
@@ -664,9 +693,9 @@ public:
 		return ElementScope<T, decltype(scope)>{static_cast<T&>(*previous->node), bzd::move(scope)};
 	}
 
-	[[nodiscard]] constexpr auto back() const noexcept -> bzd::Optional<ElementScope<const T, decltype(this->discardCounterScope())>>
+	[[nodiscard]] constexpr auto back() const noexcept -> bzd::Optional<ElementScope<const T, decltype(this->readerScope())>>
 	{
-		auto scope{this->discardCounterScope()};
+		auto scope{this->readerScope()};
 
 		const auto previous = this->findPreviousNode(&this->back_);
 		if (previous->node == &this->front_)
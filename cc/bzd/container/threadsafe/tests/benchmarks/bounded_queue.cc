@@ -0,0 +1,94 @@
+#include "cc/bzd/container/threadsafe/bounded_queue.hh"
+
+#include "cc/bzd/platform/atomic.hh"
+#include "cc/bzd/test/multithread.hh"
+#include "cc/bzd/test/test.hh"
+
+#include <thread>
+
+namespace {
+
+template <bzd::threadsafe::BoundedQueueType type>
+void pushPop(auto& benchmark)
+{
+	bzd::threadsafe::BoundedQueue<bzd::UInt64, 64u, type> queue;
+	bzd::UInt64 value{0u};
+
+	benchmark.setItemsPerIteration(32u);
+	for (auto _ : benchmark)
+	{
+		for (bzd::Size i = 0u; i < 32u; ++i)
+		{
+			[[maybe_unused]] const auto isPushed = queue.push(value++);
+		}
+		for (bzd::Size i = 0u; i < 32u; ++i)
+		{
+			bzd::test::doNotOptimize(queue.pop());
+		}
+	}
+}
+
+} // namespace
+
+// Uncontended cost of the operations, the contended behavior depends on the machine.
+BENCHMARK(BoundedQueue, Mpmc)
+{
+	pushPop<bzd::threadsafe::BoundedQueueType::mpmc>(benchmark);
+}
+
+BENCHMARK(BoundedQueue, Spsc)
+{
+	pushPop<bzd::threadsafe::BoundedQueueType::spsc>(benchmark);
+}
+
+// Outside of the anonymous namespace to keep the benchmark names short.
+template <bzd::Size producers, bzd::Size consumers>
+struct Throughput
+{
+	static constexpr bzd::Size producerCount{producers};
+	static constexpr bzd::Size consumerCount{consumers};
+};
+
+// Each producer pushes a batch of elements, which are popped by any of the consumers.
+BENCHMARK(BoundedQueue,
+		  MpmcThroughput,
+		  (Throughput<1u, 1u>, Throughput<1u, 4u>, Throughput<4u, 1u>, Throughput<2u, 2u>, Throughput<4u, 4u>))
+{
+	constexpr bzd::Size batch{1000u};
+	constexpr bzd::Size total{batch * TestType::producerCount};
+	bzd::threadsafe::BoundedQueue<bzd::UInt64, 64u> queue;
+	bzd::Atomic<bzd::Size> popped{0u};
+
+	const auto workload = [&](const bzd::Size index) {
+		if (index < TestType::producerCount)
+		{
+			for (bzd::UInt64 value = 0u; value < batch; ++value)
+			{
+				while (!queue.push(value))
+				{
+					::std::this_thread::yield();
+				}
+			}
+			return;
+		}
+		while (popped.load() < total)
+		{
+			if (queue.pop())
+			{
+				++popped;
+			}
+			else
+			{
+				::std::this_thread::yield();
+			}
+		}
+	};
+	bzd::test::Workers workers{TestType::producerCount + TestType::consumerCount, workload};
+
+	benchmark.setItemsPerIteration(total);
+	for (auto _ : benchmark)
+	{
+		popped.store(0u);
+		workers.run();
+	}
+}
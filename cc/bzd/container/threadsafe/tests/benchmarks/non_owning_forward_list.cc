@@ -0,0 +1,66 @@
+#include "cc/bzd/container/threadsafe/non_owning_forward_list.hh"
+
+#include "cc/bzd/platform/atomic.hh"
+#include "cc/bzd/test/multithread.hh"
+#include "cc/bzd/test/test.hh"
+
+namespace {
+
+class Element : public bzd::threadsafe::NonOwningForwardListElement</*MultiContainer*/ false, /*discard*/ true>
+{
+};
+
+} // namespace
+
+// Outside of the anonymous namespace to keep the benchmark names short.
+template <bzd::Size writers, bzd::Size readers>
+struct Concurrent
+{
+	static constexpr bzd::Size writerCount{writers};
+	static constexpr bzd::Size readerCount{readers};
+};
+
+// Writers repeatedly insert and remove their own elements, waiting for a single grace period per batch before
+// reusing them, while readers walk the whole list to its last element.
+BENCHMARK(NonOwningForwardList,
+		  InsertRemoveIterate,
+		  (Concurrent<1u, 0u>, Concurrent<1u, 1u>, Concurrent<2u, 2u>, Concurrent<4u, 0u>, Concurrent<4u, 4u>))
+{
+	constexpr bzd::Size elementCount{8u};
+	constexpr bzd::Size batch{100u};
+	static Element elements[TestType::writerCount][elementCount]{};
+	bzd::threadsafe::NonOwningForwardList<Element> list;
+	bzd::Atomic<bzd::Size> remainingWriters{0u};
+
+	const auto workload = [&](const bzd::Size index) {
+		if (index < TestType::writerCount)
+		{
+			for (bzd::Size iteration = 0u; iteration < batch; ++iteration)
+			{
+				for (auto& element : elements[index])
+				{
+					[[maybe_unused]] const auto isPushed = list.pushFront(element);
+				}
+				for (auto& element : elements[index])
+				{
+					[[maybe_unused]] const auto isPopped = list.popToRetire(element);
+				}
+				list.waitToDiscard();
+			}
+			--remainingWriters;
+			return;
+		}
+		while (remainingWriters.load() != 0u)
+		{
+			bzd::test::doNotOptimize(list.back());
+		}
+	};
+	bzd::test::Workers workers{TestType::writerCount + TestType::readerCount, workload};
+
+	benchmark.setItemsPerIteration(TestType::writerCount * batch * elementCount * 2u);
+	for (auto _ : benchmark)
+	{
+		remainingWriters.store(TestType::writerCount);
+		workers.run();
+	}
+}
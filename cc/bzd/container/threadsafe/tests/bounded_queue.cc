@@ -0,0 +1,140 @@
+#include "cc/bzd/container/threadsafe/bounded_queue.hh"
+
+#include "cc/bzd/container/threadsafe/async_bounded_queue.hh"
+#include "cc/bzd/test/test.hh"
+#include "cc/bzd/test/types/lifetime_counter.hh"
+#include "cc/bzd/test/types/move_only.hh"
+
+namespace {
+template <bzd::threadsafe::BoundedQueueType type>
+struct Tag
+{
+};
+
+template <bzd::threadsafe::BoundedQueueType type>
+using Counted = bzd::test::LifetimeCounter<Tag<type>>;
+
+template <class T>
+bzd::Size alive() noexcept
+{
+	return T::constructor + T::copy + T::move - T::destructor;
+}
+
+template <bzd::threadsafe::BoundedQueueType type>
+void basic()
+{
+	bzd::threadsafe::BoundedQueue<int, 4, type> queue;
+	EXPECT_TRUE(queue.empty());
+	EXPECT_EQ(queue.capacity(), 4u);
+	EXPECT_FALSE(queue.pop());
+
+	// Go around the ring several times.
+	int next{0};
+	int expected{0};
+	for (int iteration = 0; iteration < 10; ++iteration)
+	{
+		while (queue.push(next))
+		{
+			++next;
+		}
+		EXPECT_EQ(queue.size(), 4u);
+		for (int i = 0; i < 3; ++i)
+		{
+			const auto maybeValue = queue.pop();
+			EXPECT_TRUE(maybeValue);
+			EXPECT_EQ(maybeValue.value(), expected++);
+		}
+		EXPECT_EQ(queue.size(), 1u);
+	}
+	EXPECT_EQ(queue.pop().value(), expected);
+	EXPECT_TRUE(queue.empty());
+}
+
+template <bzd::threadsafe::BoundedQueueType type>
+void lifetime()
+{
+	using Element = Counted<type>;
+	{
+		bzd::threadsafe::BoundedQueue<Element, 8, type> queue;
+		for (bzd::Size i = 0u; i < 5u; ++i)
+		{
+			EXPECT_TRUE(queue.push(Element{}));
+		}
+		EXPECT_EQ(alive<Element>(), 5u);
+		{
+			auto maybeValue = queue.pop();
+			EXPECT_TRUE(maybeValue);
+			EXPECT_EQ(alive<Element>(), 5u);
+		}
+		EXPECT_EQ(alive<Element>(), 4u);
+	}
+	// Remaining elements are destroyed with the queue.
+	EXPECT_EQ(alive<Element>(), 0u);
+
+	bzd::threadsafe::BoundedQueue<bzd::test::MoveOnly, 2, type> queue;
+	EXPECT_TRUE(queue.push(bzd::test::MoveOnly{}));
+	bzd::test::MoveOnly value{};
+	EXPECT_TRUE(queue.push(bzd::move(value)));
+	EXPECT_FALSE(queue.push(bzd::test::MoveOnly{}));
+	EXPECT_TRUE(queue.pop());
+}
+} // namespace
+
+TEST(BoundedQueue, Basic)
+{
+	basic<bzd::threadsafe::BoundedQueueType::mpmc>();
+	basic<bzd::threadsafe::BoundedQueueType::spsc>();
+}
+
+TEST(BoundedQueue, Lifetime)
+{
+	lifetime<bzd::threadsafe::BoundedQueueType::mpmc>();
+	lifetime<bzd::threadsafe::BoundedQueueType::spsc>();
+}
+
+namespace {
+template <class Queue>
+bzd::Async<> producer(Queue& queue, const int first, const int count)
+{
+	for (int i = first; i < first + count; ++i)
+	{
+		co_await !queue.push(i);
+	}
+	co_return {};
+}
+
+template <class Queue>
+bzd::Async<> consumer(Queue& queue, const int count, int& sum)
+{
+	for (int i = 0; i < count; ++i)
+	{
+		sum += co_await !queue.pop();
+	}
+	co_return {};
+}
+} // namespace
+
+TEST_ASYNC(AsyncBoundedQueue, ProducerConsumer)
+{
+	bzd::threadsafe::AsyncBoundedQueue<int, 4> queue;
+	int sum1{0};
+	int sum2{0};
+	// The queue is much smaller than the number of elements, so both sides will have to wait.
+	[[maybe_unused]] const auto result = co_await bzd::async::all(
+		consumer(queue, 50, sum1), producer(queue, 0, 50), producer(queue, 50, 50), consumer(queue, 50, sum2));
+	EXPECT_EQ(sum1 + sum2, 4950);
+	EXPECT_TRUE(queue.empty());
+	co_return {};
+}
+
+TEST_ASYNC(AsyncBoundedQueue, Try)
+{
+	bzd::threadsafe::AsyncBoundedQueue<int, 2, bzd::threadsafe::BoundedQueueType::spsc> queue;
+	EXPECT_FALSE(queue.tryPop());
+	EXPECT_TRUE(queue.tryPush(1));
+	EXPECT_TRUE(queue.tryPush(2));
+	EXPECT_FALSE(queue.tryPush(3));
+	EXPECT_EQ(co_await !queue.pop(), 1);
+	EXPECT_EQ(queue.tryPop().value(), 2);
+	co_return {};
+}
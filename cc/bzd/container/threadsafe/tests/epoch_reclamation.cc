@@ -0,0 +1,62 @@
+#include "cc/bzd/container/threadsafe/epoch_reclamation.hh"
+
+#include "cc/bzd/test/test.hh"
+
+TEST(EpochReclamation, Simple)
+{
+	bzd::threadsafe::EpochReclamation<4u> reclamation;
+
+	// Without readers, the element can be reclaimed right away.
+	{
+		const auto retired = reclamation.retire();
+		EXPECT_TRUE(reclamation.isReclaimable(retired));
+	}
+
+	// An active reader prevents reclamation.
+	{
+		auto scope = reclamation.enter();
+		const auto retired = reclamation.retire();
+		EXPECT_FALSE(reclamation.isReclaimable(retired));
+		EXPECT_FALSE(reclamation.isReclaimable(retired));
+		scope.release();
+		EXPECT_TRUE(reclamation.isReclaimable(retired));
+	}
+}
+
+TEST(EpochReclamation, LateReaders)
+{
+	bzd::threadsafe::EpochReclamation<4u> reclamation;
+
+	auto scope1 = reclamation.enter();
+	const auto retired = reclamation.retire();
+	EXPECT_FALSE(reclamation.isReclaimable(retired));
+	EXPECT_EQ(reclamation.epoch(), retired + 1u);
+	scope1.release();
+
+	// Readers entering once the epoch advanced cannot see the element and do not delay it.
+	auto scope2 = reclamation.enter();
+	[[maybe_unused]] const auto scope3 = reclamation.enter();
+	EXPECT_TRUE(reclamation.isReclaimable(retired));
+
+	// But they hold the next ones.
+	const auto retiredNext = reclamation.retire();
+	EXPECT_FALSE(reclamation.isReclaimable(retiredNext));
+	scope2.release();
+	EXPECT_FALSE(reclamation.isReclaimable(retiredNext));
+}
+
+TEST(EpochReclamation, AllSlots)
+{
+	bzd::threadsafe::EpochReclamation<2u> reclamation;
+	auto scope1 = reclamation.enter();
+	auto scope2 = reclamation.enter();
+	const auto retired = reclamation.retire();
+	scope1.release();
+	EXPECT_FALSE(reclamation.isReclaimable(retired));
+	// The slot freed is reused.
+	auto scope3 = reclamation.enter();
+	scope2.release();
+	scope3.release();
+	reclamation.synchronize(retired);
+	EXPECT_TRUE(reclamation.isReclaimable(retired));
+}
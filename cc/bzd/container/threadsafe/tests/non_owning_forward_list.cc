@@ -79,3 +79,26 @@ TEST(NonOwningForwardList, simple)
 		}
 	}
 }
+
+TEST(NonOwningForwardList, readerCount)
+{
+	class Element : public bzd::threadsafe::NonOwningForwardListElement</*MultiContainer*/ false, /*discard*/ true, /*readers*/ 32u>
+	{
+	};
+	Element element;
+	bzd::threadsafe::NonOwningForwardList<Element> list;
+	ASSERT_TRUE(list.pushFront(element));
+
+	// More scopes than the default number of readers are held at once.
+	bzd::Optional<decltype(list.back())> scopes[20];
+	for (auto& scope : scopes)
+	{
+		scope.emplace(list.back());
+		EXPECT_TRUE(scope.value());
+	}
+	for (auto& scope : scopes)
+	{
+		scope.reset();
+	}
+	EXPECT_TRUE(list.pop(element));
+}
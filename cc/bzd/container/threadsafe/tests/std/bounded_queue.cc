@@ -0,0 +1,132 @@
+#include "cc/bzd/container/threadsafe/bounded_queue.hh"
+
+#include "cc/bzd/container/array.hh"
+#include "cc/bzd/container/threadsafe/async_bounded_queue.hh"
+#include "cc/bzd/test/multithread.hh"
+
+#include <thread>
+
+namespace {
+constexpr bzd::Size nbElements{20000u};
+
+template <bzd::Size nbProducers, bzd::Size nbConsumers, class Queue>
+void stress(Queue& queue)
+{
+	bzd::Atomic<bzd::Size> sum{0u};
+	bzd::Atomic<bzd::Size> count{0u};
+	bzd::Array<std::thread, nbProducers + nbConsumers> threads;
+	for (bzd::Size i = 0u; i < nbProducers; ++i)
+	{
+		threads[i] = std::thread{[&queue, i]() {
+			for (bzd::Size value = i; value < nbElements; value += nbProducers)
+			{
+				while (!queue.push(value))
+				{
+					std::this_thread::yield();
+				}
+			}
+		}};
+	}
+	for (bzd::Size i = 0u; i < nbConsumers; ++i)
+	{
+		threads[nbProducers + i] = std::thread{[&]() {
+			while (count.load() < nbElements)
+			{
+				if (const auto maybeValue = queue.pop(); maybeValue)
+				{
+					sum += maybeValue.value();
+					++count;
+				}
+				else
+				{
+					std::this_thread::yield();
+				}
+			}
+		}};
+	}
+	for (auto& thread : threads)
+	{
+		thread.join();
+	}
+	EXPECT_EQ(count.load(), nbElements);
+	EXPECT_EQ(sum.load(), nbElements * (nbElements - 1u) / 2u);
+	EXPECT_TRUE(queue.empty());
+}
+} // namespace
+
+TEST(BoundedQueue, StressMPMC)
+{
+	bzd::threadsafe::BoundedQueue<bzd::Size, 64> queue;
+	stress<1, 1>(queue);
+	stress<4, 1>(queue);
+	stress<1, 4>(queue);
+	stress<4, 4>(queue);
+}
+
+TEST(BoundedQueue, StressSPSC)
+{
+	bzd::threadsafe::BoundedQueue<bzd::Size, 64, bzd::threadsafe::BoundedQueueType::spsc> queue;
+	stress<1, 1>(queue);
+
+	// Order must be preserved.
+	bzd::Bool ordered{true};
+	std::thread producer{[&]() {
+		for (bzd::Size value = 0u; value < nbElements; ++value)
+		{
+			while (!queue.push(value))
+			{
+				std::this_thread::yield();
+			}
+		}
+	}};
+	std::thread consumer{[&]() {
+		for (bzd::Size expected = 0u; expected < nbElements;)
+		{
+			if (const auto maybeValue = queue.pop(); maybeValue)
+			{
+				ordered &= (maybeValue.value() == expected);
+				++expected;
+			}
+			else
+			{
+				std::this_thread::yield();
+			}
+		}
+	}};
+	producer.join();
+	consumer.join();
+	EXPECT_TRUE(ordered);
+}
+
+namespace {
+bzd::Async<> producer(bzd::threadsafe::AsyncBoundedQueue<bzd::Size, 8>& queue, const bzd::Size first, const bzd::Size count)
+{
+	for (bzd::Size value = first; value < first + count; ++value)
+	{
+		co_await !queue.push(value);
+	}
+	co_return {};
+}
+
+bzd::Async<> consumer(bzd::threadsafe::AsyncBoundedQueue<bzd::Size, 8>& queue, const bzd::Size count, bzd::Atomic<bzd::Size>& sum)
+{
+	for (bzd::Size i = 0u; i < count; ++i)
+	{
+		sum += co_await !queue.pop();
+	}
+	co_return {};
+}
+} // namespace
+
+TEST_ASYNC_MULTITHREAD(AsyncBoundedQueue, Stress, 4)
+{
+	bzd::threadsafe::AsyncBoundedQueue<bzd::Size, 8> queue;
+	bzd::Atomic<bzd::Size> sum{0u};
+	[[maybe_unused]] const auto result = co_await bzd::async::allParallel(producer(queue, 0u, 1000u),
+														 consumer(queue, 1000u, sum),
+														 producer(queue, 1000u, 1000u),
+														 consumer(queue, 1000u, sum));
+	EXPECT_EQ(sum.load(), 2000u * 1999u / 2u);
+	EXPECT_TRUE(queue.empty());
+	co_return {};
+}
@@ -399,3 +399,89 @@ TEST(NonOwningForwardList, PopToDiscard)
 		}
 	}
 }
+
+TEST(NonOwningForwardList, PopToRetire)
+{
+	constexpr bzd::Size nbWriters{4};
+	constexpr bzd::Size nbElementsPerWriter{4};
+	constexpr bzd::Size nbCycles{5000};
+	constexpr bzd::Size poison{static_cast<bzd::Size>(-1)};
+
+	bzd::test::NonOwningForwardList<bzd::test::ListElementDiscard> data{};
+	bzd::Atomic<bzd::Size> writersDone{0};
+	bzd::Atomic<bzd::Size> reads{0};
+
+	std::vector<std::thread> threads;
+	for (bzd::Size writer = 0; writer < nbWriters; ++writer)
+	{
+		threads.emplace_back([&]() {
+			bzd::test::ListElementDiscard elements[nbElementsPerWriter];
+			bzd::Optional<bzd::Size> retired[nbElementsPerWriter];
+			bool inserted[nbElementsPerWriter]{};
+			for (bzd::Size cycle = 0; cycle < nbCycles; ++cycle)
+			{
+				// Half of the elements are in the list at any time, the other half is retired.
+				const auto index = cycle % nbElementsPerWriter;
+				auto& element = elements[index];
+				if (retired[index])
+				{
+					// Wait for the grace period without blocking, by yielding to the other threads.
+					while (!data.isDiscardable(retired[index].value()))
+					{
+						std::this_thread::yield();
+					}
+					// The element is now discarded, any reader accessing it would see the poison value.
+					element.value_ = poison;
+					retired[index].reset();
+				}
+				element.value_ = cycle;
+				const auto result1 = data.pushFront(element);
+				EXPECT_TRUE(result1);
+				inserted[index] = true;
+
+				const auto indexToRemove = (cycle + nbElementsPerWriter / 2) % nbElementsPerWriter;
+				if (inserted[indexToRemove])
+				{
+					const auto result2 = data.popToRetire(elements[indexToRemove]);
+					EXPECT_TRUE(result2);
+					retired[indexToRemove] = result2.value();
+					inserted[indexToRemove] = false;
+				}
+			}
+			for (bzd::Size index = 0; index < nbElementsPerWriter; ++index)
+			{
+				if (inserted[index])
+				{
+					const auto result = data.popToDiscard(elements[index]);
+					EXPECT_TRUE(result);
+				}
+				if (retired[index])
+				{
+					data.waitToDiscard();
+				}
+			}
+			++writersDone;
+		});
+	}
+	for (bzd::Size reader = 0; reader < 2; ++reader)
+	{
+		threads.emplace_back([&]() {
+			while (writersDone.load() < nbWriters)
+			{
+				if (const auto maybeBack = data.back(); maybeBack)
+				{
+					EXPECT_NE(maybeBack.value().get().value_, poison);
+					++reads;
+				}
+				std::this_thread::yield();
+			}
+		});
+	}
+
+	for (auto& thread : threads)
+	{
+		thread.join();
+	}
+	EXPECT_TRUE(data.empty());
+	std::cout << "Reads: " << reads.load() << std::endl;
+}
@@ -9,6 +9,7 @@
 #include "cc/bzd/core/async/awaitables/get_executor.hh"
 #include "cc/bzd/core/async/awaitables/no_return.hh"
 #include "cc/bzd/core/async/awaitables/propagate.hh"
+#include "cc/bzd/core/async/awaitables/spawn.hh"
 #include "cc/bzd/core/async/awaitables/suspend.hh"
 #include "cc/bzd/core/async/awaitables/yield.hh"
 #include "cc/bzd/core/async/cancellation.hh"
@@ -33,6 +34,9 @@ using Executable = bzd::async::impl::PromiseBase;
 using ExecutableSuspended = bzd::async::impl::ExecutableSuspended<Executable>;
 using Executor = bzd::async::impl::Executor<Executable>;
 using Type = bzd::async::impl::ExecutableMetadata::Type;
+
+template <Size capacity>
+class Nursery;
 } // namespace bzd::async
 
 namespace bzd::impl {
@@ -186,6 +190,10 @@ private:
 	template <class... Args>
 	friend class bzd::async::awaitable::EnqueueAny;
 	template <class U>
+	friend class bzd::async::awaitable::Spawn;
+	template <Size capacity>
+	friend class bzd::async::Nursery;
+	template <class U>
 	friend class bzd::async::awaitable::Awaiter;
 
 	/// Destroy the current async and nested ones.
@@ -470,4 +478,41 @@ anyParallel(Asyncs&&... asyncs) noexcept
 	co_return (co_await bzd::async::awaitable::EnqueueAny<Asyncs...>{/*parallel*/ true, bzd::forward<Asyncs>(asyncs)...});
 }
 
+namespace impl {
+template <class Async>
+bzd::Async<> spawn(const bzd::Span<Async> asyncs, const Bool parallel) noexcept
+{
+	co_await bzd::async::awaitable::Spawn<Async>{asyncs, parallel};
+	// Propagate the first error if any.
+	for (auto& async : asyncs)
+	{
+		if (async.result().hasError())
+		{
+			co_return bzd::move(async.moveResultOut()).propagate();
+		}
+	}
+	co_return {};
+}
+} // namespace impl
+
+/// Executes a runtime defined number of asynchronous functions according to the executor policy and return once all
+/// are completed.
+///
+/// The results are kept within each async, only the first error, if any, is propagated.
+template <concepts::async Async>
+bzd::Async<> spawn(const bzd::Span<Async> asyncs) noexcept
+{
+	return impl::spawn(asyncs, /*parallel*/ false);
+}
+
+/// Executes a runtime defined number of asynchronous functions according to the executor policy and return once all
+/// are completed. Each of them can run on any core.
+///
+/// The results are kept within each async, only the first error, if any, is propagated.
+template <concepts::async Async>
+bzd::Async<> spawnParallel(const bzd::Span<Async> asyncs) noexcept
+{
+	return impl::spawn(asyncs, /*parallel*/ true);
+}
+
 } // namespace bzd::async
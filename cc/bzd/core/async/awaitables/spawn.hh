@@ -1,12 +1,83 @@
 #pragma once
 
+#include "cc/bzd/container/span.hh"
 #include "cc/bzd/core/async/promise.hh"
 
 namespace bzd::async::awaitable {
 
 /// Awaitable to spawn one or more executables.
+///
+/// Unlike EnqueueAll, the number of executables is only known at runtime. They are all scheduled
+/// on the executor of the caller, which is resumed once, only after all of them are completed.
+template <class Async>
 class Spawn : public bzd::async::impl::suspend_always
 {
+public: // Traits.
+	using Self = Spawn<Async>;
+
+public: // Constructor.
+	constexpr Spawn(const bzd::Span<Async> asyncs, const Bool parallel) noexcept : asyncs_{asyncs}, parallel_{parallel} {}
+
+	constexpr Spawn(const Self&) noexcept = delete;
+	constexpr Self& operator=(const Self&) noexcept = delete;
+	constexpr Spawn(Self&&) noexcept = delete;
+	constexpr Self& operator=(Self&&) noexcept = delete;
+
+public: // Coroutine specializations.
+	// NOLINTNEXTLINE(readability-identifier-naming)
+	constexpr bool await_ready() noexcept { return asyncs_.empty(); }
+
+	template <class T>
+	// NOLINTNEXTLINE(readability-identifier-naming)
+	constexpr void await_suspend(bzd::async::impl::coroutine_handle<T> caller) noexcept
+	{
+		auto& promise = caller.promise();
+		auto& executor{promise.getExecutor()};
+		continuation_.emplace(promise);
+
+		// If multi core is enabled, set the context for it.
+		auto metadata = promise.getMetadata();
+		if (parallel_)
+		{
+			metadata.anyCore();
+		}
+
+		auto maybeToken = promise.getCancellationToken();
+		const auto callback = bzd::async::impl::PromiseBase::OnTerminateCallback::toMember<Self, &Self::onTerminateCallback>(*this);
+		// Note, nothing from this object can be accessed after the last executable is scheduled,
+		// as the caller might be resumed and this awaitable destroyed concurrently.
+		const auto size = asyncs_.size();
+		for (Size index = 0u; index < size; ++index)
+		{
+			auto& executable = asyncs_[index].getExecutable();
+			if (maybeToken.hasValue())
+			{
+				executable.setCancellationToken(maybeToken.valueMutable());
+			}
+			executable.setConditionalContinuation(callback);
+			executor.schedule(executable, metadata);
+		}
+	}
+
+	// NOLINTNEXTLINE(readability-identifier-naming)
+	constexpr void await_resume() noexcept {}
+
+private:
+	constexpr bzd::Optional<bzd::async::impl::PromiseBase&> onTerminateCallback() noexcept
+	{
+		// Only the last executable to complete pushes the caller back into the scheduling queue.
+		if (++counter_ == asyncs_.size())
+		{
+			return continuation_;
+		}
+		return bzd::nullopt;
+	}
+
+private:
+	bzd::Span<Async> asyncs_;
+	Bool parallel_;
+	bzd::Atomic<Size> counter_{0};
+	bzd::Optional<bzd::async::impl::PromiseBase&> continuation_{};
 };
 
 } // namespace bzd::async::awaitable
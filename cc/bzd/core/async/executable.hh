@@ -71,6 +71,15 @@ public: // Accessors.
 		return contextUId == actualUId;
 	}
 
+	/// The core this executable was last scheduled on, 0 if it never ran.
+	[[nodiscard]] constexpr UInt16 getCoreUId() const noexcept
+	{
+		return static_cast<UInt16>(flags_.load(MemoryOrder::relaxed) >> 2);
+	}
+
+	/// If the executable must only be scheduled on the core it was last scheduled on.
+	[[nodiscard]] constexpr Bool isPinned() const noexcept { return (flags_.load(MemoryOrder::relaxed) & 0x2) == 0x2; }
+
 	/// The executable can operate on any core, therefore threadsafe operation must be considered.
 	constexpr void anyCore() noexcept
 	{
@@ -274,6 +283,8 @@ public:
 	constexpr T& getExecutable() noexcept { return *static_cast<T*>(this); }
 
 	[[nodiscard]] constexpr bzd::async::impl::ExecutableMetadata::Type getType() const noexcept { return metadata_.getType(); }
+	[[nodiscard]] constexpr UInt16 getCoreUId() const noexcept { return metadata_.getCoreUId(); }
+	[[nodiscard]] constexpr Bool isPinned() const noexcept { return metadata_.isPinned(); }
 	[[nodiscard]] constexpr bzd::async::impl::ExecutableMetadata getMetadata() const noexcept { return metadata_; }
 
 	constexpr void setMetadata(const bzd::async::impl::ExecutableMetadata metadata) noexcept
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "cc/bzd/container/array.hh"
 #include "cc/bzd/container/function_ref.hh"
 #include "cc/bzd/container/threadsafe/non_owning_forward_list.hh"
 #include "cc/bzd/container/threadsafe/non_owning_ring_spin.hh"
@@ -7,6 +8,7 @@
 #include "cc/bzd/core/async/executable.hh"
 #include "cc/bzd/core/async/executor_profiler.hh"
 #include "cc/bzd/platform/atomic.hh"
+#include "cc/bzd/platform/processor.hh"
 #include "cc/bzd/utility/ranges/associate_scope.hh"
 #include "cc/bzd/utility/synchronization/spin_shared_mutex.hh"
 #include "cc/bzd/utility/synchronization/sync_lock_guard.hh"
@@ -87,6 +89,9 @@ class Executor
 public: // Traits.
 	using Self = Executor<Executable>;
 	using TickType = typename ExecutorContext<Executable>::TickType;
+	/// Callback triggered each time an executable becomes ready to be scheduled.
+	/// It receives the core the executable was last scheduled on and whether it is pinned to it.
+	using OnScheduleCallback = bzd::FunctionRef<void(const UInt16 coreUId, const Bool isPinned)>;
 
 	enum class Status
 	{
@@ -108,10 +113,33 @@ public:
 	constexpr ~Executor() noexcept { shutdown(); }
 
 public: // Statistics.
-	[[nodiscard]] constexpr Size getQueueCount() const noexcept { return queueCount_.load(); }
+	[[nodiscard]] constexpr Size getQueueCount() const noexcept
+	{
+		Int32 count{0};
+		for (const auto& counters : counters_)
+		{
+			count += counters.queue.load(MemoryOrder::relaxed);
+		}
+		return static_cast<Size>(count);
+	}
+	/// Number of entries in the queue pinned to a specific core, therefore that only this core can process.
+	/// Other cores might share the same shard, so this is an upper bound.
+	[[nodiscard]] constexpr Size getPinnedCount(const UInt16 coreUId) const noexcept
+	{
+		const auto count = counters_[coreUId % counters_.size()].pinned.load();
+		return (count > 0) ? static_cast<Size>(count) : 0u;
+	}
 	[[nodiscard]] constexpr Size getRunningCount() const noexcept { return context_.size(); }
 	[[nodiscard]] constexpr Size getMaxRunningCount() const noexcept { return maxRunningCount_.load(); }
-	[[nodiscard]] constexpr Int32 getWorkloadCount() const noexcept { return workloadCount_.load(); }
+	[[nodiscard]] constexpr Int32 getWorkloadCount() const noexcept
+	{
+		Int32 count{0};
+		for (const auto& counters : counters_)
+		{
+			count += counters.workload.load(MemoryOrder::relaxed);
+		}
+		return count;
+	}
 
 public:
 	/// Run all the workload currently in the queue.
@@ -137,14 +165,17 @@ public:
 		// Run at least the number of times there are elements in the queue, this is to ensure that
 		// all the services are running at least once.
 		const auto minIterationCount = getQueueCount();
+		// Only report idling on transitions.
+		Bool isIdle{false};
 
 		// Loop until there are still workload executables to process or an abort request is present.
-		while ((getWorkloadCount() > 0 || context.getTick() <= minIterationCount) && status_.load() != Status::abortRequested)
+		while ((hasWorkload() || context.getTick() <= minIterationCount) && status_.load() != Status::abortRequested)
 		{
 			// Drain remaining handles
 			auto maybeExecutable = pop(context);
 			if (maybeExecutable.hasValue())
 			{
+				isIdle = false;
 				profiler.event(profiler::ExecutableScheduled{});
 				do
 				{
@@ -157,7 +188,10 @@ public:
 					}
 					else
 					{
+						profiler.event(profiler::ExecutableResumed{executable.getId(), executable.getTypeId()});
 						executable.resume(context);
+						// The executable must not be accessed from here, it might be already destroyed.
+						profiler.event(profiler::ExecutableSuspended{});
 					}
 
 					// Execute the continuation if any, this instead of enqueuing it,
@@ -168,6 +202,11 @@ public:
 				} while (maybeExecutable.hasValue());
 				profiler.event(profiler::ExecutableUnscheduled{});
 			}
+			else if (!isIdle)
+			{
+				isIdle = true;
+				profiler.event(profiler::CoreIdle{});
+			}
 			context.updateTick();
 		}
 	}
@@ -192,6 +231,12 @@ public:
 
 	constexpr Bool isRunning() const noexcept { return status_.load() == Status::running; }
 
+	/// Register a callback to be notified when an executable is ready to be scheduled.
+	///
+	/// This is used to wake up idle cores, it is called from the hot path (and possibly from an ISR)
+	/// so it must be fast and non-blocking.
+	constexpr void setOnSchedule(const OnScheduleCallback callback) noexcept { onSchedule_.emplace(callback); }
+
 	/// Schedule a new executable on this executor.
 	constexpr void schedule(Executable& executable, const ExecutableMetadata::Type type) noexcept
 	{
@@ -278,14 +323,24 @@ private:
 	/// \param increment Increment the counters.
 	constexpr void push(Executable& executable, const Bool increment = true) noexcept
 	{
+		// The executable might be executed and destroyed as soon as it is pushed, and this executor with it if
+		// it was the last one, so read everything beforehand.
+		const auto coreUId = executable.getCoreUId();
+		const auto isPinned = executable.isPinned();
+		const auto onSchedule = (increment) ? onSchedule_ : bzd::nullopt;
 		if (increment)
 		{
 			// It is important to update the counters before being pushed, otherwise the executable might be
 			// popped before the counters are increased, leaving them in an incoherent state.
-			incrementCounters(executable);
+			incrementCounters(executable, coreUId, isPinned);
 		}
 		// Only at the end push the executable to the work queue.
 		queue_.pushBack(executable);
+		// Skipped executables are not ready yet, they notify when unskipped.
+		if (onSchedule.hasValue())
+		{
+			onSchedule.value()(coreUId, isPinned);
+		}
 	}
 
 	/// Unskip an executable already added to the queue.
@@ -293,19 +348,50 @@ private:
 	/// This call is ISR friendly.
 	constexpr void unskip(Executable& executable) noexcept
 	{
-		incrementCounters(executable);
+		const auto coreUId = executable.getCoreUId();
+		const auto isPinned = executable.isPinned();
+		const auto onSchedule = onSchedule_;
+		incrementCounters(executable, coreUId, isPinned);
 		executable.unskip();
+		if (onSchedule.hasValue())
+		{
+			onSchedule.value()(coreUId, isPinned);
+		}
 	}
 
-	constexpr void incrementCounters(Executable& executable) noexcept
+	/// Account an executable in the counters of the core it was last scheduled on.
+	///
+	/// The shard is given by the executable and not by the caller, which keeps this ISR friendly and ensures
+	/// the executable is accounted on the same shard when pushed and popped, so shards never go negative.
+	/// Executables usually resume on the same core, so its pushes and pops mostly touch its own cache line.
+	constexpr void incrementCounters(Executable& executable, const UInt16 coreUId, const Bool isPinned) noexcept
 	{
+		auto& counters = getCounters(coreUId);
 		if (executable.getType() == ExecutableMetadata::Type::workload)
 		{
-			++workloadCount_;
+			// Only the transitions of a shard from empty to non-empty are propagated to the global counter.
+			if (counters.workload++ == 0)
+			{
+				++workloadShards_;
+			}
+		}
+		++counters.queue;
+		// Only the core it is pinned to can process it, this one needs to know.
+		if (isPinned)
+		{
+			++counters.pinned;
 		}
-		++queueCount_;
 	}
 
+	/// Get the counters associated with a core.
+	[[nodiscard]] constexpr auto& getCounters(const UInt16 coreUId) noexcept { return counters_[coreUId % counters_.size()]; }
+
+	/// Whether there are workload executables still to be processed.
+	///
+	/// This is polled on every iteration of the executor loop, it reads a single atomic and only sums
+	/// the shards when it reports none, to confirm the transitions of all shards were propagated.
+	[[nodiscard]] constexpr Bool hasWorkload() const noexcept { return workloadShards_.load() > 0 || getWorkloadCount() > 0; }
+
 	/// Pop the next executable to process.
 	///
 	/// \param context The context that should match the executable, to ensure that async runs on the
@@ -322,15 +408,25 @@ private:
 			// std::cout << "stack: "  << initial_stack << "+" << (reinterpret_cast<bzd::IntPointer>(initial_stack) -
 			// reinterpret_cast<bzd::IntPointer>(stack)) << std::endl;
 
-			// Associate this executable with this context.
-			maybeExecutable->pinCore(coreUId);
-
+			// Decrement the counters on the shard it was accounted on, before it is associated with this core.
+			auto& counters = getCounters(maybeExecutable->getCoreUId());
 			if (maybeExecutable->getType() == ExecutableMetadata::Type::workload)
 			{
-				auto current = --workloadCount_;
+				auto current = --counters.workload;
 				bzd::assert::isTrue(current >= 0);
+				if (current == 0)
+				{
+					--workloadShards_;
+				}
 			}
-			--queueCount_;
+			--counters.queue;
+			if (maybeExecutable->isPinned())
+			{
+				--counters.pinned;
+			}
+
+			// Associate this executable with this context.
+			maybeExecutable->pinCore(coreUId);
 
 			return maybeExecutable.valueMutable();
 		}
@@ -344,8 +440,24 @@ private:
 	template <class U>
 	friend class bzd::async::impl::ExecutableSuspended;
 
+	/// Number of counter shards, cores beyond this number share them.
+	static constexpr Size countersShardCount{8u};
+
+	/// Counters associated with one or multiple cores.
+	struct alignas(bzd::platform::cacheLineSize) Counters
+	{
+		/// Number of entries in the queue.
+		bzd::Atomic<Int32> queue{0};
+		/// Number of workload asyncs in the queue.
+		/// Note it should never be negative, we use an int32 here only for testing purposes
+		/// to avoid an infinite loop.
+		bzd::Atomic<Int32> workload{0};
+		/// Number of entries in the queue pinned to this core.
+		bzd::Atomic<Int32> pinned{0};
+	};
+
 	/// List of pending workload waiting to be scheduled.
-	bzd::threadsafe::NonOwningRingSpin<Executable> queue_{};
+	alignas(bzd::platform::cacheLineSize) bzd::threadsafe::NonOwningRingSpin<Executable> queue_{};
 	/// Keep contexts about the current running scheduler.
 	bzd::threadsafe::NonOwningForwardList<ExecutorContext<Executable>> context_{};
 	/// Mutex to protect access over the context queue.
@@ -353,13 +465,16 @@ private:
 	/// Maximum concurrent scheduler running at the same time.
 	bzd::Atomic<Size> maxRunningCount_{0u};
 	/// Current status of the executor.
-	bzd::Atomic<Status> status_{Status::idle};
-	/// Number of entries in the queue.
-	bzd::Atomic<Size> queueCount_{0u};
-	/// Number of workload asyncs in the queue.
-	/// Note getWorkloadCount() should never be negative, we use an int32 here only for testing purposes
-	/// to avoid an infinite loop.
-	bzd::Atomic<Int32> workloadCount_{0u};
+	/// It is read at every iteration by all cores, so it is kept on its own cache line.
+	alignas(bzd::platform::cacheLineSize) bzd::Atomic<Status> status_{Status::idle};
+	/// Counters updated on every push and pop, sharded per core to avoid bouncing a single
+	/// cache line between all cores. They are summed when read.
+	bzd::Array<Counters, countersShardCount> counters_{};
+	/// Number of shards with workload executables, it only changes when a shard becomes empty or non-empty.
+	/// It might be transiently off while a transition is being propagated, see hasWorkload().
+	alignas(bzd::platform::cacheLineSize) bzd::Atomic<Int32> workloadShards_{0};
+	/// Optional callback triggered when an executable is ready to be scheduled.
+	bzd::Optional<OnScheduleCallback> onSchedule_{};
 };
 
 } // namespace bzd::async::impl
@@ -28,4 +28,23 @@ struct ExecutableCanceled
 {
 };
 
+/// An executable is about to be resumed on this core.
+struct ExecutableResumed
+{
+	/// Identifier of the executable, unique while it is alive.
+	const void* id;
+	/// Identifier of the code of the executable, shared by all its instances.
+	const void* type;
+};
+
+/// The executable previously resumed on this core returned to the executor.
+struct ExecutableSuspended
+{
+};
+
+/// The core ran out of executables to process, it is emitted once per idle period.
+struct CoreIdle
+{
+};
+
 } // namespace bzd::async::profiler
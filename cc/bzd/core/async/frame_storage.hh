@@ -0,0 +1,149 @@
+#pragma once
+
+#include "cc/bzd/container/span.hh"
+#include "cc/bzd/platform/atomic.hh"
+#include "cc/bzd/platform/types.hh"
+#include "cc/bzd/utility/align_up.hh"
+
+namespace bzd::async {
+
+/// Bump allocator placing coroutine frames into a pre-allocated buffer.
+///
+/// The frames of the coroutines created on the current thread while an arena is active (see `FrameArena::Scope`)
+/// are taken from this arena, falling back to the heap when it is exhausted. Frames are never reclaimed, this is
+/// meant for long-lived coroutines, such as the entry points of an application, which makes the memory they use
+/// known at link time.
+///
+/// An arena must only be active on one thread at a time. Arenas are registered for the lifetime of the program,
+/// therefore they must have static storage duration.
+class FrameArena
+{
+public:
+	/// Alignment of the frames, the same as the one guaranteed by the default allocator.
+	static constexpr Size alignment{__STDCPP_DEFAULT_NEW_ALIGNMENT__};
+
+	/// Make an arena active on the current thread for the lifetime of this object.
+	class Scope
+	{
+	public:
+		explicit Scope(FrameArena& arena) noexcept : previous_{current()} { current() = &arena; }
+		Scope(const Scope&) = delete;
+		Scope& operator=(const Scope&) = delete;
+		Scope(Scope&&) = delete;
+		Scope& operator=(Scope&&) = delete;
+		~Scope() noexcept { current() = previous_; }
+
+	private:
+		FrameArena* previous_;
+	};
+
+public:
+	explicit FrameArena(const bzd::Span<Byte> data) noexcept : data_{data}
+	{
+		// Registration is lock-free and arenas are never removed, so it is safe against concurrent deallocations.
+		auto next = head().load();
+		do
+		{
+			next_ = next;
+		} while (!head().compareExchange(next, this));
+	}
+
+	FrameArena(const FrameArena&) = delete;
+	FrameArena& operator=(const FrameArena&) = delete;
+	FrameArena(FrameArena&&) = delete;
+	FrameArena& operator=(FrameArena&&) = delete;
+	~FrameArena() = default;
+
+public:
+	/// Allocate a frame from this arena.
+	///
+	/// \param size The size of the frame in bytes.
+	/// \return The frame or a null pointer if the arena is exhausted.
+	[[nodiscard]] void* allocate(const Size size) noexcept
+	{
+		const auto offset = bzd::alignUp(used_, alignment);
+		if (offset + size > data_.size())
+		{
+			missing_ += bzd::alignUp(size, alignment);
+			return nullptr;
+		}
+		used_ = offset + size;
+		return &data_[offset];
+	}
+
+	/// Tell if a frame was allocated from this arena.
+	[[nodiscard]] Bool owns(const void* ptr) const noexcept
+	{
+		const auto* byte = static_cast<const Byte*>(ptr);
+		return byte >= data_.data() && byte < data_.data() + data_.size();
+	}
+
+	/// Total number of bytes of this arena.
+	[[nodiscard]] constexpr Size capacity() const noexcept { return data_.size(); }
+	/// Number of bytes currently used.
+	[[nodiscard]] constexpr Size size() const noexcept { return used_; }
+	/// Number of bytes this arena should have to fit all the frames requested so far, including the ones
+	/// that were allocated from the heap because it was exhausted.
+	[[nodiscard]] constexpr Size getRequired() const noexcept { return bzd::alignUp(used_, alignment) + missing_; }
+	/// Tell if some of the frames could not fit and were allocated from the heap.
+	[[nodiscard]] constexpr Bool isExhausted() const noexcept { return missing_ != 0u; }
+
+public: // Frame allocation, used by the promises.
+	[[nodiscard]] static void* allocateFrame(const Size size) noexcept
+	{
+		if (auto* arena = current(); arena)
+		{
+			if (auto* ptr = arena->allocate(size); ptr)
+			{
+				return ptr;
+			}
+		}
+		return ::operator new(size);
+	}
+
+	static void deallocateFrame(void* ptr, const Size size) noexcept
+	{
+		for (auto* arena = head().load(MemoryOrder::acquire); arena; arena = arena->next_)
+		{
+			if (arena->owns(ptr))
+			{
+				return;
+			}
+		}
+		::operator delete(ptr, size);
+	}
+
+private:
+	static FrameArena*& current() noexcept
+	{
+		static thread_local FrameArena* arena{nullptr};
+		return arena;
+	}
+
+	static bzd::Atomic<FrameArena*>& head() noexcept
+	{
+		static bzd::Atomic<FrameArena*> arenas{nullptr};
+		return arenas;
+	}
+
+private:
+	bzd::Span<Byte> data_;
+	Size used_{0u};
+	Size missing_{0u};
+	FrameArena* next_{nullptr};
+};
+
+/// Statically sized frame arena.
+///
+/// \tparam frameSize The number of bytes reserved for the frames.
+template <Size frameSize>
+class FrameStorage : public FrameArena
+{
+public:
+	FrameStorage() noexcept : FrameArena{bzd::Span<Byte>{data_, frameSize}} {}
+
+private:
+	alignas(FrameArena::alignment) Byte data_[frameSize];
+};
+
+} // namespace bzd::async
@@ -0,0 +1,168 @@
+#pragma once
+
+#include "cc/bzd/container/vector.hh"
+#include "cc/bzd/core/async.hh"
+#include "cc/bzd/platform/atomic.hh"
+#include "cc/bzd/utility/scope_guard.hh"
+
+namespace bzd::async {
+
+/// Scope owning asyncs spawned at runtime.
+///
+/// Spawned asyncs start running concurrently with the caller right away, they can only outlive
+/// the statement spawning them but not the nursery itself: join() must be awaited before the
+/// nursery is destroyed.
+///
+/// \code
+/// bzd::async::Nursery<4> nursery;
+/// co_await !nursery.spawn(task1());
+/// co_await !nursery.spawn(task2());
+/// co_await !nursery.join();
+/// \endcode
+template <Size capacity>
+class Nursery
+{
+public: // Traits.
+	using Self = Nursery<capacity>;
+
+private:
+	/// Awaitable scheduling an async without suspending the caller.
+	class Spawn : public bzd::async::impl::suspend_always
+	{
+	public:
+		constexpr Spawn(Self& nursery, bzd::Async<>& async) noexcept : nursery_{nursery}, async_{async} {}
+
+		template <class T>
+		// NOLINTNEXTLINE(readability-identifier-naming)
+		constexpr bool await_suspend(bzd::async::impl::coroutine_handle<T> caller) noexcept
+		{
+			success_ = nursery_.schedule(caller.promise(), bzd::move(async_));
+			return false;
+		}
+
+		// NOLINTNEXTLINE(readability-identifier-naming)
+		[[nodiscard]] constexpr Bool await_resume() noexcept { return success_; }
+
+	private:
+		Self& nursery_;
+		bzd::Async<>& async_;
+		Bool success_{false};
+	};
+
+	/// Awaitable waiting for all the asyncs to complete.
+	class Join : public bzd::async::impl::suspend_always
+	{
+	public:
+		constexpr explicit Join(Self& nursery) noexcept : nursery_{nursery} {}
+
+		template <class T>
+		// NOLINTNEXTLINE(readability-identifier-naming)
+		constexpr bool await_suspend(bzd::async::impl::coroutine_handle<T> caller) noexcept
+		{
+			nursery_.continuation_.emplace(caller.promise());
+			// Release the reference held by the nursery, if it is the last one, do not suspend.
+			return (--nursery_.pending_ != 0u);
+		}
+
+		// NOLINTNEXTLINE(readability-identifier-naming)
+		constexpr void await_resume() noexcept {}
+
+	private:
+		Self& nursery_;
+	};
+
+public: // Constructors/assignments.
+	constexpr Nursery() noexcept = default;
+
+	Nursery(const Self&) = delete;
+	Self& operator=(const Self&) = delete;
+	Nursery(Self&&) = delete;
+	Self& operator=(Self&&) = delete;
+
+	constexpr ~Nursery() noexcept
+	{
+		bzd::assert::isTrue(pending_.load() == 1u, "Nursery destroyed before being joined.");
+		asyncs_.clear();
+	}
+
+public: // API.
+	/// Spawn a new async, it starts running on the executor of the caller.
+	///
+	/// \param async The async to be owned by this nursery.
+	/// \return An error if the nursery is full.
+	bzd::Async<> spawn(bzd::Async<> async) noexcept
+	{
+		const auto success = co_await Spawn{*this, async};
+		if (!success)
+		{
+			co_return bzd::error::Failure("Nursery is full."_csv);
+		}
+		co_return {};
+	}
+
+	/// Wait for all spawned asyncs to complete.
+	///
+	/// \return The first error reported by a spawned async if any.
+	bzd::Async<> join() noexcept
+	{
+		co_await Join{*this};
+		// Re-arm the nursery for further use.
+		pending_.store(1u);
+		continuation_.reset();
+
+		// Keep the result of the first failing async, the nursery is emptied in any case.
+		auto scope = bzd::ScopeGuard{[this]() { asyncs_.clear(); }};
+		for (auto& async : asyncs_)
+		{
+			if (async.result().hasError())
+			{
+				co_return bzd::move(async.moveResultOut()).propagate();
+			}
+		}
+		co_return {};
+	}
+
+	/// Number of asyncs owned by this nursery.
+	[[nodiscard]] constexpr Size size() const noexcept { return asyncs_.size(); }
+
+private:
+	constexpr Bool schedule(bzd::async::impl::PromiseBase& caller, bzd::Async<>&& async) noexcept
+	{
+		if (asyncs_.full())
+		{
+			return false;
+		}
+		asyncs_.emplaceBack(bzd::move(async));
+		auto& executable = asyncs_[asyncs_.size() - 1u].getExecutable();
+
+		auto metadata = caller.getMetadata();
+		metadata.anyCore();
+		if (auto maybeToken = caller.getCancellationToken(); maybeToken.hasValue())
+		{
+			executable.setCancellationToken(maybeToken.valueMutable());
+		}
+		executable.setConditionalContinuation(
+			bzd::async::impl::PromiseBase::OnTerminateCallback::toMember<Self, &Self::onTerminateCallback>(*this));
+		++pending_;
+		caller.getExecutor().schedule(executable, metadata);
+		return true;
+	}
+
+	constexpr bzd::Optional<bzd::async::impl::PromiseBase&> onTerminateCallback() noexcept
+	{
+		// The nursery holds a reference until join() is called, so this can only reach zero
+		// once the caller is waiting.
+		if (--pending_ == 0u)
+		{
+			return continuation_;
+		}
+		return bzd::nullopt;
+	}
+
+private:
+	bzd::Vector<bzd::Async<>, capacity> asyncs_{};
+	bzd::Atomic<Size> pending_{1u};
+	bzd::Optional<bzd::async::impl::PromiseBase&> continuation_{};
+};
+
+} // namespace bzd::async
@@ -0,0 +1,203 @@
+#pragma once
+
+#include "cc/bzd/algorithm/sort.hh"
+#include "cc/bzd/container/optional.hh"
+#include "cc/bzd/container/vector.hh"
+#include "cc/bzd/core/async.hh"
+#include "cc/bzd/type_traits/range.hh"
+#include "cc/bzd/utility/scope_guard.hh"
+
+namespace bzd::async::impl {
+
+/// Split a range of `size` elements into at most `maxChunks` chunks of similar size.
+template <Size maxChunks>
+class Chunks
+{
+public:
+	constexpr explicit Chunks(const Size size) noexcept : size_{size}, count_{(size < maxChunks) ? size : maxChunks} {}
+
+	/// Number of chunks.
+	[[nodiscard]] constexpr Size size() const noexcept { return count_; }
+	/// Index of the first element of the chunk.
+	[[nodiscard]] constexpr Size first(const Size index) const noexcept { return (index * size_) / count_; }
+	/// Index of the element after the last of the chunk.
+	[[nodiscard]] constexpr Size last(const Size index) const noexcept { return ((index + 1u) * size_) / count_; }
+
+private:
+	Size size_;
+	Size count_;
+};
+
+/// Run all the chunks in parallel and release them.
+template <Size maxChunks>
+bzd::Async<> spawnChunks(bzd::Vector<bzd::Async<>, maxChunks>& asyncs) noexcept
+{
+	auto scope = bzd::ScopeGuard{[&asyncs]() { asyncs.clear(); }};
+	co_await !bzd::async::spawnParallel(asyncs.asSpan());
+	co_return {};
+}
+
+template <class Iterator, class Callable>
+bzd::Async<> forEachChunk(Iterator first, const Iterator last, Callable& callable) noexcept
+{
+	for (; first != last; ++first)
+	{
+		callable(*first);
+	}
+	co_return {};
+}
+
+template <class InputIterator, class OutputIterator, class Callable>
+bzd::Async<> transformChunk(InputIterator first, const InputIterator last, OutputIterator output, Callable& callable) noexcept
+{
+	for (; first != last; ++first, ++output)
+	{
+		*output = callable(*first);
+	}
+	co_return {};
+}
+
+template <class T, class Iterator, class Operation>
+bzd::Async<> reduceChunk(Iterator first, const Iterator last, bzd::Optional<T>& result, Operation& operation) noexcept
+{
+	T accumulator = *first;
+	for (++first; first != last; ++first)
+	{
+		accumulator = operation(accumulator, *first);
+	}
+	result.emplace(bzd::move(accumulator));
+	co_return {};
+}
+
+/// Ranges smaller than this are not worth being split further by parallelSort.
+inline constexpr Size parallelSortThreshold{4096u};
+
+template <class Iterator, class Compare>
+bzd::Async<> sortChunk(const Iterator first, const Iterator last, Compare& comparison, const Size depth) noexcept
+{
+	if (depth == 0u || static_cast<Size>(last - first) < parallelSortThreshold)
+	{
+		bzd::algorithm::sort(first, last, comparison);
+		co_return {};
+	}
+
+	// Partition sequentially, then sort both sides concurrently.
+	bzd::algorithm::impl::selectPivot(first, last, comparison);
+	const auto [pivot, alreadyPartitioned] = bzd::algorithm::impl::partition(first, last, comparison);
+	bzd::Vector<bzd::Async<>, 2u> asyncs;
+	asyncs.emplaceBack(sortChunk(first, pivot, comparison, depth - 1u));
+	asyncs.emplaceBack(sortChunk(pivot + 1, last, comparison, depth - 1u));
+	co_await !spawnChunks(asyncs);
+	co_return {};
+}
+
+} // namespace bzd::async::impl
+
+namespace bzd::async {
+
+/// Apply a callable to every element of a range, in parallel.
+///
+/// The range is split into at most `maxChunks` chunks, each running as a separate async on any core
+/// of the executor. The caller is resumed once all chunks are completed.
+///
+/// \tparam maxChunks The maximum number of chunks, ideally the number of cores of the executor.
+/// \param range The range of elements to process.
+/// \param callable The callable to apply, it is shared between all chunks and must therefore be thread-safe.
+template <Size maxChunks = 8u, concepts::randomAccessRange Range, class Callable>
+bzd::Async<> parallelForEach(Range&& range, Callable callable) noexcept
+{
+	const auto first = bzd::begin(range);
+	const impl::Chunks<maxChunks> chunks{static_cast<Size>(bzd::size(range))};
+
+	bzd::Vector<bzd::Async<>, maxChunks> asyncs;
+	for (Size index = 0u; index < chunks.size(); ++index)
+	{
+		asyncs.emplaceBack(impl::forEachChunk(first + chunks.first(index), first + chunks.last(index), callable));
+	}
+	co_await !impl::spawnChunks(asyncs);
+	co_return {};
+}
+
+/// Apply a callable to every element of a range and store the results into another range, in parallel.
+///
+/// \tparam maxChunks The maximum number of chunks, ideally the number of cores of the executor.
+/// \param input The range of elements to process.
+/// \param output The range where to store the results, it must be at least as large as the input.
+/// \param callable The callable to apply, it is shared between all chunks and must therefore be thread-safe.
+template <Size maxChunks = 8u, concepts::randomAccessRange InputRange, concepts::randomAccessRange OutputRange, class Callable>
+bzd::Async<> parallelTransform(InputRange&& input, OutputRange&& output, Callable callable) noexcept
+{
+	bzd::assert::isTrue(bzd::size(output) >= bzd::size(input));
+
+	const auto first = bzd::begin(input);
+	const auto result = bzd::begin(output);
+	const impl::Chunks<maxChunks> chunks{static_cast<Size>(bzd::size(input))};
+
+	bzd::Vector<bzd::Async<>, maxChunks> asyncs;
+	for (Size index = 0u; index < chunks.size(); ++index)
+	{
+		asyncs.emplaceBack(
+			impl::transformChunk(first + chunks.first(index), first + chunks.last(index), result + chunks.first(index), callable));
+	}
+	co_await !impl::spawnChunks(asyncs);
+	co_return {};
+}
+
+/// Reduce a range of elements with a binary operation, in parallel.
+///
+/// Each chunk is reduced independently, then the partial results are reduced in order, therefore
+/// the operation must be associative but does not need to be commutative.
+///
+/// \tparam maxChunks The maximum number of chunks, ideally the number of cores of the executor.
+/// \param range The range of elements to process.
+/// \param init The initial value of the reduction.
+/// \param operation The binary operation, it is shared between all chunks and must therefore be thread-safe.
+/// \return The reduction of all elements.
+template <Size maxChunks = 8u, concepts::randomAccessRange Range, class T, class Operation>
+bzd::Async<T> parallelReduce(Range&& range, T init, Operation operation) noexcept
+{
+	const auto first = bzd::begin(range);
+	const impl::Chunks<maxChunks> chunks{static_cast<Size>(bzd::size(range))};
+
+	bzd::Vector<bzd::Optional<T>, maxChunks> results;
+	results.resize(chunks.size());
+	bzd::Vector<bzd::Async<>, maxChunks> asyncs;
+	for (Size index = 0u; index < chunks.size(); ++index)
+	{
+		asyncs.emplaceBack(impl::reduceChunk(first + chunks.first(index), first + chunks.last(index), results[index], operation));
+	}
+	co_await !impl::spawnChunks(asyncs);
+
+	for (auto& result : results)
+	{
+		init = operation(init, result.value());
+	}
+	results.clear();
+	co_return init;
+}
+
+/// Sort a range of elements, in parallel.
+///
+/// The range is recursively partitioned around a pivot and both sides are sorted concurrently, until
+/// there are `maxChunks` chunks or the chunks are too small to benefit from it. Each chunk is then sorted
+/// with bzd::algorithm::sort. Like the latter, the order of equal elements is not preserved.
+///
+/// \tparam maxChunks The maximum number of chunks, ideally the number of cores of the executor.
+/// \param range The range of elements to be sorted.
+/// \param comparison Comparison function object which returns true if the first argument is ordered before the second,
+/// it is shared between all chunks and must therefore be thread-safe.
+template <Size maxChunks = 8u,
+		  concepts::randomAccessRange Range,
+		  class Compare = bzd::Less<typeTraits::RangeValue<Range>>>
+bzd::Async<> parallelSort(Range&& range, Compare comparison = Compare{}) noexcept
+{
+	Size depth{0u};
+	for (Size chunks = 1u; chunks < maxChunks; chunks *= 2u)
+	{
+		++depth;
+	}
+	co_await !impl::sortChunk(bzd::begin(range), bzd::begin(range) + bzd::size(range), comparison, depth);
+	co_return {};
+}
+
+} // namespace bzd::async
@@ -6,6 +6,7 @@
 #include "cc/bzd/core/async/cancellation.hh"
 #include "cc/bzd/core/async/coroutine.hh"
 #include "cc/bzd/core/async/executor.hh"
+#include "cc/bzd/core/async/frame_storage.hh"
 #include "cc/bzd/core/error.hh"
 #include "cc/bzd/type_traits/is_same_template.hh"
 #include "cc/bzd/utility/constexpr_for.hh"
@@ -34,6 +35,15 @@ public:
 		handle_.resume();
 	}
 
+	/// Identifier of this executable, unique while it is alive.
+	[[nodiscard]] const void* getId() const noexcept { return handle_.address(); }
+
+	/// Identifier of the coroutine function of this executable, shared by all its instances.
+	///
+	/// This is the address of the resume function, which both GCC and Clang store at the beginning of the
+	/// coroutine frame. It can be symbolized to get the name of the coroutine.
+	[[nodiscard]] const void* getTypeId() const noexcept { return *static_cast<const void* const*>(handle_.address()); }
+
 	/// Called by the scheduler when an executable is detected as being canceled.
 	constexpr void cancel(bzd::async::impl::ExecutorContext<PromiseBase>& context) noexcept
 	{
@@ -193,21 +203,10 @@ public:
 	constexpr void unhandled_exception() noexcept { bzd::assert::unreachable(); }
 
 public: // Memory allocation
-		/*
-			void* operator new(std::size_t size)
-			{
-				void* ptr = ::malloc(size);
-				::std::cout << "Allocating " << size << " " << ptr << ::std::endl;
-				if (!ptr) throw std::bad_alloc{};
-				return ptr;
-			}
-	
-			void operator delete(void* ptr, std::size_t size)
-			{
-				::std::cout << "Deallocating " << size << " " << ptr << ::std::endl;
-				::free(ptr);
-			}
-		*/
+	/// Frames are taken from the active frame arena if any, from the heap otherwise.
+	static void* operator new(const bzd::Size size) { return bzd::async::FrameArena::allocateFrame(size); }
+
+	static void operator delete(void* ptr, const bzd::Size size) noexcept { bzd::async::FrameArena::deallocateFrame(ptr, size); }
 };
 
 } // namespace bzd::async::impl
@@ -0,0 +1,46 @@
+#include "cc/bzd/core/async.hh"
+#include "cc/bzd/test/multithread.hh"
+
+namespace {
+
+constexpr bzd::Size yieldCount{100u};
+
+bzd::Async<> yielder() noexcept
+{
+	for (bzd::Size i = 0u; i < yieldCount; ++i)
+	{
+		co_await bzd::async::yield();
+	}
+	co_return {};
+}
+
+/// Every yield pushes the executable to the queue and pops it again, possibly from another core.
+bzd::Async<> pushPop(bzd::test::Benchmark& benchmark) noexcept
+{
+	benchmark.setItemsPerIteration(4u * yieldCount);
+	for (auto _ : benchmark)
+	{
+		[[maybe_unused]] const auto result = co_await bzd::async::allParallel(yielder(), yielder(), yielder(), yielder());
+	}
+	co_return {};
+}
+
+} // namespace
+
+BENCHMARK_ASYNC_MULTITHREAD(Executor, PushPop1Core, 1)
+{
+	co_await !pushPop(benchmark);
+	co_return {};
+}
+
+BENCHMARK_ASYNC_MULTITHREAD(Executor, PushPop2Cores, 2)
+{
+	co_await !pushPop(benchmark);
+	co_return {};
+}
+
+BENCHMARK_ASYNC_MULTITHREAD(Executor, PushPop4Cores, 4)
+{
+	co_await !pushPop(benchmark);
+	co_return {};
+}
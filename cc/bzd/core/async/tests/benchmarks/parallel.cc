@@ -0,0 +1,82 @@
+#include "cc/bzd/core/async/parallel.hh"
+
+#include "cc/bzd/container/array.hh"
+#include "cc/bzd/test/multithread.hh"
+
+namespace {
+
+bzd::Array<bzd::UInt64, 4096u> input{};
+bzd::Array<bzd::UInt64, 4096u> output{};
+
+/// CPU-bound kernel, a few rounds of a 64-bit mix function.
+constexpr bzd::UInt64 kernel(bzd::UInt64 value) noexcept
+{
+	for (bzd::Size round = 0u; round < 64u; ++round)
+	{
+		value ^= value >> 33u;
+		value *= 0xff51afd7ed558ccdull;
+		value ^= value >> 33u;
+	}
+	return value;
+}
+
+bzd::Async<> forEach(bzd::test::Benchmark& benchmark) noexcept
+{
+	benchmark.setItemsPerIteration(input.size());
+	for (auto _ : benchmark)
+	{
+		co_await !bzd::async::parallelForEach(input, [](bzd::UInt64& value) { value = kernel(value); });
+	}
+	bzd::test::doNotOptimize(input);
+	co_return {};
+}
+
+bzd::Async<> transform(bzd::test::Benchmark& benchmark) noexcept
+{
+	benchmark.setItemsPerIteration(input.size());
+	for (auto _ : benchmark)
+	{
+		co_await !bzd::async::parallelTransform(input, output, [](const bzd::UInt64 value) { return kernel(value); });
+	}
+	bzd::test::doNotOptimize(output);
+	co_return {};
+}
+
+} // namespace
+
+// Scaling with the number of cores, the work is split in 8 chunks whatever the number of cores.
+BENCHMARK_ASYNC_MULTITHREAD(Parallel, ForEach1Core, 1)
+{
+	co_await !forEach(benchmark);
+	co_return {};
+}
+
+BENCHMARK_ASYNC_MULTITHREAD(Parallel, ForEach2Cores, 2)
+{
+	co_await !forEach(benchmark);
+	co_return {};
+}
+
+BENCHMARK_ASYNC_MULTITHREAD(Parallel, ForEach4Cores, 4)
+{
+	co_await !forEach(benchmark);
+	co_return {};
+}
+
+BENCHMARK_ASYNC_MULTITHREAD(Parallel, Transform1Core, 1)
+{
+	co_await !transform(benchmark);
+	co_return {};
+}
+
+BENCHMARK_ASYNC_MULTITHREAD(Parallel, Transform2Cores, 2)
+{
+	co_await !transform(benchmark);
+	co_return {};
+}
+
+BENCHMARK_ASYNC_MULTITHREAD(Parallel, Transform4Cores, 4)
+{
+	co_await !transform(benchmark);
+	co_return {};
+}
@@ -0,0 +1,85 @@
+#include "cc/bzd/core/async/frame_storage.hh"
+
+#include "cc/bzd/core/async.hh"
+#include "cc/bzd/test/test.hh"
+
+namespace {
+
+bzd::Async<int> answer(int value)
+{
+	co_return value * 2;
+}
+
+bzd::Async<int> entry(int value)
+{
+	const auto result = co_await !answer(value);
+	co_return result + 1;
+}
+
+} // namespace
+
+TEST(FrameStorage, Allocate)
+{
+	static bzd::async::FrameStorage<256u> storage{};
+	EXPECT_EQ(storage.capacity(), 256u);
+	EXPECT_EQ(storage.size(), 0u);
+
+	auto* first = storage.allocate(10u);
+	EXPECT_TRUE(first);
+	EXPECT_TRUE(storage.owns(first));
+	auto* second = storage.allocate(10u);
+	EXPECT_TRUE(second);
+	EXPECT_EQ(reinterpret_cast<bzd::IntPointer>(second) % bzd::async::FrameArena::alignment, 0u);
+	EXPECT_EQ(storage.size(), bzd::async::FrameArena::alignment + 10u);
+	EXPECT_FALSE(storage.isExhausted());
+
+	// Exhausted.
+	EXPECT_FALSE(storage.allocate(256u));
+	EXPECT_TRUE(storage.isExhausted());
+	EXPECT_EQ(storage.getRequired(), 2u * bzd::async::FrameArena::alignment + 256u);
+
+	int notOwned{0};
+	EXPECT_FALSE(storage.owns(&notOwned));
+}
+
+TEST(FrameStorage, Coroutine)
+{
+	static bzd::async::FrameStorage<1024u> storage{};
+
+	auto wrapper = [](auto async) -> bzd::Async<int> {
+		const auto result = co_await !async;
+		co_return result;
+	};
+
+	auto promise = [&]() {
+		const bzd::async::FrameArena::Scope scope{storage};
+		return wrapper(entry(20));
+	}();
+	// Both the wrapper and the entry point frames are in the storage.
+	const auto used = storage.size();
+	EXPECT_GT(used, 0u);
+	EXPECT_FALSE(storage.isExhausted());
+
+	// Nested coroutines created while running are outside of the scope.
+	const auto result = bzd::move(promise).sync();
+	EXPECT_TRUE(result);
+	EXPECT_EQ(result.value(), 41);
+	EXPECT_EQ(storage.size(), used);
+}
+
+TEST(FrameStorage, Fallback)
+{
+	static bzd::async::FrameStorage<16u> storage{};
+
+	auto promise = [&]() {
+		const bzd::async::FrameArena::Scope scope{storage};
+		return entry(1);
+	}();
+	EXPECT_EQ(storage.size(), 0u);
+	EXPECT_TRUE(storage.isExhausted());
+	EXPECT_GT(storage.getRequired(), 16u);
+
+	const auto result = bzd::move(promise).sync();
+	EXPECT_TRUE(result);
+	EXPECT_EQ(result.value(), 3);
+}
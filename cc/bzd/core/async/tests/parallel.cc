@@ -0,0 +1,66 @@
+#include "cc/bzd/core/async/parallel.hh"
+
+#include "cc/bzd/container/array.hh"
+#include "cc/bzd/core/async/nursery.hh"
+#include "cc/bzd/test/multithread.hh"
+
+namespace {
+bzd::Array<bzd::UInt64, 10000u> values{};
+}
+
+TEST_ASYNC_MULTITHREAD(Parallel, Reduce, 4)
+{
+	for (bzd::Size i = 0u; i < values.size(); ++i)
+	{
+		values[i] = i;
+	}
+	for (bzd::Size iteration = 0u; iteration < 100u; ++iteration)
+	{
+		co_await !bzd::async::parallelForEach(values, [](bzd::UInt64& value) { value += 1u; });
+		const auto sum = co_await !bzd::async::parallelReduce(values, bzd::UInt64{0u}, [](const auto a, const auto b) { return a + b; });
+		EXPECT_EQ(sum, (values.size() * (values.size() - 1u)) / 2u + values.size() * (iteration + 1u));
+	}
+	co_return {};
+}
+
+TEST_ASYNC_MULTITHREAD(Parallel, Sort, 4)
+{
+	for (bzd::Size iteration = 0u; iteration < 10u; ++iteration)
+	{
+		for (bzd::Size i = 0u; i < values.size(); ++i)
+		{
+			values[i] = (i * 7919u + iteration) % 10007u;
+		}
+		co_await !bzd::async::parallelSort<4u>(values);
+		for (bzd::Size i = 1u; i < values.size(); ++i)
+		{
+			EXPECT_LE(values[i - 1u], values[i]);
+		}
+	}
+	co_return {};
+}
+
+TEST_ASYNC_MULTITHREAD(Parallel, Nursery, 4)
+{
+	bzd::Atomic<bzd::Size> counter{0u};
+	auto worker = [&]() -> bzd::Async<> {
+		for (bzd::Size i = 0u; i < 100u; ++i)
+		{
+			++counter;
+			co_await bzd::async::yield();
+		}
+		co_return {};
+	};
+
+	for (bzd::Size iteration = 0u; iteration < 100u; ++iteration)
+	{
+		bzd::async::Nursery<8u> nursery;
+		for (bzd::Size i = 0u; i < 8u; ++i)
+		{
+			co_await !nursery.spawn(worker());
+		}
+		co_await !nursery.join();
+		EXPECT_EQ(counter.load(), (iteration + 1u) * 800u);
+	}
+	co_return {};
+}
@@ -0,0 +1,122 @@
+#include "cc/bzd/container/array.hh"
+#include "cc/bzd/container/string.hh"
+#include "cc/bzd/container/vector.hh"
+#include "cc/bzd/core/async.hh"
+#include "cc/bzd/core/async/nursery.hh"
+#include "cc/bzd/core/async/parallel.hh"
+#include "cc/bzd/test/test.hh"
+
+namespace {
+bzd::Async<int> task(bzd::interface::String& trace, const char id, const int value)
+{
+	trace += id;
+	co_await bzd::async::yield();
+	trace += id;
+	co_return value;
+}
+
+bzd::Async<> failingTask()
+{
+	co_await bzd::async::yield();
+	co_return bzd::error::Failure("Failing task."_csv);
+}
+} // namespace
+
+TEST_ASYNC(Spawn, Runtime)
+{
+	bzd::String<32> trace;
+	bzd::Vector<bzd::Async<int>, 4u> asyncs;
+	asyncs.emplaceBack(task(trace, 'a', 1));
+	asyncs.emplaceBack(task(trace, 'b', 2));
+	asyncs.emplaceBack(task(trace, 'c', 3));
+
+	co_await !bzd::async::spawn(asyncs.asSpan());
+	EXPECT_EQ(trace, "abcabc");
+	EXPECT_EQ(asyncs[0].moveResultOut().value(), 1);
+	EXPECT_EQ(asyncs[1].moveResultOut().value(), 2);
+	EXPECT_EQ(asyncs[2].moveResultOut().value(), 3);
+	asyncs.clear();
+
+	// Nothing to spawn.
+	co_await !bzd::async::spawn(asyncs.asSpan());
+
+	co_return {};
+}
+
+TEST_ASYNC(Spawn, Nursery)
+{
+	bzd::String<32> trace;
+	bzd::async::Nursery<2u> nursery;
+
+	auto worker = [&](const char id) -> bzd::Async<> {
+		co_await !task(trace, id, 0);
+		co_return {};
+	};
+
+	co_await !nursery.spawn(worker('a'));
+	co_await !nursery.spawn(worker('b'));
+	EXPECT_EQ(nursery.size(), 2u);
+	{
+		const auto result = co_await nursery.spawn(worker('c'));
+		EXPECT_FALSE(result);
+	}
+	trace += '-';
+	co_await !nursery.join();
+	EXPECT_EQ(trace, "-abab");
+	EXPECT_EQ(nursery.size(), 0u);
+
+	// Reuse the nursery and propagate errors.
+	co_await !nursery.spawn(failingTask());
+	const auto result = co_await nursery.join();
+	EXPECT_FALSE(result);
+
+	co_return {};
+}
+
+TEST_ASYNC(Spawn, Parallel)
+{
+	bzd::Array<int, 100u> values;
+	for (bzd::Size i = 0u; i < values.size(); ++i)
+	{
+		values[i] = static_cast<int>(i);
+	}
+
+	co_await !bzd::async::parallelForEach(values, [](int& value) { value *= 2; });
+	EXPECT_EQ(values[0], 0);
+	EXPECT_EQ(values[99], 198);
+
+	bzd::Array<int, 100u> squares;
+	co_await !bzd::async::parallelTransform<3u>(values, squares, [](const int value) { return value * value; });
+	EXPECT_EQ(squares[1], 4);
+	EXPECT_EQ(squares[50], 10000);
+
+	const auto sum = co_await !bzd::async::parallelReduce(values, 0, [](const int a, const int b) { return a + b; });
+	EXPECT_EQ(sum, 9900);
+
+	// Less elements than chunks.
+	bzd::Array<int, 2u> few{bzd::inPlace, 1, 2};
+	const auto product = co_await !bzd::async::parallelReduce(few, 10, [](const int a, const int b) { return a * b; });
+	EXPECT_EQ(product, 20);
+
+	co_return {};
+}
+
+TEST_ASYNC(Spawn, ParallelSort)
+{
+	bzd::Array<bzd::UInt32, 20000u> values;
+	test.fillRandom(values);
+
+	co_await !bzd::async::parallelSort<4u>(values);
+	for (bzd::Size i = 1u; i < values.size(); ++i)
+	{
+		EXPECT_LE(values[i - 1u], values[i]);
+	}
+
+	co_await !bzd::async::parallelSort(values, [](const auto a, const auto b) { return a > b; });
+	for (bzd::Size i = 1u; i < values.size(); ++i)
+	{
+		EXPECT_GE(values[i - 1u], values[i]);
+	}
+
+	co_return {};
+}
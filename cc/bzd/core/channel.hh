@@ -36,19 +36,34 @@ public:
 	/// \param[in] data The data to be sent via this output channel.
 	virtual bzd::Async<> write(const bzd::Span<ValueConstType> data) noexcept = 0;
 
+	/// Write multiple segments of data to an output channel.
+	/// The promise resolves only after all the segments are transmitted, in order.
+	///
+	/// The default implementation sends segment by segment, implementations supporting
+	/// scatter-gather I/O should override it to transmit all segments in a single operation.
+	///
+	/// \param[in] segments The data segments to be sent via this output channel.
+	virtual bzd::Async<> writeVectored(const bzd::Span<const bzd::Span<ValueConstType>> segments) noexcept
+	{
+		for (const auto& span : segments)
+		{
+			if (!span.empty())
+			{
+				co_await !write(span);
+			}
+		}
+		co_return {};
+	}
+
 	/// Write data to an output channel.
 	/// The data represented by a spans is a collection of contiguous segments,
-	/// this function uses this attribute to send segment by segment.
+	/// this function uses this attribute to send all segments at once.
 	///
 	/// \param[in] data The data to be sent via this output channel.
 	template <Size count>
 	bzd::Async<> write(const bzd::Spans<ValueConstType, count> data) noexcept
 	{
-		for (const auto& span : data.spans())
-		{
-			co_await !write(span);
-		}
-		co_return {};
+		co_return co_await writeVectored(data.spans().asSpan());
 	}
 
 	/// Get a scope lock guard for writing to this channel.
@@ -0,0 +1,9 @@
+#pragma once
+
+#include "cc/bzd/core/serialization/types/compact.hh"
+#include "cc/bzd/core/serialization/types/enum.hh"
+#include "cc/bzd/core/serialization/types/floating_point.hh"
+#include "cc/bzd/core/serialization/types/integral.hh"
+#include "cc/bzd/core/serialization/types/optional.hh"
+#include "cc/bzd/core/serialization/types/range.hh"
+#include "cc/bzd/core/serialization/types/structure.hh"
@@ -0,0 +1,102 @@
+#include "cc/bzd/container/vector.hh"
+#include "cc/bzd/core/serialization/serialization.hh"
+#include "cc/bzd/test/test.hh"
+
+namespace {
+
+constexpr bzd::Size size{1024u};
+
+auto& makeSamples(auto& test) noexcept
+{
+	static bzd::Vector<bzd::UInt32, size> samples;
+	samples.clear();
+	for (bzd::Size i = 0u; i < size; ++i)
+	{
+		samples.pushBack(test.template random<bzd::UInt32>());
+	}
+	return samples;
+}
+
+} // namespace
+
+// Outside of the anonymous namespace to keep the benchmark names short.
+
+/// Fixed size encoding, copied in bulk.
+struct Fixed
+{
+	static auto serialize(auto& output, const auto& value) { return bzd::serialize(output, value); }
+	static auto deserialize(const auto& input, auto& value) { return bzd::deserialize(input, value); }
+};
+
+/// Variable length encoding, element by element.
+struct Compact
+{
+	static auto serialize(auto& output, const auto& value) { return bzd::serializeCompact(output, value); }
+	static auto deserialize(const auto& input, auto& value) { return bzd::deserializeCompact(input, value); }
+};
+
+/// Fixed size encoding, element by element, with the same layout as the bulk copy.
+struct PerElement
+{
+	static bzd::Optional<bzd::Size> serialize(auto& output, const auto& value)
+	{
+		const auto span = output.asSpan();
+		auto offset = bzd::serialize(span, static_cast<bzd::UInt32>(value.size()));
+		for (const auto element : value)
+		{
+			if (!offset)
+			{
+				break;
+			}
+			const auto size = bzd::serialize(span.subSpan(offset.value()), element);
+			offset = (size) ? bzd::Optional<bzd::Size>{offset.value() + size.value()} : bzd::nullopt;
+		}
+		return offset;
+	}
+	static bzd::Optional<bzd::Size> deserialize(const auto& input, auto& value)
+	{
+		const auto span = input.asSpan();
+		bzd::UInt32 count{0u};
+		auto offset = bzd::deserialize(span, count);
+		value.resize(count);
+		for (auto& element : value)
+		{
+			if (!offset)
+			{
+				break;
+			}
+			const auto size = bzd::deserialize(span.subSpan(offset.value()), element);
+			offset = (size) ? bzd::Optional<bzd::Size>{offset.value() + size.value()} : bzd::nullopt;
+		}
+		return offset;
+	}
+};
+
+BENCHMARK(Serialization, Encode, (Fixed, PerElement, Compact))
+{
+	const auto& samples = makeSamples(test);
+	static bzd::Vector<bzd::Byte, 8u * size> buffer;
+	buffer.resize(buffer.capacity());
+
+	benchmark.setItemsPerIteration(size);
+	for (auto _ : benchmark)
+	{
+		bzd::test::doNotOptimize(TestType::serialize(buffer, samples));
+	}
+}
+
+BENCHMARK(Serialization, Decode, (Fixed, PerElement, Compact))
+{
+	const auto& samples = makeSamples(test);
+	static bzd::Vector<bzd::Byte, 8u * size> buffer;
+	buffer.resize(buffer.capacity());
+	const auto encoded = TestType::serialize(buffer, samples);
+	ASSERT_TRUE(encoded);
+	static bzd::Vector<bzd::UInt32, size> decoded;
+
+	benchmark.setItemsPerIteration(size);
+	for (auto _ : benchmark)
+	{
+		bzd::test::doNotOptimize(TestType::deserialize(buffer, decoded));
+	}
+}
@@ -0,0 +1,117 @@
+#include "cc/bzd/container/array.hh"
+#include "cc/bzd/container/string.hh"
+#include "cc/bzd/container/vector.hh"
+#include "cc/bzd/core/serialization/serialization.hh"
+#include "cc/bzd/test/test.hh"
+
+TEST(Bulk, Vector)
+{
+	bzd::Vector<bzd::UInt32, 1000u> samples;
+	for (bzd::UInt32 i = 0u; i < 1000u; ++i)
+	{
+		samples.pushBack(i * 0x01010101u);
+	}
+
+	bzd::Vector<bzd::Byte, 5000u> buffer;
+	buffer.resize(buffer.capacity());
+	const auto size = bzd::serialize(buffer, samples);
+	ASSERT_TRUE(size);
+	EXPECT_EQ(size.value(), 4u + 4000u);
+	// Little endian.
+	EXPECT_EQ(buffer[8u], bzd::Byte{0x01});
+	EXPECT_EQ(buffer[12u], bzd::Byte{0x02});
+
+	bzd::Vector<bzd::UInt32, 1000u> decoded;
+	EXPECT_EQ(bzd::deserialize(buffer, decoded), size);
+	EXPECT_EQ(decoded.size(), 1000u);
+	EXPECT_EQ(decoded[999u], 999u * 0x01010101u);
+
+	// Not enough space.
+	EXPECT_FALSE(bzd::serialize(bzd::Span<bzd::Byte>{buffer.data(), 4003u}, samples));
+}
+
+TEST(Bulk, Array)
+{
+	const bzd::Array<bzd::Int16, 3u> array{
+		bzd::inPlace, static_cast<bzd::Int16>(-1), static_cast<bzd::Int16>(2), static_cast<bzd::Int16>(0x0304)};
+	bzd::String<16u> string;
+	EXPECT_EQ(bzd::serialize(string.appender(), array).value(), 6u);
+	EXPECT_EQ(string[4u], '\x04');
+	EXPECT_EQ(string[5u], '\x03');
+
+	bzd::Array<bzd::Int16, 3u> decoded{};
+	EXPECT_EQ(bzd::deserialize(string, decoded).value(), 6u);
+	EXPECT_EQ(decoded[0u], -1);
+	EXPECT_EQ(decoded[2u], 0x0304);
+
+	// Compact encoding applies to the elements.
+	string.clear();
+	EXPECT_EQ(bzd::serializeCompact(string.appender(), array).value(), 4u);
+	EXPECT_EQ(bzd::deserializeCompact(string, decoded).value(), 4u);
+	EXPECT_EQ(decoded[2u], 0x0304);
+}
+
+TEST(Bulk, Swapped)
+{
+	// Exercise the big endian path on any platform, on a little endian one it produces big endian data.
+	const bzd::UInt32 values[] = {0x01020304u, 0x05060708u, 0xa0b0c0d0u};
+	bzd::Array<bzd::Byte, 12u> buffer{};
+	const auto result =
+		bzd::impl::serialization::copyElementsSwapped(bzd::Span<const bzd::UInt32>{values, 3u}, bzd::Span<bzd::Byte>{buffer.data(), 12u});
+	EXPECT_EQ(result.value(), 12u);
+	EXPECT_EQ(buffer[0u], bzd::Byte{0x01});
+	EXPECT_EQ(buffer[3u], bzd::Byte{0x04});
+	EXPECT_EQ(buffer[4u], bzd::Byte{0x05});
+
+	bzd::UInt32 decoded[3u]{};
+	EXPECT_EQ(bzd::impl::serialization::copyElementsSwappedFrom(bzd::Span<const bzd::Byte>{buffer.data(), 12u},
+																 bzd::Span<bzd::UInt32>{decoded, 3u}),
+			  12u);
+	EXPECT_EQ(decoded[0u], 0x01020304u);
+	EXPECT_EQ(decoded[2u], 0xa0b0c0d0u);
+
+	// Across several chunks.
+	bzd::Vector<bzd::Float64, 100u> doubles;
+	for (bzd::Size i = 0u; i < 100u; ++i)
+	{
+		doubles.pushBack(static_cast<bzd::Float64>(i) / 3.);
+	}
+	bzd::Vector<bzd::Byte, 800u> bytes;
+	bytes.resize(800u);
+	EXPECT_EQ(bzd::impl::serialization::copyElementsSwapped(bzd::Span<const bzd::Float64>{doubles.data(), 100u}, bytes.asSpan()), 800u);
+	bzd::Vector<bzd::Float64, 100u> decodedDoubles;
+	decodedDoubles.resize(100u);
+	EXPECT_EQ(bzd::impl::serialization::copyElementsSwappedFrom(bytes.asSpan(), decodedDoubles.asSpan()), 800u);
+	EXPECT_EQ(decodedDoubles[99u], 33.);
+}
+
+TEST(Bulk, PackedBoolean)
+{
+	bzd::Vector<bool, 16u> flags;
+	for (bzd::Size i = 0u; i < 11u; ++i)
+	{
+		flags.pushBack(i % 3u == 0u);
+	}
+
+	bzd::String<16u> string;
+	EXPECT_EQ(bzd::serialize(string.appender(), flags).value(), 4u + 2u);
+	EXPECT_EQ(string[4u], '\x49');
+	EXPECT_EQ(string[5u], '\x02');
+
+	bzd::Vector<bool, 16u> decoded;
+	EXPECT_EQ(bzd::deserialize(string, decoded).value(), 6u);
+	EXPECT_EQ(decoded.size(), 11u);
+	for (bzd::Size i = 0u; i < 11u; ++i)
+	{
+		EXPECT_EQ(decoded[i], i % 3u == 0u);
+	}
+
+	// Unused bits must be cleared.
+	string[5u] = '\x0a';
+	EXPECT_FALSE(bzd::deserialize(string, decoded));
+
+	const bzd::Array<bool, 3u> array{bzd::inPlace, true, false, true};
+	string.clear();
+	EXPECT_EQ(bzd::serialize(string.appender(), array).value(), 1u);
+	EXPECT_EQ(string[0u], '\x05');
+}
@@ -0,0 +1,101 @@
+#include "cc/bzd/core/serialization/types/compact.hh"
+
+#include "cc/bzd/test/test.hh"
+
+TEST(Compact, Varint)
+{
+	bzd::String<20u> string;
+
+	{
+		const auto result = bzd::serializeCompact(string.appender(), bzd::UInt32{1u});
+		EXPECT_TRUE(result);
+		EXPECT_EQ(result.value(), 1u);
+		EXPECT_EQ(string[0u], '\x01');
+	}
+	{
+		const auto result = bzd::serializeCompact(string.appender(), bzd::UInt32{300u});
+		EXPECT_TRUE(result);
+		EXPECT_EQ(result.value(), 2u);
+		EXPECT_EQ(string[1u], '\xac');
+		EXPECT_EQ(string[2u], '\x02');
+	}
+	{
+		const auto result = bzd::serializeCompact(string.appender(), bzd::NumericLimits<bzd::UInt64>::max());
+		EXPECT_TRUE(result);
+		EXPECT_EQ(result.value(), 10u);
+		EXPECT_EQ(string.size(), 13u);
+	}
+
+	bzd::Span<const char> span{string.data(), string.size()};
+	{
+		bzd::UInt32 value{};
+		const auto result = bzd::deserializeCompact(span, value);
+		EXPECT_TRUE(result);
+		EXPECT_EQ(result.value(), 1u);
+		EXPECT_EQ(value, 1u);
+		span = span.subSpan(1u);
+	}
+	{
+		bzd::UInt16 value{};
+		const auto result = bzd::deserializeCompact(span, value);
+		EXPECT_TRUE(result);
+		EXPECT_EQ(result.value(), 2u);
+		EXPECT_EQ(value, 300u);
+		span = span.subSpan(2u);
+	}
+	{
+		bzd::UInt32 value{};
+		const auto result = bzd::deserializeCompact(span, value);
+		EXPECT_FALSE(result);
+	}
+	{
+		bzd::UInt64 value{};
+		const auto result = bzd::deserializeCompact(span, value);
+		EXPECT_TRUE(result);
+		EXPECT_EQ(result.value(), 10u);
+		EXPECT_EQ(value, bzd::NumericLimits<bzd::UInt64>::max());
+	}
+}
+
+TEST(Compact, Zigzag)
+{
+	bzd::String<40u> string;
+
+	for (const bzd::Int64 value : {0ll, -1ll, 1ll, -64ll, 64ll, -2147483648ll, 9223372036854775807ll})
+	{
+		string.clear();
+		const auto result = bzd::serializeCompact(string.appender(), value);
+		EXPECT_TRUE(result);
+		bzd::Int64 decoded{};
+		EXPECT_EQ(bzd::deserializeCompact(string, decoded), result);
+		EXPECT_EQ(decoded, value);
+	}
+
+	string.clear();
+	EXPECT_EQ(bzd::serializeCompact(string.appender(), bzd::Int32{-1}).value(), 1u);
+	EXPECT_EQ(string[0u], '\x01');
+	string.clear();
+	EXPECT_EQ(bzd::serializeCompact(string.appender(), bzd::Int32{-65}).value(), 2u);
+
+	// Out of range for the destination type.
+	string.clear();
+	EXPECT_TRUE(bzd::serializeCompact(string.appender(), bzd::Int32{-70000}));
+	bzd::Int16 small{};
+	EXPECT_FALSE(bzd::deserializeCompact(string, small));
+}
+
+TEST(Compact, Malformed)
+{
+	// Truncated.
+	{
+		const char data[] = {'\x80', '\x80'};
+		bzd::UInt64 value{};
+		EXPECT_FALSE(bzd::deserializeCompact(bzd::Span<const char>{data, 2u}, value));
+	}
+	// Overlong.
+	{
+		const char data[] = {'\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\xff', '\x02'};
+		bzd::UInt64 value{};
+		EXPECT_FALSE(bzd::deserializeCompact(bzd::Span<const char>{data, 10u}, value));
+	}
+}
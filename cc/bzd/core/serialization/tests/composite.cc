@@ -0,0 +1,194 @@
+#include "cc/bzd/container/optional.hh"
+#include "cc/bzd/container/string.hh"
+#include "cc/bzd/container/string_view.hh"
+#include "cc/bzd/container/vector.hh"
+#include "cc/bzd/core/serialization/serialization.hh"
+#include "cc/bzd/test/test.hh"
+
+namespace {
+
+enum class Color : bzd::UInt16
+{
+	red = 1,
+	green = 2,
+	blue = 300
+};
+
+struct Point
+{
+	bzd::Int32 x;
+	bzd::Int32 y;
+	bzd::Float32 z;
+};
+
+struct Shape
+{
+	Color color;
+	bzd::Bool visible;
+	bzd::Vector<Point, 4u> points;
+	bzd::Optional<bzd::UInt64> id;
+	bzd::String<16u> name;
+};
+
+struct Message
+{
+	bzd::UInt8 type;
+	bzd::StringView text;
+};
+
+} // namespace
+
+template <>
+struct bzd::SerializationFields<Point>
+{
+	using Type = bzd::serialization::Fields<&Point::x, &Point::y, &Point::z>;
+};
+
+template <>
+struct bzd::SerializationFields<Shape>
+{
+	using Type = bzd::serialization::Fields<&Shape::color, &Shape::visible, &Shape::points, &Shape::id, &Shape::name>;
+};
+
+template <>
+struct bzd::SerializationFields<Message>
+{
+	using Type = bzd::serialization::Fields<&Message::type, &Message::text>;
+};
+
+TEST(Composite, Enum)
+{
+	bzd::String<8u> string;
+	EXPECT_EQ(bzd::serialize(string.appender(), Color::blue).value(), 2u);
+	EXPECT_EQ(string[0u], '\x2c');
+	EXPECT_EQ(string[1u], '\x01');
+
+	Color color{Color::red};
+	EXPECT_EQ(bzd::deserialize(string, color).value(), 2u);
+	EXPECT_EQ(color, Color::blue);
+}
+
+TEST(Composite, Optional)
+{
+	bzd::String<16u> string;
+	bzd::Optional<bzd::UInt32> value{};
+	EXPECT_EQ(bzd::serialize(string.appender(), value).value(), 1u);
+	value = 12u;
+	EXPECT_EQ(bzd::serialize(string.appender(), value).value(), 5u);
+	EXPECT_EQ(string.size(), 6u);
+
+	bzd::Span<const char> span{string.data(), string.size()};
+	bzd::Optional<bzd::UInt32> decoded{42u};
+	EXPECT_EQ(bzd::deserialize(span, decoded).value(), 1u);
+	EXPECT_FALSE(decoded);
+	EXPECT_EQ(bzd::deserialize(span.subSpan(1u), decoded).value(), 5u);
+	EXPECT_TRUE(decoded);
+	EXPECT_EQ(decoded.value(), 12u);
+}
+
+TEST(Composite, Range)
+{
+	bzd::String<32u> string;
+	bzd::Vector<bzd::UInt16, 4u> vector{bzd::inPlace, 1u, 2u, 3u};
+	EXPECT_EQ(bzd::serialize(string.appender(), vector).value(), 10u);
+	EXPECT_EQ(bzd::serialize(string.appender(), "hello"_sv).value(), 9u);
+
+	bzd::Span<const char> span{string.data(), string.size()};
+	bzd::Vector<bzd::UInt16, 4u> decodedVector;
+	EXPECT_EQ(bzd::deserialize(span, decodedVector).value(), 10u);
+	EXPECT_EQ(decodedVector.size(), 3u);
+	EXPECT_EQ(decodedVector[2u], 3u);
+
+	// Views point directly into the input buffer.
+	bzd::StringView view;
+	EXPECT_EQ(bzd::deserialize(span.subSpan(10u), view).value(), 9u);
+	EXPECT_EQ(view, "hello"_sv);
+	EXPECT_EQ(view.data(), string.data() + 14u);
+
+	// Capacity overflow.
+	bzd::Vector<bzd::UInt16, 2u> smallVector;
+	EXPECT_FALSE(bzd::deserialize(span, smallVector));
+	EXPECT_EQ(smallVector.size(), 0u);
+}
+
+TEST(Composite, FixedLayout)
+{
+	static_assert(bzd::impl::serialization::isFixedLayout<Point, bzd::impl::serialization::Fixed>);
+	static_assert(!bzd::impl::serialization::isFixedLayout<Point, bzd::impl::serialization::Compact>);
+	static_assert(!bzd::impl::serialization::isFixedLayout<Shape, bzd::impl::serialization::Fixed>);
+
+	bzd::String<32u> string;
+	const Point point{-1, 2, 3.5f};
+	EXPECT_EQ(bzd::serialize(string.appender(), point).value(), 12u);
+	EXPECT_EQ(string[0u], '\xff');
+	EXPECT_EQ(string[4u], '\x02');
+
+	Point decoded{};
+	EXPECT_EQ(bzd::deserialize(string, decoded).value(), 12u);
+	EXPECT_EQ(decoded.x, -1);
+	EXPECT_EQ(decoded.y, 2);
+	EXPECT_NEAR(decoded.z, 3.5f, 0.001f);
+
+	// Not enough data.
+	EXPECT_FALSE(bzd::deserialize(bzd::Span<const char>{string.data(), 11u}, decoded));
+
+	string.clear();
+	EXPECT_EQ(bzd::serializeCompact(string.appender(), point).value(), 6u);
+	EXPECT_EQ(bzd::deserializeCompact(string, decoded).value(), 6u);
+	EXPECT_EQ(decoded.x, -1);
+	EXPECT_EQ(decoded.y, 2);
+}
+
+TEST(Composite, Structure)
+{
+	Shape shape;
+	shape.color = Color::green;
+	shape.visible = true;
+	shape.points.pushBack(Point{1, 2, 0.f});
+	shape.points.pushBack(Point{-3, 4, 1.f});
+	shape.id = 1234u;
+	shape.name = "triangle"_sv;
+
+	bzd::String<128u> fixed;
+	const auto fixedSize = bzd::serialize(fixed.appender(), shape);
+	EXPECT_TRUE(fixedSize);
+	EXPECT_EQ(fixedSize.value(), 2u + 1u + 4u + 2u * 12u + 1u + 8u + 4u + 8u);
+
+	bzd::String<128u> compact;
+	const auto compactSize = bzd::serializeCompact(compact.appender(), shape);
+	EXPECT_TRUE(compactSize);
+	EXPECT_LT(compactSize.value(), fixedSize.value());
+
+	for (const auto isCompact : {false, true})
+	{
+		Shape decoded;
+		const auto result = (isCompact) ? bzd::deserializeCompact(compact, decoded) : bzd::deserialize(fixed, decoded);
+		EXPECT_TRUE(result);
+		EXPECT_EQ(result.value(), (isCompact) ? compactSize.value() : fixedSize.value());
+		EXPECT_EQ(decoded.color, Color::green);
+		EXPECT_TRUE(decoded.visible);
+		EXPECT_EQ(decoded.points.size(), 2u);
+		EXPECT_EQ(decoded.points[1u].x, -3);
+		EXPECT_EQ(decoded.points[1u].y, 4);
+		EXPECT_TRUE(decoded.id);
+		EXPECT_EQ(decoded.id.value(), 1234u);
+		EXPECT_STREQ(decoded.name.data(), "triangle");
+	}
+
+	// Truncated input.
+	Shape decoded;
+	EXPECT_FALSE(bzd::deserialize(bzd::Span<const char>{fixed.data(), fixedSize.value() - 1u}, decoded));
+}
+
+TEST(Composite, ZeroCopy)
+{
+	const Message message{3u, "payload"_sv};
+	bzd::String<32u> string;
+	EXPECT_EQ(bzd::serialize(string.appender(), message).value(), 12u);
+
+	Message decoded{};
+	EXPECT_EQ(bzd::deserialize(string, decoded).value(), 12u);
+	EXPECT_EQ(decoded.type, 3u);
+	EXPECT_EQ(decoded.text, "payload"_sv);
+	EXPECT_EQ(decoded.text.data(), string.data() + 5u);
+}
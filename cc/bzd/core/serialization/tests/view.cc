@@ -0,0 +1,211 @@
+#include "cc/bzd/core/serialization/view.hh"
+
+#include "cc/bzd/container/array.hh"
+#include "cc/bzd/container/optional.hh"
+#include "cc/bzd/container/string.hh"
+#include "cc/bzd/container/string_view.hh"
+#include "cc/bzd/container/vector.hh"
+#include "cc/bzd/test/test.hh"
+
+namespace {
+
+struct Header
+{
+	bzd::UInt16 destination;
+	bzd::UInt32 sequence;
+};
+
+struct Message
+{
+	Header header;
+	bzd::Bool urgent;
+	bzd::StringView topic;
+	bzd::Vector<bzd::Int16, 8u> samples;
+	bzd::Optional<bzd::UInt32> checksum;
+	bzd::Float32 ratio;
+};
+
+struct Envelope
+{
+	bzd::UInt8 kind;
+	Message message;
+};
+
+} // namespace
+
+template <>
+struct bzd::SerializationFields<Header>
+{
+	using Type = bzd::serialization::Fields<&Header::destination, &Header::sequence>;
+};
+
+template <>
+struct bzd::SerializationFields<Message>
+{
+	using Type = bzd::serialization::Fields<&Message::header,
+											&Message::urgent,
+											&Message::topic,
+											&Message::samples,
+											&Message::checksum,
+											&Message::ratio>;
+};
+
+template <>
+struct bzd::SerializationFields<Envelope>
+{
+	using Type = bzd::serialization::Fields<&Envelope::kind, &Envelope::message>;
+};
+
+namespace {
+
+template <bzd::Size capacity>
+bzd::Span<const bzd::Byte> makeMessage(bzd::String<capacity>& buffer)
+{
+	Message message;
+	message.header = Header{12u, 0x01020304u};
+	message.urgent = true;
+	message.topic = "sensor"_sv;
+	message.samples.pushBack(-1);
+	message.samples.pushBack(300);
+	message.samples.pushBack(7);
+	message.checksum = 42u;
+	message.ratio = 0.5f;
+	const auto result = bzd::serialize(buffer.appender(), message);
+	bzd::assert::isTrue(result.hasValue());
+	return buffer.asBytes();
+}
+
+} // namespace
+
+TEST(View, Read)
+{
+	bzd::String<128u> buffer;
+	const auto bytes = makeMessage(buffer);
+
+	const auto maybeView = bzd::serialization::View<Message>::make(bytes);
+	ASSERT_TRUE(maybeView);
+	const auto& view = maybeView.value();
+	EXPECT_EQ(view.size(), bytes.size());
+
+	// Fixed size structures are decoded.
+	const auto header = view.get<&Message::header>();
+	EXPECT_EQ(header.destination, 12u);
+	EXPECT_EQ(header.sequence, 0x01020304u);
+	EXPECT_EQ(view.field<&Message::header>().size(), 6u);
+
+	EXPECT_TRUE(view.get<&Message::urgent>());
+
+	// Byte views are zero-copy.
+	const auto topic = view.get<&Message::topic>();
+	EXPECT_EQ(topic, "sensor"_sv);
+	EXPECT_EQ(reinterpret_cast<const bzd::Byte*>(topic.data()), bytes.data() + 6u + 1u + 4u);
+
+	// Arrays are decoded on access.
+	const auto samples = view.get<&Message::samples>();
+	EXPECT_EQ(samples.size(), 3u);
+	EXPECT_EQ(samples[0u], -1);
+	EXPECT_EQ(samples[1u], 300);
+	EXPECT_EQ(samples[2u], 7);
+
+	const auto checksum = view.get<&Message::checksum>();
+	EXPECT_TRUE(checksum);
+	EXPECT_EQ(checksum.value(), 42u);
+	EXPECT_NEAR(view.get<&Message::ratio>(), 0.5f, 0.001f);
+}
+
+TEST(View, Nested)
+{
+	bzd::String<128u> buffer;
+	buffer.pushBack('\x05');
+	makeMessage(buffer);
+
+	const auto maybeView = bzd::serialization::View<Envelope>::make(buffer.asBytes());
+	ASSERT_TRUE(maybeView);
+	EXPECT_EQ(maybeView->get<&Envelope::kind>(), 5u);
+	const auto message = maybeView->get<&Envelope::message>();
+	EXPECT_EQ(message.get<&Message::header>().destination, 12u);
+	EXPECT_EQ(message.get<&Message::topic>(), "sensor"_sv);
+}
+
+TEST(View, Invalid)
+{
+	bzd::String<128u> buffer;
+	const auto bytes = makeMessage(buffer);
+
+	// Truncated at any position.
+	for (bzd::Size size = 0u; size < bytes.size(); ++size)
+	{
+		EXPECT_FALSE(bzd::serialization::View<Message>::make(bytes.first(size)));
+	}
+
+	// Invalid boolean.
+	buffer[6u] = '\x02';
+	EXPECT_FALSE(bzd::serialization::View<Message>::make(buffer.asBytes()));
+
+	// Trailing data is ignored.
+	buffer[6u] = '\x01';
+	buffer.pushBack('\x00');
+	const auto maybeView = bzd::serialization::View<Message>::make(buffer.asBytes());
+	ASSERT_TRUE(maybeView);
+	EXPECT_EQ(maybeView->size(), buffer.size() - 1u);
+}
+
+TEST(View, Patch)
+{
+	bzd::String<128u> buffer;
+	makeMessage(buffer);
+
+	auto maybeView = bzd::serialization::View<Message, bzd::Byte>::make(buffer.asBytesMutable());
+	ASSERT_TRUE(maybeView);
+	maybeView->set<&Message::header>(Header{99u, 1u});
+	maybeView->set<&Message::urgent>(false);
+	maybeView->set<&Message::ratio>(2.f);
+
+	Message message;
+	ASSERT_TRUE(bzd::deserialize(buffer, message));
+	EXPECT_EQ(message.header.destination, 99u);
+	EXPECT_EQ(message.header.sequence, 1u);
+	EXPECT_FALSE(message.urgent);
+	EXPECT_EQ(message.topic, "sensor"_sv);
+	EXPECT_EQ(message.samples.size(), 3u);
+	EXPECT_NEAR(message.ratio, 2.f, 0.001f);
+}
+
+namespace {
+struct Flags
+{
+	bzd::Vector<bool, 16u> flags;
+	bzd::Array<bzd::UInt16, 2u> pair;
+	bzd::UInt8 end;
+};
+} // namespace
+
+template <>
+struct bzd::SerializationFields<Flags>
+{
+	using Type = bzd::serialization::Fields<&Flags::flags, &Flags::pair, &Flags::end>;
+};
+
+TEST(View, Packed)
+{
+	Flags flags;
+	for (bzd::Size i = 0u; i < 10u; ++i)
+	{
+		flags.flags.pushBack(i % 2u);
+	}
+	flags.pair = bzd::Array<bzd::UInt16, 2u>{bzd::inPlace, static_cast<bzd::UInt16>(1u), static_cast<bzd::UInt16>(2u)};
+	flags.end = 7u;
+
+	bzd::String<32u> buffer;
+	EXPECT_EQ(bzd::serialize(buffer.appender(), flags).value(), 4u + 2u + 4u + 1u);
+
+	const auto maybeView = bzd::serialization::View<Flags>::make(buffer.asBytes());
+	ASSERT_TRUE(maybeView);
+	EXPECT_EQ(maybeView->get<&Flags::flags>().size(), 10u);
+	EXPECT_EQ(maybeView->get<&Flags::pair>()[1u], 2u);
+	EXPECT_EQ(maybeView->get<&Flags::end>(), 7u);
+
+	// Unused bits must be cleared.
+	buffer[5u] = '\x04';
+	EXPECT_FALSE(bzd::serialization::View<Flags>::make(buffer.asBytes()));
+}
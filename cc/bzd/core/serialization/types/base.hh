@@ -1,8 +1,12 @@
 #pragma once
 
 #include "cc/bzd/container/optional.hh"
+#include "cc/bzd/container/span.hh"
 #include "cc/bzd/meta/always_false.hh"
+#include "cc/bzd/type_traits/declval.hh"
+#include "cc/bzd/type_traits/is_floating_point.hh"
 #include "cc/bzd/type_traits/range.hh"
+#include "cc/bzd/type_traits/remove_reference.hh"
 #include "cc/bzd/utility/bit/endian.hh"
 #include "cc/bzd/utility/ignore.hh"
 #include "cc/bzd/utility/ranges/stream.hh"
@@ -25,6 +29,73 @@ inline constexpr auto normalizeByteOrder() noexcept
 	}
 }
 
+/// Consume a range sequentially, as elements are serialized or deserialized one after the other.
+///
+/// Contiguous ranges are sliced as they are consumed, which keeps them contiguous for the elements
+/// (for fast copies or zero-copy views), other ranges are wrapped into a stream.
+template <class Range>
+class Sequence
+{
+public:
+	constexpr explicit Sequence(Range& range) noexcept : stream_{bzd::inPlace, range} {}
+
+	/// Call a serialization function on the remaining part of the range.
+	///
+	/// \param callable A callable taking the range and returning the number of bytes processed or nullopt.
+	/// \return true in case of success, false otherwise.
+	template <class Callable>
+	[[nodiscard]] constexpr Bool operator()(Callable&& callable) noexcept
+	{
+		const auto maybeCount = callable(stream_);
+		if (!maybeCount)
+		{
+			return false;
+		}
+		count_ += maybeCount.value();
+		return true;
+	}
+
+	/// Number of bytes processed so far.
+	[[nodiscard]] constexpr Size count() const noexcept { return count_; }
+
+private:
+	bzd::ranges::Stream<Range&> stream_;
+	Size count_{0u};
+};
+
+template <class Range>
+requires(concepts::contiguousRange<Range> && concepts::sizedRange<Range>)
+class Sequence<Range>
+{
+private:
+	using ValueType = typeTraits::RemoveReference<decltype(*bzd::begin(typeTraits::declval<Range&>()))>;
+
+public:
+	constexpr explicit Sequence(Range& range) noexcept :
+		span_{(bzd::size(range)) ? &(*bzd::begin(range)) : nullptr, static_cast<Size>(bzd::size(range))}
+	{
+	}
+
+	template <class Callable>
+	[[nodiscard]] constexpr Bool operator()(Callable&& callable) noexcept
+	{
+		const auto maybeCount = callable(span_);
+		if (!maybeCount)
+		{
+			return false;
+		}
+		span_ = span_.subSpan(maybeCount.value());
+		count_ += maybeCount.value();
+		return true;
+	}
+
+	[[nodiscard]] constexpr Size count() const noexcept { return count_; }
+
+private:
+	bzd::Span<ValueType> span_;
+	Size count_{0u};
+};
+
 } // namespace bzd::impl::serialization
 
 namespace bzd {
@@ -56,6 +127,15 @@ struct Serialization
 	static_assert(bzd::meta::alwaysFalse<Args...>, "This type has no serialization specialization.");
 };
 
+/// Compact serialization, integers wider than a byte are encoded as variable length integers,
+/// which trades some encoding time for a smaller footprint when values are small.
+///
+/// It falls back to the fixed size serialization for types that do not have a compact representation.
+template <class... Args>
+struct SerializationCompact : Serialization<Args...>
+{
+};
+
 /// Serialize the value of a data type into an output range.
 ///
 /// \param range The output range to be written to.
@@ -78,4 +158,47 @@ constexpr Optional<Size> deserialize(Range&& range, Args&&... args) noexcept
 	return Serialization<Args...>::deserialize(bzd::forward<Range>(range), bzd::forward<Args>(args)...);
 }
 
+/// Serialize the value of a data type into an output range, using the compact encoding.
+///
+/// \copydetails serialize
+template <concepts::outputByteCopyableRange Range, class... Args>
+constexpr Optional<Size> serializeCompact(Range&& range, Args&&... args) noexcept
+{
+	return SerializationCompact<Args...>::serialize(bzd::forward<Range>(range), bzd::forward<Args>(args)...);
+}
+
+/// Deserialize the value of a data type from a byte stream, encoded with the compact encoding.
+///
+/// \copydetails deserialize
+template <concepts::inputByteCopyableRange Range, class... Args>
+constexpr Optional<Size> deserializeCompact(Range&& range, Args&&... args) noexcept
+{
+	return SerializationCompact<Args...>::deserialize(bzd::forward<Range>(range), bzd::forward<Args>(args)...);
+}
+
 } // namespace bzd
+
+namespace bzd::impl::serialization {
+
+/// Fixed size encoding, used to serialize nested elements.
+struct Fixed
+{
+	template <class T>
+	using Specialization = bzd::Serialization<T>;
+
+	/// Whether this scalar type is encoded as-is in memory, on little endian platforms.
+	template <class T>
+	static constexpr Bool isVerbatim = true;
+};
+
+/// Compact encoding, used to serialize nested elements.
+struct Compact
+{
+	template <class T>
+	using Specialization = bzd::SerializationCompact<T>;
+
+	template <class T>
+	static constexpr Bool isVerbatim = (sizeof(T) == 1u || typeTraits::isFloatingPoint<T>);
+};
+
+} // namespace bzd::impl::serialization
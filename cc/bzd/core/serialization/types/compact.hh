@@ -0,0 +1,174 @@
+#pragma once
+
+#include "cc/bzd/algorithm/byte_copy.hh"
+#include "cc/bzd/container/span.hh"
+#include "cc/bzd/core/serialization/types/base.hh"
+#include "cc/bzd/core/serialization/types/enum.hh"
+#include "cc/bzd/core/serialization/types/integral.hh"
+#include "cc/bzd/platform/types.hh"
+#include "cc/bzd/type_traits/is_integral.hh"
+#include "cc/bzd/type_traits/is_same.hh"
+#include "cc/bzd/type_traits/is_signed.hh"
+#include "cc/bzd/type_traits/remove_cvref.hh"
+#include "cc/bzd/type_traits/underlying_type.hh"
+#include "cc/bzd/utility/numeric_limits.hh"
+
+namespace bzd::impl::serialization {
+
+/// Maximum number of bytes of a 64-bit variable length integer.
+inline constexpr Size varintMaxSize{10u};
+
+/// Encode an unsigned integer as a variable length integer (LEB128), 7 bits per byte, least significant first.
+///
+/// \return The number of bytes written to the buffer.
+constexpr Size varintEncode(UInt64 value, UInt8 (&buffer)[varintMaxSize]) noexcept
+{
+	Size size{0u};
+	while (value >= 0x80u)
+	{
+		buffer[size++] = static_cast<UInt8>(value | 0x80u);
+		value >>= 7u;
+	}
+	buffer[size++] = static_cast<UInt8>(value);
+	return size;
+}
+
+/// Decode a variable length integer from an input range.
+///
+/// \return The number of bytes read or nullopt if the range is truncated or the encoding is overlong.
+template <concepts::inputByteCopyableRange Range>
+constexpr Optional<Size> varintDecode(Range&& range, UInt64& value) noexcept
+{
+	auto it = bzd::begin(range);
+	const auto last = bzd::end(range);
+	value = 0u;
+	for (Size size = 0u; size < varintMaxSize; ++size)
+	{
+		if (it == last)
+		{
+			return bzd::nullopt;
+		}
+		const auto byte = static_cast<UInt8>(static_cast<Byte>(*it));
+		++it;
+		// The 10th byte can only hold the most significant bit.
+		if (size == varintMaxSize - 1u && byte > 1u)
+		{
+			return bzd::nullopt;
+		}
+		value |= static_cast<UInt64>(byte & 0x7fu) << (size * 7u);
+		if (!(byte & 0x80u))
+		{
+			return size + 1u;
+		}
+	}
+	return bzd::nullopt;
+}
+
+/// Map signed integers to unsigned ones so that small absolute values have a short encoding: 0, -1, 1, -2...
+constexpr UInt64 zigzagEncode(const Int64 value) noexcept
+{
+	return (static_cast<UInt64>(value) << 1u) ^ static_cast<UInt64>(value >> 63u);
+}
+
+constexpr Int64 zigzagDecode(const UInt64 value) noexcept
+{
+	return static_cast<Int64>(value >> 1u) ^ -static_cast<Int64>(value & 1u);
+}
+
+/// Compact serialization of integers, zigzag encoded if signed.
+template <class T>
+struct SerializationVarint
+{
+	template <concepts::outputByteCopyableRange Range>
+	static constexpr Optional<Size> serialize(Range&& range, const T& value) noexcept
+	{
+		UInt8 buffer[varintMaxSize];
+		Size size;
+		if constexpr (concepts::isSigned<T>)
+		{
+			size = varintEncode(zigzagEncode(static_cast<Int64>(value)), buffer);
+		}
+		else
+		{
+			size = varintEncode(static_cast<UInt64>(value), buffer);
+		}
+		if (algorithm::byteCopyReturnSize(bzd::Span<const UInt8>{buffer, size}, range) == size)
+		{
+			return size;
+		}
+		return bzd::nullopt;
+	}
+
+	template <concepts::inputByteCopyableRange Range>
+	static constexpr Optional<Size> deserialize(Range&& range, T& value) noexcept
+	{
+		UInt64 encoded{};
+		const auto maybeSize = varintDecode(range, encoded);
+		if (!maybeSize)
+		{
+			return bzd::nullopt;
+		}
+		if constexpr (concepts::isSigned<T>)
+		{
+			const auto decoded = zigzagDecode(encoded);
+			if (decoded < static_cast<Int64>(NumericLimits<T>::min()) || decoded > static_cast<Int64>(NumericLimits<T>::max()))
+			{
+				return bzd::nullopt;
+			}
+			value = static_cast<T>(decoded);
+		}
+		else
+		{
+			if (encoded > static_cast<UInt64>(NumericLimits<T>::max()))
+			{
+				return bzd::nullopt;
+			}
+			value = static_cast<T>(encoded);
+		}
+		return maybeSize;
+	}
+};
+
+} // namespace bzd::impl::serialization
+
+namespace bzd::concepts {
+/// Integers wider than a byte, booleans and bytes are already as compact as they can be.
+template <class T>
+concept serializationVarint = integral<T> && !sameAs<typeTraits::RemoveCVRef<T>, bool> && (sizeof(typeTraits::RemoveCVRef<T>) > 1u);
+} // namespace bzd::concepts
+
+namespace bzd {
+
+template <concepts::serializationVarint T>
+struct SerializationCompact<T> : impl::serialization::SerializationVarint<typeTraits::RemoveCVRef<T>>
+{
+};
+
+/// Enumerations use the compact encoding of their underlying type.
+template <concepts::serializationEnum T>
+requires(sizeof(typeTraits::RemoveCVRef<T>) > 1u)
+struct SerializationCompact<T>
+{
+	using Type = typeTraits::RemoveCVRef<T>;
+	using Underlying = typeTraits::UnderlyingType<Type>;
+
+	template <concepts::outputByteCopyableRange Range>
+	static constexpr Optional<Size> serialize(Range&& range, const Type& value) noexcept
+	{
+		return SerializationCompact<Underlying>::serialize(bzd::forward<Range>(range), static_cast<Underlying>(value));
+	}
+
+	template <concepts::inputByteCopyableRange Range>
+	static constexpr Optional<Size> deserialize(Range&& range, Type& value) noexcept
+	{
+		Underlying underlying{};
+		const auto maybeSize = SerializationCompact<Underlying>::deserialize(bzd::forward<Range>(range), underlying);
+		if (maybeSize)
+		{
+			value = static_cast<Type>(underlying);
+		}
+		return maybeSize;
+	}
+};
+
+} // namespace bzd
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "cc/bzd/core/serialization/types/base.hh"
+#include "cc/bzd/core/serialization/types/integral.hh"
+#include "cc/bzd/platform/types.hh"
+#include "cc/bzd/type_traits/is_enum.hh"
+#include "cc/bzd/type_traits/remove_cvref.hh"
+#include "cc/bzd/type_traits/underlying_type.hh"
+
+namespace bzd::concepts {
+template <class T>
+concept serializationEnum = typeTraits::isEnum<typeTraits::RemoveCVRef<T>>;
+}
+
+namespace bzd {
+
+/// Enumerations are serialized as their underlying type.
+template <concepts::serializationEnum T>
+struct Serialization<T>
+{
+	using Type = typeTraits::RemoveCVRef<T>;
+	using Underlying = typeTraits::UnderlyingType<Type>;
+
+	template <concepts::outputByteCopyableRange Range>
+	static constexpr Optional<Size> serialize(Range&& range, const Type& value) noexcept
+	{
+		return Serialization<Underlying>::serialize(bzd::forward<Range>(range), static_cast<Underlying>(value));
+	}
+
+	template <concepts::inputByteCopyableRange Range>
+	static constexpr Optional<Size> deserialize(Range&& range, Type& value) noexcept
+	{
+		Underlying underlying{};
+		const auto maybeSize = Serialization<Underlying>::deserialize(bzd::forward<Range>(range), underlying);
+		if (maybeSize)
+		{
+			value = static_cast<Type>(underlying);
+		}
+		return maybeSize;
+	}
+};
+
+} // namespace bzd
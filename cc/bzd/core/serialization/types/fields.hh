@@ -0,0 +1,33 @@
+#pragma once
+
+namespace bzd::serialization {
+
+/// Ordered list of the data members of a structure to be serialized.
+///
+/// \code
+/// template <>
+/// struct bzd::SerializationFields<MyStruct>
+/// {
+///     using Type = bzd::serialization::Fields<&MyStruct::a, &MyStruct::b>;
+/// };
+/// \endcode
+template <auto... members>
+struct Fields
+{
+	/// Call a callable with all the member pointers.
+	template <class Callable>
+	static constexpr decltype(auto) apply(Callable&& callable) noexcept
+	{
+		return callable(members...);
+	}
+};
+
+} // namespace bzd::serialization
+
+namespace bzd {
+
+/// Specialize this template to make a structure serializable, this is done by the bdl generator for all its structures.
+template <class T>
+struct SerializationFields;
+
+} // namespace bzd
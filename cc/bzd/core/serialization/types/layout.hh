@@ -0,0 +1,247 @@
+#pragma once
+
+#include "cc/bzd/algorithm/byte_copy.hh"
+#include "cc/bzd/container/array.hh"
+#include "cc/bzd/container/optional.hh"
+#include "cc/bzd/container/span.hh"
+#include "cc/bzd/core/serialization/types/fields.hh"
+#include "cc/bzd/platform/types.hh"
+#include "cc/bzd/type_traits/conditional.hh"
+#include "cc/bzd/type_traits/false_type.hh"
+#include "cc/bzd/type_traits/is_enum.hh"
+#include "cc/bzd/type_traits/is_floating_point.hh"
+#include "cc/bzd/type_traits/is_integral.hh"
+#include "cc/bzd/type_traits/is_same.hh"
+#include "cc/bzd/type_traits/is_trivially_copyable.hh"
+#include "cc/bzd/type_traits/range.hh"
+#include "cc/bzd/type_traits/true_type.hh"
+#include "cc/bzd/utility/bit/byte_swap.hh"
+#include "cc/bzd/utility/bit/endian.hh"
+#include "cc/bzd/utility/min.hh"
+
+#include <bit>
+
+namespace bzd::impl::serialization {
+
+template <class T>
+struct IsContainerArray : typeTraits::FalseType
+{
+};
+
+template <class T, Size capacity>
+struct IsContainerArray<bzd::Array<T, capacity>> : typeTraits::TrueType
+{
+};
+
+template <class T, class Encoding>
+constexpr Bool isFixedLayoutImpl() noexcept;
+
+template <class Encoding, class C, class M>
+constexpr Bool isFixedLayoutMember(M C::*) noexcept
+{
+	return isFixedLayoutImpl<M, Encoding>();
+}
+
+template <class C, class M>
+constexpr Size sizeOfMember(M C::*) noexcept
+{
+	return sizeof(M);
+}
+
+template <class T, class Encoding>
+constexpr Bool isFixedLayoutImpl() noexcept
+{
+	if constexpr (bzd::Endian::native != bzd::Endian::little || typeTraits::isSame<T, bool>)
+	{
+		return false;
+	}
+	else if constexpr (typeTraits::isIntegral<T> || typeTraits::isFloatingPoint<T> || typeTraits::isEnum<T>)
+	{
+		return Encoding::template isVerbatim<T>;
+	}
+	else if constexpr (IsContainerArray<T>::value)
+	{
+		using ValueType = typename T::ValueType;
+		return isFixedLayoutImpl<ValueType, Encoding>() && sizeof(T) == sizeof(ValueType) * T::size();
+	}
+	else if constexpr (requires { typename bzd::SerializationFields<T>::Type; })
+	{
+		if constexpr (!concepts::triviallyCopyable<T>)
+		{
+			return false;
+		}
+		else
+		{
+			// All the members must be fixed layout and cover the whole structure, meaning there is no padding.
+			return bzd::SerializationFields<T>::Type::apply([](auto... members) {
+				return (isFixedLayoutMember<Encoding>(members) && ...) && (sizeOfMember(members) + ... + 0u) == sizeof(T);
+			});
+		}
+	}
+	else
+	{
+		return false;
+	}
+}
+
+/// Whether the serialized representation of a type with a specific encoding is identical to its memory representation.
+/// If so, it can be serialized with a plain memory copy.
+template <class T, class Encoding>
+inline constexpr Bool isFixedLayout = isFixedLayoutImpl<T, Encoding>();
+
+/// Copy bytes into an output range, using a memory copy if the range is contiguous.
+template <class Range>
+constexpr Optional<Size> copyBytes(const bzd::Span<const Byte> bytes, Range&& range) noexcept
+{
+	if constexpr (concepts::contiguousRange<Range> && concepts::sizedRange<Range>)
+	{
+		if (static_cast<Size>(bzd::size(range)) < bytes.size())
+		{
+			return bzd::nullopt;
+		}
+		if (bytes.size())
+		{
+			__builtin_memcpy(&(*bzd::begin(range)), bytes.data(), bytes.size());
+		}
+		return bytes.size();
+	}
+	else
+	{
+		if (algorithm::byteCopyReturnSize(bytes, range) == bytes.size())
+		{
+			return bytes.size();
+		}
+		return bzd::nullopt;
+	}
+}
+
+/// Copy bytes from an input range, using a memory copy if the range is contiguous.
+template <class Range>
+constexpr Optional<Size> copyBytesFrom(Range&& range, const bzd::Span<Byte> bytes) noexcept
+{
+	if constexpr (concepts::contiguousRange<Range> && concepts::sizedRange<Range>)
+	{
+		if (static_cast<Size>(bzd::size(range)) < bytes.size())
+		{
+			return bzd::nullopt;
+		}
+		if (bytes.size())
+		{
+			__builtin_memcpy(bytes.data(), &(*bzd::begin(range)), bytes.size());
+		}
+		return bytes.size();
+	}
+	else
+	{
+		if (algorithm::byteCopyReturnSize(range, bytes) == bytes.size())
+		{
+			return bytes.size();
+		}
+		return bzd::nullopt;
+	}
+}
+
+/// Whether a range of elements of this type can be serialized in bulk, either with a plain memory copy or,
+/// on big endian platforms, by swapping the byte order of each element.
+template <class T, class Encoding>
+inline constexpr Bool isBulk =
+	isFixedLayout<T, Encoding> ||
+	((typeTraits::isIntegral<T> || typeTraits::isFloatingPoint<T> || typeTraits::isEnum<T>) && !typeTraits::isSame<T, bool> &&
+	 Encoding::template isVerbatim<T>);
+
+/// Reverse the byte order of a scalar.
+template <class T>
+constexpr T byteSwapElement(const T value) noexcept
+{
+	if constexpr (sizeof(T) == 1u)
+	{
+		return value;
+	}
+	else
+	{
+		using Integer = typeTraits::Conditional<sizeof(T) == 2u, UInt16, typeTraits::Conditional<sizeof(T) == 4u, UInt32, UInt64>>;
+		return std::bit_cast<T>(bzd::byteSwap(std::bit_cast<Integer>(value)));
+	}
+}
+
+/// Copy elements into an output range, reversing the byte order of each of them.
+///
+/// Elements are swapped by chunks into a local buffer, a loop simple enough to be vectorized by the compiler.
+template <class T, class Range>
+constexpr Optional<Size> copyElementsSwapped(const bzd::Span<const T> elements, Range&& range) noexcept
+{
+	constexpr Size chunkSize{256u / sizeof(T)};
+	T buffer[chunkSize];
+	Size count{0u};
+	for (Size offset = 0u; offset < elements.size(); offset += chunkSize)
+	{
+		const auto size = bzd::min(chunkSize, elements.size() - offset);
+		for (Size i = 0u; i < size; ++i)
+		{
+			buffer[i] = byteSwapElement(elements[offset + i]);
+		}
+		const auto maybeCount = [&]() {
+			if constexpr (concepts::contiguousRange<Range> && concepts::sizedRange<Range>)
+			{
+				return copyBytes(bzd::Span<const T>{buffer, size}.asBytes(), range.subSpan(count));
+			}
+			else
+			{
+				return copyBytes(bzd::Span<const T>{buffer, size}.asBytes(), range);
+			}
+		}();
+		if (!maybeCount)
+		{
+			return bzd::nullopt;
+		}
+		count += maybeCount.value();
+	}
+	return count;
+}
+
+/// Copy elements from an input range, reversing the byte order of each of them.
+template <class T, class Range>
+constexpr Optional<Size> copyElementsSwappedFrom(Range&& range, bzd::Span<T> elements) noexcept
+{
+	const auto maybeCount = copyBytesFrom(range, elements.asBytesMutable());
+	if (maybeCount)
+	{
+		for (auto& element : elements)
+		{
+			element = byteSwapElement(element);
+		}
+	}
+	return maybeCount;
+}
+
+/// Copy serialized elements in bulk into an output range.
+template <class T, class Encoding, class Range>
+constexpr Optional<Size> copyElements(const bzd::Span<const T> elements, Range&& range) noexcept
+{
+	static_assert(isBulk<T, Encoding>, "Elements must support bulk serialization.");
+	if constexpr (isFixedLayout<T, Encoding>)
+	{
+		return copyBytes(elements.asBytes(), range);
+	}
+	else
+	{
+		return copyElementsSwapped(elements, range);
+	}
+}
+
+/// Copy serialized elements in bulk from an input range.
+template <class T, class Encoding, class Range>
+constexpr Optional<Size> copyElementsFrom(Range&& range, bzd::Span<T> elements) noexcept
+{
+	static_assert(isBulk<T, Encoding>, "Elements must support bulk serialization.");
+	if constexpr (isFixedLayout<T, Encoding>)
+	{
+		return copyBytesFrom(range, elements.asBytesMutable());
+	}
+	else
+	{
+		return copyElementsSwappedFrom(range, elements);
+	}
+}
+
+} // namespace bzd::impl::serialization
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "cc/bzd/container/optional.hh"
+#include "cc/bzd/core/serialization/types/base.hh"
+#include "cc/bzd/core/serialization/types/integral.hh"
+#include "cc/bzd/platform/types.hh"
+#include "cc/bzd/type_traits/is_same_template.hh"
+#include "cc/bzd/type_traits/remove_cvref.hh"
+
+namespace bzd::impl::serialization {
+
+/// Optionals are serialized as a boolean telling whether there is a value, followed by the value if any.
+template <class T, class Encoding>
+struct SerializationOptional
+{
+	using ValueType = typename T::Value;
+
+	template <concepts::outputByteCopyableRange Range>
+	static constexpr bzd::Optional<Size> serialize(Range&& range, const T& value) noexcept
+	{
+		Sequence sequence{range};
+		if (!sequence([&](auto& stream) { return bzd::Serialization<Bool>::serialize(stream, value.hasValue()); }))
+		{
+			return bzd::nullopt;
+		}
+		if (value.hasValue())
+		{
+			if (!sequence([&](auto& stream) {
+					return Encoding::template Specialization<ValueType>::serialize(stream, value.value());
+				}))
+			{
+				return bzd::nullopt;
+			}
+		}
+		return sequence.count();
+	}
+
+	template <concepts::inputByteCopyableRange Range>
+	static constexpr bzd::Optional<Size> deserialize(Range&& range, T& value) noexcept
+	{
+		Sequence sequence{range};
+		Bool hasValue{false};
+		if (!sequence([&](auto& stream) { return bzd::Serialization<Bool>::deserialize(stream, hasValue); }))
+		{
+			return bzd::nullopt;
+		}
+		if (!hasValue)
+		{
+			value.reset();
+			return sequence.count();
+		}
+		value.emplace();
+		if (!sequence([&](auto& stream) {
+				return Encoding::template Specialization<ValueType>::deserialize(stream, value.valueMutable());
+			}))
+		{
+			value.reset();
+			return bzd::nullopt;
+		}
+		return sequence.count();
+	}
+};
+
+} // namespace bzd::impl::serialization
+
+namespace bzd::concepts {
+template <class T>
+concept serializationOptional = sameTemplate<typeTraits::RemoveCVRef<T>, bzd::Optional>;
+}
+
+namespace bzd {
+
+template <concepts::serializationOptional T>
+struct Serialization<T> : impl::serialization::SerializationOptional<typeTraits::RemoveCVRef<T>, impl::serialization::Fixed>
+{
+};
+
+template <concepts::serializationOptional T>
+struct SerializationCompact<T> : impl::serialization::SerializationOptional<typeTraits::RemoveCVRef<T>, impl::serialization::Compact>
+{
+};
+
+} // namespace bzd
@@ -0,0 +1,255 @@
+#pragma once
+
+#include "cc/bzd/container/span.hh"
+#include "cc/bzd/core/serialization/types/base.hh"
+#include "cc/bzd/core/serialization/types/compact.hh"
+#include "cc/bzd/core/serialization/types/integral.hh"
+#include "cc/bzd/core/serialization/types/layout.hh"
+#include "cc/bzd/platform/types.hh"
+#include "cc/bzd/type_traits/is_same.hh"
+#include "cc/bzd/type_traits/range.hh"
+#include "cc/bzd/type_traits/remove_cvref.hh"
+#include "cc/bzd/utility/min.hh"
+#include "cc/bzd/utility/numeric_limits.hh"
+
+namespace bzd::concepts {
+/// Containers that own their elements and can be resized, like Vector or String.
+template <class T>
+concept serializationResizeable = contiguousRange<T> && sizedRange<T> && requires(T& t) {
+	t.capacity();
+	t.resize(Size{});
+	t.data();
+};
+
+/// Resizeable containers and views, like Span or StringView.
+template <class T>
+concept serializationRange = serializationResizeable<typeTraits::RemoveCVRef<T>> ||
+							 (contiguousRange<typeTraits::RemoveCVRef<T>> && sizedRange<typeTraits::RemoveCVRef<T>> &&
+							  requires(const typeTraits::RemoveCVRef<T>& t) { typeTraits::RemoveCVRef<T>{t.data(), Size{}}; });
+} // namespace bzd::concepts
+
+namespace bzd::impl::serialization {
+
+/// Serialization of a sequence of elements, without their number.
+///
+/// Scalars are copied in bulk and booleans are packed, 8 per byte, least significant bit first.
+template <class ValueType, class Encoding>
+struct SerializationElements
+{
+	using ElementSerialization = typename Encoding::template Specialization<ValueType>;
+
+	template <class Range>
+	static constexpr Optional<Size> serializeElements(Range&& range, const bzd::Span<const ValueType> elements) noexcept
+	{
+		if constexpr (isBulk<ValueType, Encoding>)
+		{
+			return copyElements<ValueType, Encoding>(elements, range);
+		}
+		else if constexpr (typeTraits::isSame<ValueType, bool>)
+		{
+			Sequence sequence{range};
+			for (Size offset = 0u; offset < elements.size(); offset += 8u)
+			{
+				UInt8 byte{0u};
+				for (Size bit = 0u; bit < 8u && offset + bit < elements.size(); ++bit)
+				{
+					byte |= static_cast<UInt8>(elements[offset + bit]) << bit;
+				}
+				if (!sequence([&](auto& stream) { return bzd::Serialization<UInt8>::serialize(stream, byte); }))
+				{
+					return bzd::nullopt;
+				}
+			}
+			return sequence.count();
+		}
+		else
+		{
+			Sequence sequence{range};
+			for (const auto& element : elements)
+			{
+				if (!sequence([&](auto& stream) { return ElementSerialization::serialize(stream, element); }))
+				{
+					return bzd::nullopt;
+				}
+			}
+			return sequence.count();
+		}
+	}
+
+	template <class Range>
+	static constexpr Optional<Size> deserializeElements(Range&& range, bzd::Span<ValueType> elements) noexcept
+	{
+		if constexpr (isBulk<ValueType, Encoding>)
+		{
+			return copyElementsFrom<ValueType, Encoding>(range, elements);
+		}
+		else if constexpr (typeTraits::isSame<ValueType, bool>)
+		{
+			Sequence sequence{range};
+			for (Size offset = 0u; offset < elements.size(); offset += 8u)
+			{
+				UInt8 byte{0u};
+				if (!sequence([&](auto& stream) { return bzd::Serialization<UInt8>::deserialize(stream, byte); }))
+				{
+					return bzd::nullopt;
+				}
+				const auto count = bzd::min(Size{8u}, elements.size() - offset);
+				// Padding bits must be cleared, to keep a single valid representation.
+				if (count < 8u && (byte >> count))
+				{
+					return bzd::nullopt;
+				}
+				for (Size bit = 0u; bit < count; ++bit)
+				{
+					elements[offset + bit] = (byte >> bit) & 1u;
+				}
+			}
+			return sequence.count();
+		}
+		else
+		{
+			Sequence sequence{range};
+			for (auto& element : elements)
+			{
+				if (!sequence([&](auto& stream) { return ElementSerialization::deserialize(stream, element); }))
+				{
+					return bzd::nullopt;
+				}
+			}
+			return sequence.count();
+		}
+	}
+};
+
+/// Ranges are serialized as their number of elements followed by the elements.
+/// The size is a 32-bit integer with the fixed encoding and a variable length integer with the compact one.
+template <class T, class Encoding>
+struct SerializationRange : SerializationElements<typeTraits::RemoveCVRef<typeTraits::RangeValue<T>>, Encoding>
+{
+	using ValueType = typeTraits::RemoveCVRef<typeTraits::RangeValue<T>>;
+	using SizeSerialization = typename Encoding::template Specialization<UInt32>;
+	using SerializationElements<ValueType, Encoding>::serializeElements;
+	using SerializationElements<ValueType, Encoding>::deserializeElements;
+
+	template <concepts::outputByteCopyableRange Range>
+	static constexpr Optional<Size> serialize(Range&& range, const T& value) noexcept
+	{
+		const auto size = bzd::size(value);
+		if (size > NumericLimits<UInt32>::max())
+		{
+			return bzd::nullopt;
+		}
+		Sequence sequence{range};
+		if (!sequence([&](auto& stream) { return SizeSerialization::serialize(stream, static_cast<UInt32>(size)); }))
+		{
+			return bzd::nullopt;
+		}
+		if (!sequence([&](auto& stream) { return serializeElements(stream, bzd::Span<const ValueType>{value.data(), size}); }))
+		{
+			return bzd::nullopt;
+		}
+		return sequence.count();
+	}
+
+	/// Resizeable containers are deserialized by copy.
+	template <concepts::inputByteCopyableRange Range>
+	static constexpr Optional<Size> deserialize(Range&& range, T& value) noexcept
+	requires(concepts::serializationResizeable<T>)
+	{
+		Sequence sequence{range};
+		UInt32 size{0u};
+		if (!sequence([&](auto& stream) { return SizeSerialization::deserialize(stream, size); }))
+		{
+			return bzd::nullopt;
+		}
+		if (size > value.capacity())
+		{
+			return bzd::nullopt;
+		}
+		value.resize(size);
+		if (!sequence([&](auto& stream) { return deserializeElements(stream, bzd::Span<ValueType>{value.data(), value.size()}); }))
+		{
+			value.clear();
+			return bzd::nullopt;
+		}
+		return sequence.count();
+	}
+
+	/// Views of bytes are deserialized without copy, they point directly to the input range.
+	/// Therefore the input range must be contiguous, and outlive the view.
+	template <concepts::inputByteCopyableRange Range>
+	static constexpr Optional<Size> deserialize(Range&& range, T& value) noexcept
+	requires(!concepts::serializationResizeable<T> && sizeof(ValueType) == 1u &&
+			 requires(const ValueType* data) { T{data, Size{}}; })
+	{
+		Sequence sequence{range};
+		UInt32 size{0u};
+		if (!sequence([&](auto& stream) { return SizeSerialization::deserialize(stream, size); }))
+		{
+			return bzd::nullopt;
+		}
+		if (!sequence([&](auto& stream) -> Optional<Size> {
+				static_assert(concepts::contiguousRange<decltype(stream)>, "Views can only be deserialized from contiguous ranges.");
+				if (bzd::size(stream) < size)
+				{
+					return bzd::nullopt;
+				}
+				value = T{reinterpret_cast<const ValueType*>(stream.data()), size};
+				return size;
+			}))
+		{
+			return bzd::nullopt;
+		}
+		return sequence.count();
+	}
+};
+
+/// Arrays have a size known at compile time, they are serialized as their elements only.
+template <class T, class Encoding>
+struct SerializationArray : SerializationElements<typename T::ValueType, Encoding>
+{
+	using ValueType = typename T::ValueType;
+
+	template <concepts::outputByteCopyableRange Range>
+	static constexpr Optional<Size> serialize(Range&& range, const T& value) noexcept
+	{
+		return SerializationArray::serializeElements(range, bzd::Span<const ValueType>{value.data(), value.size()});
+	}
+
+	template <concepts::inputByteCopyableRange Range>
+	static constexpr Optional<Size> deserialize(Range&& range, T& value) noexcept
+	{
+		return SerializationArray::deserializeElements(range, bzd::Span<ValueType>{value.data(), value.size()});
+	}
+};
+
+} // namespace bzd::impl::serialization
+
+namespace bzd::concepts {
+template <class T>
+concept serializationArray = impl::serialization::IsContainerArray<typeTraits::RemoveCVRef<T>>::value;
+}
+
+namespace bzd {
+
+template <concepts::serializationArray T>
+struct Serialization<T> : impl::serialization::SerializationArray<typeTraits::RemoveCVRef<T>, impl::serialization::Fixed>
+{
+};
+
+template <concepts::serializationArray T>
+struct SerializationCompact<T> : impl::serialization::SerializationArray<typeTraits::RemoveCVRef<T>, impl::serialization::Compact>
+{
+};
+
+template <concepts::serializationRange T>
+struct Serialization<T> : impl::serialization::SerializationRange<typeTraits::RemoveCVRef<T>, impl::serialization::Fixed>
+{
+};
+
+template <concepts::serializationRange T>
+struct SerializationCompact<T> : impl::serialization::SerializationRange<typeTraits::RemoveCVRef<T>, impl::serialization::Compact>
+{
+};
+
+} // namespace bzd
@@ -0,0 +1,97 @@
+#pragma once
+
+#include "cc/bzd/container/span.hh"
+#include "cc/bzd/core/serialization/types/base.hh"
+#include "cc/bzd/core/serialization/types/fields.hh"
+#include "cc/bzd/core/serialization/types/layout.hh"
+#include "cc/bzd/platform/types.hh"
+#include "cc/bzd/type_traits/remove_cvref.hh"
+
+namespace bzd::concepts {
+template <class T>
+concept serializationStructure = requires { typename bzd::SerializationFields<typeTraits::RemoveCVRef<T>>::Type; };
+}
+
+namespace bzd::impl::serialization {
+
+/// Structures are serialized as the concatenation of their fields, in declaration order.
+///
+/// If the memory representation of the structure matches its serialized representation,
+/// it is copied as a whole.
+template <class T, class Encoding>
+struct SerializationStructure
+{
+	using Fields = typename bzd::SerializationFields<T>::Type;
+	static constexpr Bool isVerbatim = isFixedLayout<T, Encoding>;
+
+	template <concepts::outputByteCopyableRange Range>
+	static constexpr Optional<Size> serialize(Range&& range, const T& value) noexcept
+	{
+		if constexpr (isVerbatim)
+		{
+			return copyBytes(bzd::Span<const T>{&value, 1u}.asBytes(), range);
+		}
+		else
+		{
+			Sequence sequence{range};
+			const auto success = Fields::apply([&](auto... members) {
+				return (sequence([&](auto& stream) { return serializeField(stream, value.*members); }) && ...);
+			});
+			if (!success)
+			{
+				return bzd::nullopt;
+			}
+			return sequence.count();
+		}
+	}
+
+	template <concepts::inputByteCopyableRange Range>
+	static constexpr Optional<Size> deserialize(Range&& range, T& value) noexcept
+	{
+		if constexpr (isVerbatim)
+		{
+			return copyBytesFrom(range, bzd::Span<T>{&value, 1u}.asBytesMutable());
+		}
+		else
+		{
+			Sequence sequence{range};
+			const auto success = Fields::apply([&](auto... members) {
+				return (sequence([&](auto& stream) { return deserializeField(stream, value.*members); }) && ...);
+			});
+			if (!success)
+			{
+				return bzd::nullopt;
+			}
+			return sequence.count();
+		}
+	}
+
+private:
+	template <class Range, class Field>
+	static constexpr Optional<Size> serializeField(Range& range, const Field& field) noexcept
+	{
+		return Encoding::template Specialization<Field>::serialize(range, field);
+	}
+
+	template <class Range, class Field>
+	static constexpr Optional<Size> deserializeField(Range& range, Field& field) noexcept
+	{
+		return Encoding::template Specialization<Field>::deserialize(range, field);
+	}
+};
+
+} // namespace bzd::impl::serialization
+
+namespace bzd {
+
+template <concepts::serializationStructure T>
+struct Serialization<T> : impl::serialization::SerializationStructure<typeTraits::RemoveCVRef<T>, impl::serialization::Fixed>
+{
+};
+
+template <concepts::serializationStructure T>
+struct SerializationCompact<T> : impl::serialization::SerializationStructure<typeTraits::RemoveCVRef<T>, impl::serialization::Compact>
+{
+};
+
+} // namespace bzd
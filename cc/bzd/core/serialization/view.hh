@@ -0,0 +1,382 @@
+#pragma once
+
+#include "cc/bzd/container/optional.hh"
+#include "cc/bzd/container/span.hh"
+#include "cc/bzd/core/assert/minimal.hh"
+#include "cc/bzd/core/serialization/serialization.hh"
+#include "cc/bzd/meta/always_false.hh"
+#include "cc/bzd/platform/types.hh"
+#include "cc/bzd/type_traits/is_const.hh"
+#include "cc/bzd/type_traits/is_enum.hh"
+#include "cc/bzd/type_traits/is_floating_point.hh"
+#include "cc/bzd/type_traits/is_integral.hh"
+#include "cc/bzd/type_traits/is_same.hh"
+#include "cc/bzd/type_traits/range.hh"
+#include "cc/bzd/type_traits/remove_cvref.hh"
+#include "cc/bzd/utility/min.hh"
+
+namespace bzd::impl::serialization {
+
+template <class T>
+struct MemberPointer;
+
+template <class C, class M>
+struct MemberPointer<M C::*>
+{
+	using Class = C;
+	using Type = M;
+};
+
+/// Type of the data member pointed to by a member pointer.
+template <auto member>
+using MemberType = typename MemberPointer<decltype(member)>::Type;
+
+template <class T>
+using MemberPointerType = typename MemberPointer<T>::Type;
+
+template <class T>
+constexpr Size fixedSizeImpl() noexcept;
+
+template <class C, class M>
+constexpr Size fixedSizeMember(M C::*) noexcept
+{
+	return fixedSizeImpl<M>();
+}
+
+/// Size of the serialized representation of a type with the fixed encoding if it does not depend on its value
+/// and any content is valid, 0 otherwise. Booleans are excluded as not all values are valid.
+template <class T>
+constexpr Size fixedSizeImpl() noexcept
+{
+	if constexpr (typeTraits::isSame<T, bool>)
+	{
+		return 0u;
+	}
+	else if constexpr (typeTraits::isIntegral<T> || typeTraits::isFloatingPoint<T> || typeTraits::isEnum<T>)
+	{
+		return sizeof(T);
+	}
+	else if constexpr (IsContainerArray<T>::value)
+	{
+		return fixedSizeImpl<typename T::ValueType>() * T::size();
+	}
+	else if constexpr (concepts::serializationStructure<T>)
+	{
+		return bzd::SerializationFields<T>::Type::apply([](auto... members) -> Size {
+			if (((fixedSizeMember(members) != 0u) && ...))
+			{
+				return (fixedSizeMember(members) + ... + 0u);
+			}
+			return 0u;
+		});
+	}
+	else
+	{
+		return 0u;
+	}
+}
+
+template <class T>
+inline constexpr Size fixedSize = fixedSizeImpl<T>();
+
+template <class T>
+constexpr Optional<Size> measure(const bzd::Span<const Byte> data) noexcept;
+
+/// Measure the size of a serialized sequence of elements.
+template <class T>
+constexpr Optional<Size> measureElements(const bzd::Span<const Byte> data, const Size count) noexcept
+{
+	Size size{0u};
+	if constexpr (fixedSize<T> != 0u)
+	{
+		size = count * fixedSize<T>;
+	}
+	else if constexpr (typeTraits::isSame<T, bool>)
+	{
+		// Booleans are packed, unused bits of the last byte must be cleared.
+		size = (count + 7u) / 8u;
+		if (data.size() >= size && count % 8u && (static_cast<UInt8>(data[size - 1u]) >> (count % 8u)))
+		{
+			return bzd::nullopt;
+		}
+	}
+	else
+	{
+		for (Size i = 0u; i < count; ++i)
+		{
+			const auto maybeSize = measure<T>(data.subSpan(size));
+			if (!maybeSize)
+			{
+				return bzd::nullopt;
+			}
+			size += maybeSize.value();
+		}
+	}
+	if (data.size() < size)
+	{
+		return bzd::nullopt;
+	}
+	return size;
+}
+
+/// Measure the size of a serialized value with the fixed encoding, without deserializing it.
+///
+/// \return The size in bytes of the serialized value, or nullopt if the data is truncated or malformed.
+template <class T>
+constexpr Optional<Size> measure(const bzd::Span<const Byte> data) noexcept
+{
+	if constexpr (fixedSize<T> != 0u)
+	{
+		if (data.size() < fixedSize<T>)
+		{
+			return bzd::nullopt;
+		}
+		return fixedSize<T>;
+	}
+	else if constexpr (typeTraits::isSame<T, bool>)
+	{
+		Bool value{false};
+		return bzd::Serialization<Bool>::deserialize(data.first(bzd::min(data.size(), Size{1u})), value);
+	}
+	else if constexpr (concepts::serializationOptional<T>)
+	{
+		Bool hasValue{false};
+		if (!bzd::Serialization<Bool>::deserialize(data.first(bzd::min(data.size(), Size{1u})), hasValue))
+		{
+			return bzd::nullopt;
+		}
+		if (!hasValue)
+		{
+			return 1u;
+		}
+		const auto maybeSize = measure<typename T::Value>(data.subSpan(1u));
+		if (!maybeSize)
+		{
+			return bzd::nullopt;
+		}
+		return maybeSize.value() + 1u;
+	}
+	else if constexpr (concepts::serializationRange<T>)
+	{
+		using ValueType = typeTraits::RemoveCVRef<typeTraits::RangeValue<T>>;
+		UInt32 count{0u};
+		if (!bzd::Serialization<UInt32>::deserialize(data.first(bzd::min(data.size(), sizeof(UInt32))), count))
+		{
+			return bzd::nullopt;
+		}
+		const auto maybeSize = measureElements<ValueType>(data.subSpan(sizeof(UInt32)), count);
+		if (!maybeSize)
+		{
+			return bzd::nullopt;
+		}
+		return maybeSize.value() + sizeof(UInt32);
+	}
+	else if constexpr (IsContainerArray<T>::value)
+	{
+		return measureElements<typename T::ValueType>(data, T::size());
+	}
+	else if constexpr (concepts::serializationStructure<T>)
+	{
+		Size size{0u};
+		const auto success = bzd::SerializationFields<T>::Type::apply([&](auto... members) {
+			return ([&](auto member) {
+				const auto maybeSize = measure<MemberPointerType<decltype(member)>>(data.subSpan(size));
+				if (!maybeSize)
+				{
+					return false;
+				}
+				size += maybeSize.value();
+				return true;
+			}(members) && ...);
+		});
+		if (!success)
+		{
+			return bzd::nullopt;
+		}
+		return size;
+	}
+	else
+	{
+		static_assert(bzd::meta::alwaysFalse<T>, "This type cannot be measured.");
+	}
+}
+
+} // namespace bzd::impl::serialization
+
+namespace bzd::serialization {
+
+/// Read-only view over a serialized array of fixed size elements, elements are decoded on access.
+template <class T>
+class ArrayView
+{
+public:
+	constexpr explicit ArrayView(const bzd::Span<const Byte> data) noexcept : data_{data} {}
+
+	[[nodiscard]] constexpr Size size() const noexcept { return data_.size() / impl::serialization::fixedSize<T>; }
+	[[nodiscard]] constexpr Bool empty() const noexcept { return data_.empty(); }
+
+	[[nodiscard]] constexpr T operator[](const Size index) const noexcept
+	{
+		constexpr auto elementSize = impl::serialization::fixedSize<T>;
+		T value{};
+		const auto result = bzd::Serialization<T>::deserialize(data_.subSpan(index * elementSize, elementSize), value);
+		bzd::assert::isTrue(result.hasValue());
+		return value;
+	}
+
+private:
+	bzd::Span<const Byte> data_;
+};
+
+/// View over a serialized structure, its fields are decoded lazily and directly from the underlying bytes.
+///
+/// The data is validated once, when the view is created, field accesses then do not need further bound checks.
+/// If the view is created over mutable bytes, fixed size fields can also be patched in place.
+///
+/// \code
+/// const auto maybeView = bzd::serialization::View<Message>::make(bytes);
+/// if (maybeView && maybeView->get<&Message::destination>() == address) { ... }
+/// \endcode
+///
+/// \tparam T The structure type, it must have a bzd::SerializationFields specialization.
+/// \tparam ByteType `const Byte` for a read-only view, `Byte` for a mutable one.
+template <class T, class ByteType = const Byte>
+class View
+{
+private:
+	using Fields = typename bzd::SerializationFields<T>::Type;
+	static constexpr Size fieldCount = Fields::apply([](auto... members) { return sizeof...(members); });
+	static constexpr Bool isMutable = !typeTraits::isConst<ByteType>;
+
+	template <auto member>
+	static constexpr Size indexOf() noexcept
+	{
+		return Fields::apply([](auto... members) {
+			Size index{0u};
+			Size result{fieldCount};
+			((result = (isSameMember(members, member) && result == fieldCount) ? index : result, ++index), ...);
+			return result;
+		});
+	}
+
+	template <class A, class B>
+	static constexpr Bool isSameMember(A a, B b) noexcept
+	{
+		if constexpr (typeTraits::isSame<A, B>)
+		{
+			return a == b;
+		}
+		else
+		{
+			return false;
+		}
+	}
+
+	/// Ranges of fixed size elements are accessed through an ArrayView, except views of bytes that are zero-copy already.
+	template <class U>
+	static constexpr Bool isArrayView() noexcept
+	{
+		if constexpr (concepts::serializationRange<U>)
+		{
+			using ValueType = typeTraits::RemoveCVRef<typeTraits::RangeValue<U>>;
+			return impl::serialization::fixedSize<ValueType> != 0u && (concepts::serializationResizeable<U> || sizeof(ValueType) != 1u);
+		}
+		else
+		{
+			return false;
+		}
+	}
+
+public:
+	/// Create a view over serialized data, the data is validated and the position of every field recorded.
+	///
+	/// \return The view if the data holds a valid serialized structure, nullopt otherwise.
+	[[nodiscard]] static constexpr Optional<View> make(const bzd::Span<ByteType> data) noexcept
+	{
+		View view{data};
+		Size offset{0u};
+		const auto success = Fields::apply([&](auto... members) {
+			Size index{0u};
+			return ([&](auto member) {
+				const auto maybeSize =
+					impl::serialization::measure<impl::serialization::MemberPointerType<decltype(member)>>(view.bytes().subSpan(offset));
+				if (!maybeSize)
+				{
+					return false;
+				}
+				view.offsets_[index++] = offset;
+				offset += maybeSize.value();
+				return true;
+			}(members) && ...);
+		});
+		if (!success)
+		{
+			return bzd::nullopt;
+		}
+		view.offsets_[fieldCount] = offset;
+		view.data_ = data.first(offset);
+		return view;
+	}
+
+	/// Read a field.
+	///
+	/// Scalars are decoded, views of bytes (like StringView) point directly into the underlying data,
+	/// nested structures and arrays of fixed size elements return views. Other fields are deserialized.
+	template <auto member>
+	[[nodiscard]] constexpr auto get() const noexcept
+	{
+		using Type = impl::serialization::MemberType<member>;
+		const auto bytes = field<member>();
+		if constexpr (concepts::serializationStructure<Type> && impl::serialization::fixedSize<Type> == 0u)
+		{
+			return View<Type>::make(bytes).value();
+		}
+		else if constexpr (isArrayView<Type>())
+		{
+			return ArrayView<typeTraits::RemoveCVRef<typeTraits::RangeValue<Type>>>{bytes.subSpan(sizeof(UInt32))};
+		}
+		else
+		{
+			Type value{};
+			const auto result = bzd::Serialization<Type>::deserialize(bytes, value);
+			bzd::assert::isTrue(result.hasValue());
+			return value;
+		}
+	}
+
+	/// Overwrite a fixed size field in place.
+	template <auto member>
+	constexpr void set(const impl::serialization::MemberType<member>& value) noexcept
+	requires(isMutable && (impl::serialization::fixedSize<impl::serialization::MemberType<member>> != 0u ||
+						   typeTraits::isSame<impl::serialization::MemberType<member>, bool>))
+	{
+		using Type = impl::serialization::MemberType<member>;
+		constexpr auto index = indexOf<member>();
+		const auto result =
+			bzd::Serialization<Type>::serialize(data_.subSpan(offsets_[index], offsets_[index + 1u] - offsets_[index]), value);
+		bzd::assert::isTrue(result.hasValue());
+	}
+
+	/// The serialized bytes of a field.
+	template <auto member>
+	[[nodiscard]] constexpr bzd::Span<const Byte> field() const noexcept
+	{
+		constexpr auto index = indexOf<member>();
+		static_assert(index < fieldCount, "This member is not a serialized field of the structure.");
+		return bytes().subSpan(offsets_[index], offsets_[index + 1u] - offsets_[index]);
+	}
+
+	/// The serialized bytes of the whole structure.
+	[[nodiscard]] constexpr bzd::Span<const Byte> bytes() const noexcept { return bzd::Span<const Byte>{data_.data(), data_.size()}; }
+
+	/// Size of the serialized structure.
+	[[nodiscard]] constexpr Size size() const noexcept { return data_.size(); }
+
+private:
+	constexpr explicit View(const bzd::Span<ByteType> data) noexcept : data_{data} {}
+
+	bzd::Span<ByteType> data_;
+	Size offsets_[fieldCount + 1u]{};
+};
+
+} // namespace bzd::serialization
@@ -94,6 +94,21 @@ public:
 	{
 		return this->get().compare_exchange_strong(expected, desired, static_cast<::std::memory_order>(order));
 	}
+
+	/// Block the calling thread as long as the value is equal to \b old, until notified.
+	/// Unlike condition variables, spurious wake-ups are handled internally.
+	/// \param old The value to compare against.
+	/// \param order The memory order constraints to enforce.
+	void wait(const T old, const MemoryOrder order = MemoryOrder::sequentiallyConsistent) const noexcept
+	{
+		this->get().wait(old, static_cast<::std::memory_order>(order));
+	}
+
+	/// Unblock at least one thread blocked in wait() on this atomic, if any.
+	void notifyOne() noexcept { this->get().notify_one(); }
+
+	/// Unblock all threads blocked in wait() on this atomic.
+	void notifyAll() noexcept { this->get().notify_all(); }
 };
 
 /// Establishes memory synchronization ordering.
@@ -0,0 +1,186 @@
+#pragma once
+
+#include "cc/bzd/container/span.hh"
+#include "cc/bzd/container/string_view.hh"
+#include "cc/bzd/platform/types.hh"
+
+namespace bzd::platform::coredump {
+
+/// Compact crash dump writer.
+///
+/// The dump contains only raw data (addresses, registers and module load information), it is meant to be
+/// symbolized offline with the binaries that produced it (see `@bzd_python//bzd/apps/minidump`).
+///
+/// It is written into a caller provided buffer, without heap allocation, locks or system calls, so it can be
+/// used from a signal handler. Records that do not fit in the buffer are dropped and the dump is marked as
+/// truncated.
+///
+/// Format, all integers are little endian:
+/// - Header: magic "BZDM" (4 bytes), version (u16), ELF machine (u16), signal (i32), flags (u32).
+/// - A sequence of records: tag (u16), payload size in bytes (u16), payload.
+/// - The end record, with an empty payload.
+class Minidump
+{
+public:
+	static constexpr UInt16 version{1u};
+
+	enum class Tag : UInt16
+	{
+		end = 0,
+		/// A loaded module: load bias (u64), start address (u64), end address (u64), build id size (u8),
+		/// build id, then the path of the module until the end of the payload.
+		module = 1,
+		/// The registers at the time of the crash, as u64, in the order defined for the ELF machine.
+		registers = 2,
+		/// The call stack addresses, as u64, innermost first.
+		frames = 3,
+	};
+
+	enum class Flags : UInt32
+	{
+		none = 0,
+		/// Some records did not fit into the buffer.
+		truncated = 1,
+	};
+
+public:
+	constexpr explicit Minidump(const bzd::Span<Byte> buffer) noexcept : buffer_{buffer} {}
+
+public:
+	/// Start a new dump, this must be called first.
+	///
+	/// \param machine The ELF machine identifier (`e_machine`) of the process.
+	/// \param signal The signal number that triggered the dump.
+	/// \return True if the header fits in the buffer.
+	constexpr Bool header(const UInt16 machine, const Int32 signal) noexcept
+	{
+		size_ = 0u;
+		flags_ = 0u;
+		if (buffer_.size() < headerSize + recordHeaderSize)
+		{
+			return false;
+		}
+		writeBytes("BZDM", 4u);
+		write<UInt16>(version);
+		write<UInt16>(machine);
+		write<UInt32>(static_cast<UInt32>(signal));
+		write<UInt32>(0u);
+		return true;
+	}
+
+	/// Add a loaded module.
+	///
+	/// \param bias The difference between the run-time and the link-time addresses of the module.
+	/// \param start The first address mapped by the module.
+	/// \param end The address following the last one mapped by the module.
+	/// \param buildId The build identifier of the module, to match it against the binary used for symbolization.
+	/// \param path The path of the module at run-time.
+	constexpr Bool module(
+		const UInt64 bias, const UInt64 start, const UInt64 end, const bzd::Span<const Byte> buildId, const bzd::StringView path) noexcept
+	{
+		const auto buildIdSize = (buildId.size() > 255u) ? 255u : buildId.size();
+		const auto size = 3u * sizeof(UInt64) + 1u + buildIdSize + path.size();
+		if (!record(Tag::module, size))
+		{
+			return false;
+		}
+		write<UInt64>(bias);
+		write<UInt64>(start);
+		write<UInt64>(end);
+		write<UInt8>(static_cast<UInt8>(buildIdSize));
+		writeBytes(buildId.data(), buildIdSize);
+		writeBytes(path.data(), path.size());
+		return true;
+	}
+
+	/// Add the registers.
+	constexpr Bool registers(const bzd::Span<const UInt64> values) noexcept { return words(Tag::registers, values.data(), values.size()); }
+
+	/// Add the call stack.
+	Bool frames(const bzd::Span<void* const> addresses) noexcept { return words(Tag::frames, addresses.data(), addresses.size()); }
+
+	/// Terminate the dump.
+	///
+	/// \return The dump, or an empty span if `header` was not successful.
+	constexpr bzd::Span<const Byte> end() noexcept
+	{
+		if (size_ == 0u)
+		{
+			return {};
+		}
+		// Space for the end record is always reserved.
+		write<UInt16>(static_cast<UInt16>(Tag::end));
+		write<UInt16>(0u);
+		// Update the flags in the header.
+		const auto size = size_;
+		size_ = headerSize - sizeof(UInt32);
+		write<UInt32>(flags_);
+		size_ = size;
+		return buffer_.first(size_);
+	}
+
+private:
+	static constexpr Size headerSize{4u + 2u + 2u + 4u + 4u};
+	static constexpr Size recordHeaderSize{2u + 2u};
+
+	/// Start a record, returns false if it does not fit (the end record is always kept available).
+	constexpr Bool record(const Tag tag, const Size size) noexcept
+	{
+		if (size_ == 0u || size > 0xffffu || size_ + 2u * recordHeaderSize + size > buffer_.size())
+		{
+			flags_ |= static_cast<UInt32>(Flags::truncated);
+			return false;
+		}
+		write<UInt16>(static_cast<UInt16>(tag));
+		write<UInt16>(static_cast<UInt16>(size));
+		return true;
+	}
+
+	template <class T>
+	constexpr Bool words(const Tag tag, const T* values, Size count) noexcept
+	{
+		// Keep as many words as possible, the innermost frames are the most relevant.
+		const auto available = (size_ + 2u * recordHeaderSize < buffer_.size()) ? (buffer_.size() - size_ - 2u * recordHeaderSize) : 0u;
+		if (count * sizeof(UInt64) > available)
+		{
+			flags_ |= static_cast<UInt32>(Flags::truncated);
+			count = available / sizeof(UInt64);
+		}
+		if (!record(tag, count * sizeof(UInt64)))
+		{
+			return false;
+		}
+		for (Size i = 0u; i < count; ++i)
+		{
+			write<UInt64>(toWord(values[i]));
+		}
+		return true;
+	}
+
+	static constexpr UInt64 toWord(const UInt64 value) noexcept { return value; }
+	static UInt64 toWord(const void* const value) noexcept { return static_cast<UInt64>(reinterpret_cast<IntPointer>(value)); }
+
+	template <class T>
+	constexpr void write(const T value) noexcept
+	{
+		for (Size i = 0u; i < sizeof(T); ++i)
+		{
+			buffer_[size_++] = static_cast<Byte>((static_cast<UInt64>(value) >> (8u * i)) & 0xffu);
+		}
+	}
+
+	constexpr void writeBytes(const auto* data, const Size size) noexcept
+	{
+		for (Size i = 0u; i < size; ++i)
+		{
+			buffer_[size_++] = static_cast<Byte>(data[i]);
+		}
+	}
+
+private:
+	bzd::Span<Byte> buffer_;
+	Size size_{0u};
+	UInt32 flags_{0u};
+};
+
+} // namespace bzd::platform::coredump
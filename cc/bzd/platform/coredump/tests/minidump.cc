@@ -0,0 +1,88 @@
+#include "cc/bzd/platform/coredump/minidump.hh"
+
+#include "cc/bzd/test/test.hh"
+
+namespace {
+
+bzd::UInt64 readWord(const bzd::Span<const bzd::Byte> data, const bzd::Size offset, const bzd::Size size)
+{
+	bzd::UInt64 value{0u};
+	for (bzd::Size i = 0u; i < size; ++i)
+	{
+		value |= static_cast<bzd::UInt64>(data[offset + i]) << (8u * i);
+	}
+	return value;
+}
+
+} // namespace
+
+TEST(Minidump, Format)
+{
+	bzd::Byte buffer[256];
+	bzd::platform::coredump::Minidump dump{buffer};
+
+	EXPECT_TRUE(dump.header(62u, 11));
+	const bzd::Byte buildId[]{bzd::Byte{0xab}, bzd::Byte{0xcd}};
+	EXPECT_TRUE(dump.module(0x1000u, 0x2000u, 0x3000u, buildId, "/bin/a"_sv));
+	const bzd::UInt64 registers[]{1u, 2u};
+	EXPECT_TRUE(dump.registers(registers));
+	void* const frames[]{reinterpret_cast<void*>(0x2010), reinterpret_cast<void*>(0x2020)};
+	EXPECT_TRUE(dump.frames(frames));
+	const auto data = dump.end();
+
+	// Header.
+	EXPECT_EQ(data[0], bzd::Byte{'B'});
+	EXPECT_EQ(data[3], bzd::Byte{'M'});
+	EXPECT_EQ(readWord(data, 4u, 2u), bzd::platform::coredump::Minidump::version);
+	EXPECT_EQ(readWord(data, 6u, 2u), 62u);
+	EXPECT_EQ(readWord(data, 8u, 4u), 11u);
+	EXPECT_EQ(readWord(data, 12u, 4u), 0u);
+
+	// Module.
+	EXPECT_EQ(readWord(data, 16u, 2u), static_cast<bzd::UInt64>(bzd::platform::coredump::Minidump::Tag::module));
+	EXPECT_EQ(readWord(data, 18u, 2u), 3u * 8u + 1u + 2u + 6u);
+	EXPECT_EQ(readWord(data, 20u, 8u), 0x1000u);
+	EXPECT_EQ(readWord(data, 36u, 8u), 0x3000u);
+	EXPECT_EQ(readWord(data, 44u, 1u), 2u);
+	EXPECT_EQ(data[45], bzd::Byte{0xab});
+	EXPECT_EQ(data[47], bzd::Byte{'/'});
+
+	// Registers and frames.
+	EXPECT_EQ(readWord(data, 53u, 2u), static_cast<bzd::UInt64>(bzd::platform::coredump::Minidump::Tag::registers));
+	EXPECT_EQ(readWord(data, 55u, 2u), 16u);
+	EXPECT_EQ(readWord(data, 65u, 8u), 2u);
+	EXPECT_EQ(readWord(data, 73u, 2u), static_cast<bzd::UInt64>(bzd::platform::coredump::Minidump::Tag::frames));
+	EXPECT_EQ(readWord(data, 77u, 8u), 0x2010u);
+	EXPECT_EQ(readWord(data, 85u, 8u), 0x2020u);
+
+	// End.
+	EXPECT_EQ(readWord(data, 93u, 4u), 0u);
+	EXPECT_EQ(data.size(), 97u);
+}
+
+TEST(Minidump, Truncated)
+{
+	bzd::Byte buffer[64];
+	bzd::platform::coredump::Minidump dump{buffer};
+
+	EXPECT_TRUE(dump.header(62u, 6));
+	EXPECT_FALSE(dump.module(0u, 0u, 0u, {}, "a very long path that does not fit into the buffer"_sv));
+	void* frames[10]{};
+	EXPECT_TRUE(dump.frames(frames));
+	const auto data = dump.end();
+
+	// Only the innermost frames are kept.
+	EXPECT_EQ(readWord(data, 12u, 4u), 1u);
+	EXPECT_EQ(readWord(data, 18u, 2u), 5u * 8u);
+	EXPECT_EQ(data.size(), 64u);
+}
+
+TEST(Minidump, NoHeader)
+{
+	bzd::Byte buffer[8];
+	bzd::platform::coredump::Minidump dump{buffer};
+
+	EXPECT_FALSE(dump.header(62u, 6));
+	EXPECT_FALSE(dump.frames({}));
+	EXPECT_EQ(dump.end().size(), 0u);
+}
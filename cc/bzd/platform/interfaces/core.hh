@@ -10,6 +10,19 @@ using StackSize = bzd::UInt32;
 // Type describing the identifier of a core.
 using CoreId = bzd::UInt8;
 
+// Usage of a core over a sampling period.
+struct CoreUsage
+{
+	// Percentage of the period the core was running on a CPU.
+	bzd::Float32 cpu{0.f};
+	// Percentage of the period the core was processing executables, as opposed to idling or being parked.
+	bzd::Float32 busy{0.f};
+	// Number of voluntary context switches during the period.
+	bzd::UInt32 voluntarySwitches{0u};
+	// Number of involuntary context switches (preemptions) during the period.
+	bzd::UInt32 involuntarySwitches{0u};
+};
+
 class Core
 {
 public:
@@ -27,6 +40,13 @@ public:
 
 	// Get the current core identifier.
 	[[nodiscard]] virtual bzd::CoreId getId() noexcept = 0;
+
+	// Notify whether the core is processing executables or idling, to account for its utilization.
+	// This is called by the executor from the core itself, on transitions only.
+	virtual void setBusy(const bzd::Bool busy) noexcept = 0;
+
+	// Get the usage of the core since the previous call.
+	[[nodiscard]] virtual bzd::Result<bzd::CoreUsage, bzd::Error> getUsage() noexcept = 0;
 };
 
 } // namespace bzd
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "cc/bzd/platform/types.hh"
+
+namespace bzd::platform {
+
+/// Size in bytes of a cache line.
+///
+/// Data accessed concurrently by different cores should be aligned on this
+/// boundary to avoid false sharing.
+inline constexpr bzd::Size cacheLineSize{64u};
+
+/// Hint the processor that the caller is in a spin-wait loop.
+///
+/// This reduces the power consumption and the memory order violations when
+/// leaving the loop, and frees resources for a sibling hardware thread.
+inline void relax() noexcept
+{
+#if defined(__x86_64__) || defined(__i386__)
+	__builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+	asm volatile("yield" ::: "memory");
+#else
+	asm volatile("" ::: "memory");
+#endif
+}
+
+/// Read the cycle counter of the processor.
+///
+/// It is a monotonic counter incremented at a constant rate, meant to time short sections of code.
+/// Its frequency is not known (the nominal processor frequency on x86, a lower fixed one on aarch64),
+/// it must be calibrated against a clock. Returns 0 if the architecture does not provide such counter.
+inline UInt64 readCycleCounter() noexcept
+{
+#if defined(__x86_64__) || defined(__i386__)
+	// Wait for the previous instructions to complete before reading the counter.
+	__builtin_ia32_lfence();
+	return __builtin_ia32_rdtsc();
+#elif defined(__aarch64__)
+	UInt64 value;
+	asm volatile("isb; mrs %0, cntvct_el0" : "=r"(value)::"memory");
+	return value;
+#else
+	return 0u;
+#endif
+}
+
+} // namespace bzd::platform
@@ -0,0 +1,52 @@
+#include "cc/bzd/test/test_internal.hh"
+
+#include <cstdlib>
+#include <new>
+
+// Replace the global allocation functions to count the heap allocations of the benchmarks.
+
+namespace {
+[[maybe_unused]] const bool isRegistered = (::bzd::test::impl::isAllocationCounted = true);
+
+void* allocate(const std::size_t size)
+{
+	::bzd::test::impl::allocationCount.fetchAdd(1u, ::bzd::MemoryOrder::relaxed);
+	return std::malloc((size) ? size : 1u);
+}
+
+void* allocate(const std::size_t size, const std::align_val_t alignment)
+{
+	::bzd::test::impl::allocationCount.fetchAdd(1u, ::bzd::MemoryOrder::relaxed);
+	const auto align = static_cast<std::size_t>(alignment);
+	// The size must be a multiple of the alignment.
+	return std::aligned_alloc(align, ((size + align - 1u) / align) * align);
+}
+
+template <class... Args>
+void* allocateOrThrow(Args... args)
+{
+	if (auto* ptr = allocate(args...); ptr)
+	{
+		return ptr;
+	}
+	throw std::bad_alloc{};
+}
+} // namespace
+
+void* operator new(std::size_t size) { return allocateOrThrow(size); }
+void* operator new[](std::size_t size) { return allocateOrThrow(size); }
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept { return allocate(size); }
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return allocate(size); }
+void* operator new(std::size_t size, std::align_val_t alignment) { return allocateOrThrow(size, alignment); }
+void* operator new[](std::size_t size, std::align_val_t alignment) { return allocateOrThrow(size, alignment); }
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return allocate(size, alignment); }
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return allocate(size, alignment); }
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept { std::free(ptr); }
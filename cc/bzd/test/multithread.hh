@@ -1,8 +1,118 @@
 #pragma once
 
+#include "cc/bzd/platform/atomic.hh"
 #include "cc/bzd/test/test.hh"
+#include "cc/bzd/utility/move.hh"
 
 #include <thread>
+#include <vector>
 
 /// Run a coroutine-based test in an asynchronous context using a multithreaded executor.
 #define TEST_ASYNC_MULTITHREAD(testCaseName, testName, nbThreads) BZDTEST_ASYNC_MULTITHREAD_(testCaseName, testName, nbThreads)
+
+/// Defines a coroutine-based benchmark, run in an asynchronous context using a multithreaded executor.
+///
+/// The benchmark loop runs on one of the executor threads, the work it schedules can be executed by all of them.
+#define BENCHMARK_ASYNC_MULTITHREAD(testCaseName, testName, nbThreads)                                                                     \
+	BZDTEST_BENCHMARK_ASYNC_MULTITHREAD_(testCaseName, testName, nbThreads)
+
+#define BZDTEST_BENCHMARK_ASYNC_MULTITHREAD_(testCaseName, testName, nbThreads)                                                            \
+	::bzd::Async<> BZDTEST_FCT_NAME_(testCaseName, testName)(auto&, ::bzd::test::Benchmark&);                                              \
+	BZDTEST_ASYNC_MULTITHREAD_(testCaseName, testName, nbThreads)                                                                          \
+	{                                                                                                                                      \
+		::bzd::test::Benchmark benchmark{test};                                                                                            \
+		while (benchmark.next())                                                                                                           \
+		{                                                                                                                                  \
+			co_await !BZDTEST_FCT_NAME_(testCaseName, testName)(test, benchmark);                                                          \
+		}                                                                                                                                  \
+		co_return {};                                                                                                                      \
+	}                                                                                                                                      \
+	::bzd::Async<> BZDTEST_FCT_NAME_(testCaseName, testName)([[maybe_unused]] auto& test,                                                  \
+															 [[maybe_unused]] ::bzd::test::Benchmark& benchmark)
+
+namespace bzd::test {
+
+/// Threads running a workload concurrently, to measure contention in benchmarks.
+///
+/// Each call to `run()` executes the workload once on every thread, and returns when all of them are done.
+/// In between, the threads wait on a generation counter, so they all start at the same time. The cost of this
+/// synchronization is amortized by giving each thread a batch of operations to perform.
+///
+/// \code
+/// bzd::test::Workers workers{4u, [&](const bzd::Size index) { ... }};
+/// for (auto _ : benchmark)
+/// {
+///     workers.run();
+/// }
+/// \endcode
+template <class Workload>
+class Workers
+{
+public:
+	Workers(const bzd::Size count, Workload workload) noexcept : workload_{bzd::move(workload)}
+	{
+		for (bzd::Size index = 0u; index < count; ++index)
+		{
+			threads_.emplace_back([this, index]() { loop(index); });
+		}
+	}
+
+	Workers(const Workers&) = delete;
+	Workers& operator=(const Workers&) = delete;
+	Workers(Workers&&) = delete;
+	Workers& operator=(Workers&&) = delete;
+
+	~Workers() noexcept
+	{
+		isTerminated_.store(true);
+		++generation_;
+		for (auto& thread : threads_)
+		{
+			thread.join();
+		}
+	}
+
+public:
+	/// Number of threads.
+	[[nodiscard]] bzd::Size size() const noexcept { return threads_.size(); }
+
+	/// Run the workload once on every thread and wait for completion.
+	void run() noexcept
+	{
+		remaining_.store(threads_.size());
+		++generation_;
+		while (remaining_.load() != 0u)
+		{
+			::std::this_thread::yield();
+		}
+	}
+
+private:
+	void loop(const bzd::Size index) noexcept
+	{
+		bzd::UInt64 generation{0u};
+		while (true)
+		{
+			while (generation_.load() == generation)
+			{
+				::std::this_thread::yield();
+			}
+			generation = generation_.load();
+			if (isTerminated_.load())
+			{
+				return;
+			}
+			workload_(index);
+			--remaining_;
+		}
+	}
+
+private:
+	Workload workload_;
+	::std::vector<::std::thread> threads_{};
+	bzd::Atomic<bzd::UInt64> generation_{0u};
+	bzd::Atomic<bzd::Size> remaining_{0u};
+	bzd::Atomic<bzd::Bool> isTerminated_{false};
+};
+
+} // namespace bzd::test
@@ -1,17 +1,213 @@
 #include "cc/bzd/test/test.hh"
 
 #include "cc/bzd/core/print.hh"
+#include "cc/bzd/platform/processor.hh"
 
 // Empty namespace to hold all the registered tests
 namespace {
 bzd::test::TestNode nodeRoot{};
 bzd::OStream* maybeOut{};
+
+/// Number of cycles per nanosecond of the cycle counter, calibrated once against the timer.
+bzd::Float64 getCyclesPerNs(bzd::Timer& timer) noexcept
+{
+	static bzd::Float64 cyclesPerNs{-1.};
+	if (cyclesPerNs < 0.)
+	{
+		cyclesPerNs = 0.;
+		if (bzd::platform::readCycleCounter() == 0u || !timer.getTime())
+		{
+			return cyclesPerNs;
+		}
+		const auto getTimeMs = [&timer]() { return timer.getTime().value().get(); };
+		// Start right after a tick of the timer, to reduce the error due to its resolution.
+		const auto time = getTimeMs();
+		while (getTimeMs() == time)
+		{
+		}
+		const auto cyclesStart = bzd::platform::readCycleCounter();
+		const auto timeStart = getTimeMs();
+		while (getTimeMs() < timeStart + 20u)
+		{
+		}
+		const auto cycles = bzd::platform::readCycleCounter() - cyclesStart;
+		cyclesPerNs = static_cast<bzd::Float64>(cycles) / (static_cast<bzd::Float64>(getTimeMs() - timeStart) * 1e6);
+	}
+	return cyclesPerNs;
+}
+
+/// Sort in place a small array.
+void sort(bzd::Float64* const values, const bzd::Size size) noexcept
+{
+	for (bzd::Size i = 1u; i < size; ++i)
+	{
+		for (bzd::Size j = i; j > 0u && values[j] < values[j - 1u]; --j)
+		{
+			const auto temp = values[j];
+			values[j] = values[j - 1u];
+			values[j - 1u] = temp;
+		}
+	}
+}
+
+/// Print a positive number with 3 decimals, the floating point formatting is not meant for JSON.
+void printNumber(bzd::OStream& out, const bzd::Float64 value)
+{
+	const auto milli = static_cast<bzd::UInt64>(value * 1000. + 0.5);
+	::bzd::printNoLock(out, "{}.{}{}{}"_csv, milli / 1000u, (milli / 100u) % 10u, (milli / 10u) % 10u, milli % 10u).sync();
+}
 } // namespace
 
+namespace bzd::test::impl {
+::bzd::Atomic<::bzd::UInt64> allocationCount{0u};
+::bzd::Bool isAllocationCounted{false};
+} // namespace bzd::test::impl
+
 namespace bzd::test {
 
 bzd::test::TestNode* nodeCurrent{&nodeRoot};
 
+Benchmark::Benchmark(Context& context) noexcept : context_{context}, cyclesPerNs_{getCyclesPerNs(context.timer())} {}
+
+bzd::UInt64 Benchmark::getTicks() noexcept
+{
+	if (cyclesPerNs_ > 0.)
+	{
+		return bzd::platform::readCycleCounter();
+	}
+	const auto maybeTime = context_.timer().getTime();
+	return (maybeTime) ? static_cast<bzd::UInt64>(maybeTime.value().get()) * 1000000u : 0u;
+}
+
+bzd::Bool Benchmark::next() noexcept
+{
+	if (!isStarted_)
+	{
+		isStarted_ = true;
+		return true;
+	}
+	if (phase_ == Phase::done)
+	{
+		return false;
+	}
+	if (!isMeasured_)
+	{
+		Manager::getInstance().fail(__FILE__, __LINE__, "Failure\nThe benchmark body must loop over `benchmark`.");
+		return false;
+	}
+	isMeasured_ = false;
+
+	const auto ns = static_cast<bzd::Float64>(ticks_) / ((cyclesPerNs_ > 0.) ? cyclesPerNs_ : 1.);
+	switch (phase_)
+	{
+	case Phase::warmup:
+		warmupNsTotal_ += ns;
+		if (warmupNsTotal_ < warmupNs && iterations_ < maxIterations)
+		{
+			// Grow faster while the runs are too short to be measured accurately.
+			iterations_ *= (ns < warmupNs / 100.) ? 10u : 2u;
+			iterations_ = (iterations_ < maxIterations) ? iterations_ : maxIterations;
+			return true;
+		}
+		{
+			// Scale the number of iterations to match the targeted duration of a sample.
+			const auto nsPerIteration = ns / static_cast<bzd::Float64>(iterations_);
+			const auto iterations = (nsPerIteration > 0.) ? sampleNs / nsPerIteration : static_cast<bzd::Float64>(maxIterations);
+			iterations_ = (iterations < 1.) ? 1u : (iterations > maxIterations) ? maxIterations : static_cast<bzd::Size>(iterations);
+		}
+		phase_ = Phase::sampling;
+		return true;
+	case Phase::sampling:
+		samples_[sampleIndex_] = ns / static_cast<bzd::Float64>(iterations_);
+		cycles_[sampleIndex_] = static_cast<bzd::Float64>(ticks_) / static_cast<bzd::Float64>(iterations_);
+		allocationsTotal_ += allocations_;
+		if (++sampleIndex_ < sampleCount)
+		{
+			return true;
+		}
+		phase_ = Phase::done;
+		sort(cycles_, sampleCount);
+		Manager::getInstance().benchmark(BenchmarkResult{
+			.iterations = iterations_,
+			.samples = bzd::Span<const bzd::Float64>{samples_, sampleCount},
+			.cycles = (cyclesPerNs_ > 0.) ? cycles_[sampleCount / 2u] : 0.,
+			.allocations = (impl::isAllocationCounted)
+							   ? static_cast<bzd::Float64>(allocationsTotal_) / static_cast<bzd::Float64>(iterations_ * sampleCount)
+							   : -1.,
+			.bytes = bytes_,
+			.items = items_,
+			.metrics = bzd::Span<const BenchmarkMetric>{metrics_, metricCount_},
+		});
+		[[fallthrough]];
+	case Phase::done:
+		break;
+	}
+	return false;
+}
+
+void Manager::benchmark(const BenchmarkResult& result)
+{
+	auto& out = *::maybeOut;
+	auto scope = out.getLock().sync();
+
+	bzd::Float64 sorted[Benchmark::sampleCount];
+	bzd::Float64 mean{0.};
+	for (bzd::Size i = 0u; i < result.samples.size(); ++i)
+	{
+		sorted[i] = result.samples[i];
+		mean += result.samples[i];
+	}
+	mean /= static_cast<bzd::Float64>(result.samples.size());
+	sort(sorted, result.samples.size());
+	const auto median = sorted[result.samples.size() / 2u];
+
+	// Single line JSON, to be extracted from the test logs for regression tracking.
+	::bzd::printNoLock(out, "[ BENCHMARK] {{\"name\": \"{}.{}"_csv, currentNode_->info->testCaseName, currentNode_->info->testName).sync();
+	if (currentNode_->variant.size())
+	{
+		::bzd::printNoLock(out, ".{}"_csv, currentNode_->variant).sync();
+	}
+	::bzd::printNoLock(out, "\", \"iterations\": {}, \"samples\": ["_csv, result.iterations).sync();
+	for (bzd::Size i = 0u; i < result.samples.size(); ++i)
+	{
+		::bzd::printNoLock(out, (i) ? ", "_sv : ""_sv).sync();
+		printNumber(out, result.samples[i]);
+	}
+	::bzd::printNoLock(out, "], \"median\": "_sv).sync();
+	printNumber(out, median);
+	::bzd::printNoLock(out, ", \"mean\": "_sv).sync();
+	printNumber(out, mean);
+	::bzd::printNoLock(out, ", \"min\": "_sv).sync();
+	printNumber(out, sorted[0]);
+	::bzd::printNoLock(out, ", \"cycles\": "_sv).sync();
+	printNumber(out, result.cycles);
+	::bzd::printNoLock(out, ", \"allocations\": "_sv).sync();
+	if (result.allocations < 0.)
+	{
+		::bzd::printNoLock(out, "null"_sv).sync();
+	}
+	else
+	{
+		printNumber(out, result.allocations);
+	}
+	if (result.bytes)
+	{
+		::bzd::printNoLock(out, ", \"bytesPerSecond\": "_sv).sync();
+		printNumber(out, static_cast<bzd::Float64>(result.bytes) * 1e9 / median);
+	}
+	if (result.items)
+	{
+		::bzd::printNoLock(out, ", \"itemsPerSecond\": "_sv).sync();
+		printNumber(out, static_cast<bzd::Float64>(result.items) * 1e9 / median);
+	}
+	for (const auto& metric : result.metrics)
+	{
+		::bzd::printNoLock(out, ", \"{}\": "_csv, metric.name).sync();
+		printNumber(out, metric.value);
+	}
+	::bzd::printNoLock(out, "}\n"_sv).sync();
+}
+
 void Manager::failInternals(
 	const char* const file, const bzd::Int32 line, const char* const message, const char* actual, const char* expected)
 {
@@ -65,6 +261,7 @@ bzd::Async<bool> bzd::test::Manager::run(bzd::OStream& out, bzd::Timer& timer, b
 		co_await !::bzd::print(out, " (seed={})\n"_csv, seed);
 
 		currentTestFailed_ = false;
+		currentNode_ = node;
 		const auto maybeTimeStart = timer.getTime();
 		try
 		{
@@ -13,6 +13,17 @@
 /// Run a coroutine-based test in an asynchronous context.
 #define TEST_ASYNC(...) BZD_GET_MACRO(BZDTEST_ASYNC_, __VA_ARGS__)(__VA_ARGS__)
 
+/// Defines a benchmark, measuring the loop over the `benchmark` variable within its body.
+/// The results are reported as a single line JSON, see README.md.
+///
+/// \param testCaseName The test case name.
+/// \param testName The test name.
+/// \param typeList The type list for template benchmarks.
+#define BENCHMARK(...) BZD_GET_MACRO(BZDTEST_BENCHMARK_, __VA_ARGS__)(__VA_ARGS__)
+
+/// Defines a coroutine-based benchmark, run in an asynchronous context.
+#define BENCHMARK_ASYNC(...) BZD_GET_MACRO(BZDTEST_BENCHMARK_ASYNC_, __VA_ARGS__)(__VA_ARGS__)
+
 /// Executes a test case at compile time.
 /// \{
 #define TEST_CONSTEXPR_BEGIN(testCaseName, testName) BZDTEST_CONSTEXPR_BEGIN_(testCaseName, testName)
@@ -4,6 +4,7 @@
 #include "cc/bzd/container/ring_buffer.hh"
 #include "cc/bzd/core/async.hh"
 #include "cc/bzd/meta/macro.hh"
+#include "cc/bzd/platform/atomic.hh"
 #include "cc/bzd/test/runner.hh"
 #include "cc/bzd/type_traits/is_same_class.hh"
 #include "cc/bzd/type_traits/range.hh"
@@ -132,6 +133,80 @@
 	}                                                                                                                                      \
 	::bzd::Async<> BZDTEST_FCT_NAME_(testCaseName, testName)([[maybe_unused]] auto& test)
 
+#define BZDTEST_BENCHMARK_2(testCaseName, testName)                                                                                        \
+	BZDTEST_REGISTER_(testCaseName, testName, void)                                                                                        \
+	void BZDTEST_FCT_NAME_(testCaseName, testName)(auto&, ::bzd::test::Benchmark&);                                                        \
+	void BZDTEST_CLASS_NAME_(testCaseName, testName)::test(auto& test) const                                                               \
+	{                                                                                                                                      \
+		::bzd::test::Benchmark benchmark{test};                                                                                            \
+		while (benchmark.next())                                                                                                           \
+		{                                                                                                                                  \
+			BZDTEST_FCT_NAME_(testCaseName, testName)(test, benchmark);                                                                    \
+		}                                                                                                                                  \
+	}                                                                                                                                      \
+	void BZDTEST_FCT_NAME_(testCaseName, testName)([[maybe_unused]] auto& test, [[maybe_unused]] ::bzd::test::Benchmark& benchmark)
+
+#define BZDTEST_BENCHMARK_3(testCaseName, testName, typeList)                                                                              \
+	BZDTEST_TEMPLATE_REGISTER_(testCaseName, testName, typeList, void)                                                                     \
+	template <class TestType>                                                                                                              \
+	void BZDTEST_FCT_NAME_(testCaseName, testName)(auto&, ::bzd::test::Benchmark&);                                                        \
+	template <class... Types>                                                                                                              \
+	template <class TestType>                                                                                                              \
+	void BZDTEST_CLASS_NAME_(testCaseName, testName)<Types...>::test(auto& test) const                                                     \
+	{                                                                                                                                      \
+		::bzd::test::Benchmark benchmark{test};                                                                                            \
+		while (benchmark.next())                                                                                                           \
+		{                                                                                                                                  \
+			BZDTEST_FCT_NAME_(testCaseName, testName)<TestType>(test, benchmark);                                                          \
+		}                                                                                                                                  \
+	}                                                                                                                                      \
+	template <class TestType>                                                                                                              \
+	void BZDTEST_FCT_NAME_(testCaseName, testName)([[maybe_unused]] auto& test, [[maybe_unused]] ::bzd::test::Benchmark& benchmark)
+
+#define BZDTEST_BENCHMARK_ASYNC_2(testCaseName, testName)                                                                                  \
+	BZDTEST_REGISTER_(testCaseName, testName, ::bzd::Async<>)                                                                              \
+	::bzd::Async<> BZDTEST_FCT_NAME_(testCaseName, testName)(auto&, ::bzd::test::Benchmark&);                                              \
+	::bzd::Async<> BZDTEST_CLASS_NAME_(testCaseName, testName)::test(auto& test) const                                                     \
+	{                                                                                                                                      \
+		::bzd::test::Benchmark benchmark{test};                                                                                            \
+		while (benchmark.next())                                                                                                           \
+		{                                                                                                                                  \
+			const auto result = co_await BZDTEST_FCT_NAME_(testCaseName, testName)(test, benchmark);                                       \
+			if (!static_cast<bool>(result))                                                                                                \
+			{                                                                                                                              \
+				BZDTEST_FAIL_MESSAGE_("Failure\nUnhandled failure from async.", result.error().getMessage().data());                       \
+				co_return {};                                                                                                              \
+			}                                                                                                                              \
+		}                                                                                                                                  \
+		co_return {};                                                                                                                      \
+	}                                                                                                                                      \
+	::bzd::Async<> BZDTEST_FCT_NAME_(testCaseName, testName)([[maybe_unused]] auto& test,                                                  \
+															 [[maybe_unused]] ::bzd::test::Benchmark& benchmark)
+
+#define BZDTEST_BENCHMARK_ASYNC_3(testCaseName, testName, typeList)                                                                        \
+	BZDTEST_TEMPLATE_REGISTER_(testCaseName, testName, typeList, ::bzd::Async<>)                                                           \
+	template <class TestType>                                                                                                              \
+	::bzd::Async<> BZDTEST_FCT_NAME_(testCaseName, testName)(auto&, ::bzd::test::Benchmark&);                                              \
+	template <class... Types>                                                                                                              \
+	template <class TestType>                                                                                                              \
+	::bzd::Async<> BZDTEST_CLASS_NAME_(testCaseName, testName)<Types...>::test(auto& test) const                                           \
+	{                                                                                                                                      \
+		::bzd::test::Benchmark benchmark{test};                                                                                            \
+		while (benchmark.next())                                                                                                           \
+		{                                                                                                                                  \
+			const auto result = co_await BZDTEST_FCT_NAME_(testCaseName, testName)<TestType>(test, benchmark);                             \
+			if (!static_cast<bool>(result))                                                                                                \
+			{                                                                                                                              \
+				BZDTEST_FAIL_MESSAGE_("Failure\nUnhandled failure from async.", result.error().getMessage().data());                       \
+				co_return {};                                                                                                              \
+			}                                                                                                                              \
+		}                                                                                                                                  \
+		co_return {};                                                                                                                      \
+	}                                                                                                                                      \
+	template <class TestType>                                                                                                              \
+	::bzd::Async<> BZDTEST_FCT_NAME_(testCaseName, testName)([[maybe_unused]] auto& test,                                                  \
+															 [[maybe_unused]] ::bzd::test::Benchmark& benchmark)
+
 #define BZDTEST_CONSTEXPR_BEGIN_(testCaseName, testName)                                                                                   \
 	BZDTEST_REGISTER_(testCaseName, testName, void)                                                                                        \
 	constexpr void BZDTEST_FCT_NAME_(testCaseName, testName)(auto&);                                                                       \
@@ -552,6 +627,207 @@ private:
 	bzd::test::Runner* runner_{nullptr};
 };
 
+/// Prevent the compiler from optimizing away a value or the computation producing it.
+///
+/// \param value The value to be considered as used.
+template <class T>
+inline void doNotOptimize(const T& value) noexcept
+{
+	asm volatile("" : : "r,m"(value) : "memory");
+}
+
+template <class T>
+inline void doNotOptimize(T& value) noexcept
+{
+	asm volatile("" : "+m"(value) : : "memory");
+}
+
+/// Force all pending memory writes to be considered as performed.
+inline void clobberMemory() noexcept { asm volatile("" : : : "memory"); }
+
+namespace impl {
+/// Number of heap allocations performed, only counted if `//cc/bzd/test:allocation_counter` is linked.
+extern ::bzd::Atomic<::bzd::UInt64> allocationCount;
+/// Whether allocations are counted.
+extern ::bzd::Bool isAllocationCounted;
+} // namespace impl
+
+/// Additional measurement of a benchmark, set by its body.
+struct BenchmarkMetric
+{
+	bzd::StringView name;
+	bzd::Float64 value;
+};
+
+/// Measurements of a benchmark, all per iteration.
+struct BenchmarkResult
+{
+	/// Number of iterations timed in each sample.
+	bzd::Size iterations;
+	/// Time of each sample, in nanoseconds.
+	bzd::Span<const bzd::Float64> samples;
+	/// Median of the samples, in processor cycles, 0 if there is no cycle counter.
+	bzd::Float64 cycles;
+	/// Number of heap allocations, negative if not counted.
+	bzd::Float64 allocations;
+	/// Number of bytes processed, 0 if not set.
+	bzd::Size bytes;
+	/// Number of items processed, 0 if not set.
+	bzd::Size items;
+	/// Additional measurements, not per iteration.
+	bzd::Span<const BenchmarkMetric> metrics;
+};
+
+/// Measure the body of a benchmark.
+///
+/// The body is run multiple times, first to warm up and to estimate the duration of an iteration,
+/// then to collect `sampleCount` samples of an auto-scaled number of iterations each. Only the
+/// loop over this object is timed:
+/// \code
+/// BENCHMARK(Suite, Name)
+/// {
+///     auto data = makeData(); // Not timed.
+///     for (auto _ : benchmark)
+///     {
+///         bzd::test::doNotOptimize(process(data));
+///     }
+/// }
+/// \endcode
+class Benchmark
+{
+public:
+	/// Number of samples collected.
+	static constexpr bzd::Size sampleCount{10u};
+	/// Minimal duration of the warmup, in nanoseconds.
+	static constexpr bzd::Float64 warmupNs{50e6};
+	/// Targeted duration of a sample, in nanoseconds.
+	static constexpr bzd::Float64 sampleNs{10e6};
+	/// Maximum number of iterations per sample.
+	static constexpr bzd::Size maxIterations{1000000000u};
+	/// Maximum number of additional measurements.
+	static constexpr bzd::Size maxMetrics{4u};
+
+	class Sentinel
+	{
+	};
+
+	/// Value of the iterations, the user-provided constructor and destructor prevent unused variable warnings.
+	class Value
+	{
+	public:
+		constexpr Value() noexcept {}
+		constexpr ~Value() noexcept {}
+	};
+
+	class Iterator
+	{
+	public:
+		constexpr Iterator(Benchmark& benchmark, const bzd::Size remaining) noexcept : benchmark_{benchmark}, remaining_{remaining} {}
+		constexpr Value operator*() const noexcept { return Value{}; }
+		constexpr Iterator& operator++() noexcept
+		{
+			--remaining_;
+			return *this;
+		}
+		constexpr bzd::Bool operator!=(const Sentinel) noexcept
+		{
+			if (remaining_ != 0u) [[likely]]
+			{
+				return true;
+			}
+			benchmark_.stop();
+			return false;
+		}
+
+	private:
+		Benchmark& benchmark_;
+		bzd::Size remaining_;
+	};
+
+public:
+	explicit Benchmark(Context& context) noexcept;
+
+	/// Start timing the iterations.
+	[[nodiscard]] Iterator begin() noexcept
+	{
+		isMeasured_ = false;
+		allocationsStart_ = impl::allocationCount.load(MemoryOrder::relaxed);
+		ticksStart_ = getTicks();
+		return Iterator{*this, iterations_};
+	}
+	[[nodiscard]] constexpr Sentinel end() const noexcept { return Sentinel{}; }
+
+	/// Number of iterations of the current run.
+	[[nodiscard]] constexpr bzd::Size iterations() const noexcept { return iterations_; }
+
+	/// Set the number of bytes processed by an iteration, to report the throughput.
+	constexpr void setBytesPerIteration(const bzd::Size bytes) noexcept { bytes_ = bytes; }
+	/// Set the number of items processed by an iteration, to report the throughput.
+	constexpr void setItemsPerIteration(const bzd::Size items) noexcept { items_ = items; }
+	/// Set an additional measurement to be reported, for values that are not a time per iteration, like the
+	/// percentile of a latency. The last value set is reported, the name must outlive the benchmark.
+	constexpr void setMetric(const bzd::StringView name, const bzd::Float64 value) noexcept
+	{
+		for (bzd::Size i = 0u; i < metricCount_; ++i)
+		{
+			if (metrics_[i].name == name)
+			{
+				metrics_[i].value = value;
+				return;
+			}
+		}
+		if (metricCount_ < maxMetrics)
+		{
+			metrics_[metricCount_++] = BenchmarkMetric{name, value};
+		}
+	}
+
+	/// Process the previous run and prepare the next one.
+	///
+	/// \return False when the measurements are completed, after reporting them.
+	bzd::Bool next() noexcept;
+
+private:
+	enum class Phase : bzd::UInt8
+	{
+		warmup,
+		sampling,
+		done
+	};
+
+	void stop() noexcept
+	{
+		ticks_ = getTicks() - ticksStart_;
+		allocations_ = impl::allocationCount.load(MemoryOrder::relaxed) - allocationsStart_;
+		isMeasured_ = true;
+	}
+
+	/// Current time in ticks, cycles if there is a cycle counter, nanoseconds otherwise.
+	bzd::UInt64 getTicks() noexcept;
+
+private:
+	Context& context_;
+	/// Number of cycles per nanosecond, 0 if there is no cycle counter.
+	bzd::Float64 cyclesPerNs_;
+	Phase phase_{Phase::warmup};
+	bzd::Bool isStarted_{false};
+	bzd::Bool isMeasured_{false};
+	bzd::Size iterations_{1u};
+	bzd::UInt64 ticksStart_{0u};
+	bzd::UInt64 ticks_{0u};
+	bzd::Float64 warmupNsTotal_{0.};
+	bzd::UInt64 allocationsStart_{0u};
+	bzd::UInt64 allocations_{0u};
+	bzd::UInt64 allocationsTotal_{0u};
+	bzd::Float64 cycles_[sampleCount]{};
+	bzd::Float64 samples_[sampleCount]{};
+	bzd::Size sampleIndex_{0u};
+	bzd::Size bytes_{0u};
+	bzd::Size items_{0u};
+	BenchmarkMetric metrics_[maxMetrics]{};
+	bzd::Size metricCount_{0u};
+};
+
 /// Convert a type into a string view at compile type.
 template <class T>
 constexpr auto typeToString()
@@ -724,6 +1000,9 @@ public:
 
 	void fail(const char* const file, const bzd::Int32 line, const char* const message) { failInternals(file, line, message); }
 
+	/// Report the measurements of the current benchmark.
+	void benchmark(const BenchmarkResult& result);
+
 private:
 	void failInternals(const char* const file,
 					   const bzd::Int32 line,
@@ -734,6 +1013,7 @@ private:
 private:
 	Manager() = default;
 	bool currentTestFailed_ = false;
+	TestNode* currentNode_{nullptr};
 };
 
 class Runner
@@ -0,0 +1,52 @@
+#include "cc/bzd/test/test.hh"
+
+BENCHMARK(Benchmark, Sync)
+{
+	bzd::UInt64 value{0u};
+	for (auto _ : benchmark)
+	{
+		++value;
+		bzd::test::doNotOptimize(value);
+	}
+}
+
+BENCHMARK_ASYNC(Benchmark, Async)
+{
+	for (auto _ : benchmark)
+	{
+		co_await bzd::async::yield();
+	}
+	co_return {};
+}
+
+BENCHMARK(Benchmark, Template, (bzd::UInt8, bzd::UInt64))
+{
+	TestType value{0u};
+	benchmark.setItemsPerIteration(1u);
+	benchmark.setBytesPerIteration(sizeof(TestType));
+	for (auto _ : benchmark)
+	{
+		value += 1u;
+		bzd::test::clobberMemory();
+	}
+	bzd::test::doNotOptimize(value);
+}
+
+TEST(Benchmark, Protocol)
+{
+	bzd::test::Benchmark benchmark{test};
+	bzd::Size nbRuns{0u};
+	bzd::Size iterations{0u};
+	while (benchmark.next())
+	{
+		++nbRuns;
+		for (auto _ : benchmark)
+		{
+			++iterations;
+		}
+	}
+	EXPECT_GT(nbRuns, bzd::test::Benchmark::sampleCount);
+	EXPECT_GT(iterations, nbRuns);
+	// All calls once completed return false.
+	EXPECT_FALSE(benchmark.next());
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+#include "cc/bzd/type_traits/integral_constant.hh"
+#include "cc/bzd/type_traits/remove_cv.hh"
+
+namespace bzd::typeTraits::impl {
+template <class T>
+struct IsFinal : public bzd::typeTraits::IntegralConstant<bool, __is_final(RemoveCV<T>)>
+{
+};
+} // namespace bzd::typeTraits::impl
+
+namespace bzd::typeTraits {
+template <class T>
+using IsFinal = typename impl::IsFinal<T>;
+
+template <class T>
+inline constexpr bool isFinal = IsFinal<T>::value;
+} // namespace bzd::typeTraits
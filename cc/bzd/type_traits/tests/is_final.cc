@@ -0,0 +1,30 @@
+#include "cc/bzd/type_traits/is_final.hh"
+
+#include "cc/bzd/test/test.hh"
+
+TEST(TypeTraits, isFinal)
+{
+	{
+		const bool result = bzd::typeTraits::isFinal<int>;
+		EXPECT_FALSE(result);
+	}
+	{
+		struct Base
+		{
+			virtual ~Base() = default;
+		};
+		const bool result = bzd::typeTraits::isFinal<Base>;
+		EXPECT_FALSE(result);
+	}
+	{
+		struct Base
+		{
+			virtual ~Base() = default;
+		};
+		struct Derived final : public Base
+		{
+		};
+		const bool result = bzd::typeTraits::isFinal<const Derived>;
+		EXPECT_TRUE(result);
+	}
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "cc/bzd/platform/types.hh"
+#include "cc/bzd/type_traits/is_integral.hh"
+
+namespace bzd {
+
+/// Reverses the bytes of an integral value.
+///
+/// \param value The value to be used.
+/// \return The value with its byte order reversed.
+template <concepts::integral T>
+constexpr T byteSwap(const T value) noexcept
+{
+	if constexpr (sizeof(T) == 1u)
+	{
+		return value;
+	}
+	else if constexpr (sizeof(T) == 2u)
+	{
+		return static_cast<T>(__builtin_bswap16(static_cast<UInt16>(value)));
+	}
+	else if constexpr (sizeof(T) == 4u)
+	{
+		return static_cast<T>(__builtin_bswap32(static_cast<UInt32>(value)));
+	}
+	else
+	{
+		static_assert(sizeof(T) == 8u, "Unsupported integer size.");
+		return static_cast<T>(__builtin_bswap64(static_cast<UInt64>(value)));
+	}
+}
+
+} // namespace bzd
@@ -0,0 +1,95 @@
+#pragma once
+
+#include "cc/bzd/container/string_view.hh"
+#include "cc/bzd/platform/types.hh"
+#include "cc/bzd/type_traits/is_enum.hh"
+#include "cc/bzd/type_traits/is_integral.hh"
+#include "cc/bzd/type_traits/is_pointer.hh"
+#include "cc/bzd/type_traits/range.hh"
+#include "cc/bzd/utility/to_underlying.hh"
+
+namespace bzd::impl {
+
+/// Finalizer of splitmix64, it spreads the entropy of all the bits of the input to all the bits of the output.
+constexpr UInt64 hashMix(UInt64 value) noexcept
+{
+	value ^= value >> 30u;
+	value *= 0xbf58476d1ce4e5b9ull;
+	value ^= value >> 27u;
+	value *= 0x94d049bb133111ebull;
+	value ^= value >> 31u;
+	return value;
+}
+
+/// Hash a sequence of bytes, 8 bytes at a time.
+template <class Iterator>
+constexpr UInt64 hashBytes(Iterator it, const Size size, const UInt64 seed) noexcept
+{
+	UInt64 hash = hashMix(seed ^ (0x9e3779b97f4a7c15ull * (size + 1u)));
+	Size index{0u};
+	for (; index + 8u <= size; index += 8u)
+	{
+		UInt64 chunk{0u};
+		for (Size shift = 0u; shift < 64u; shift += 8u, ++it)
+		{
+			chunk |= static_cast<UInt64>(static_cast<UInt8>(*it)) << shift;
+		}
+		hash = (hash ^ chunk) * 0x9fb21c651e98df25ull;
+		hash ^= hash >> 32u;
+	}
+	if (index < size)
+	{
+		UInt64 chunk{0u};
+		for (Size shift = 0u; index < size; ++index, shift += 8u, ++it)
+		{
+			chunk |= static_cast<UInt64>(static_cast<UInt8>(*it)) << shift;
+		}
+		hash = (hash ^ chunk) * 0x9fb21c651e98df25ull;
+	}
+	return hashMix(hash);
+}
+
+} // namespace bzd::impl
+
+namespace bzd {
+
+/// Hash function object, intended for hash based containers.
+///
+/// It is not a cryptographic hash, but it is fast and spreads well the entropy of its input,
+/// so that any subset of the bits of the result can be used. It is transparent: strings and any
+/// range of bytes with the same content hash to the same value, which allows heterogeneous lookups.
+struct Hash
+{
+	template <class T>
+	requires(concepts::integral<T> || typeTraits::isEnum<T>)
+	constexpr UInt64 operator()(const T value, const UInt64 seed = 0u) const noexcept
+	{
+		if constexpr (typeTraits::isEnum<T>)
+		{
+			return (*this)(bzd::toUnderlying(value), seed);
+		}
+		else
+		{
+			return impl::hashMix(static_cast<UInt64>(value) + 0x9e3779b97f4a7c15ull * (seed + 1u));
+		}
+	}
+
+	template <class T>
+	UInt64 operator()(T* const value, const UInt64 seed = 0u) const noexcept
+	{
+		return (*this)(reinterpret_cast<IntPointer>(value), seed);
+	}
+
+	template <concepts::randomAccessByteCopyableRange T>
+	constexpr UInt64 operator()(const T& value, const UInt64 seed = 0u) const noexcept
+	{
+		return impl::hashBytes(bzd::begin(value), static_cast<Size>(bzd::size(value)), seed);
+	}
+
+	constexpr UInt64 operator()(const char* const value, const UInt64 seed = 0u) const noexcept
+	{
+		return (*this)(bzd::StringView{value}, seed);
+	}
+};
+
+} // namespace bzd
@@ -0,0 +1,10 @@
+#pragma once
+
+namespace bzd {
+
+/// Detects whether the function call occurs within a constant-evaluated context.
+///
+/// This allows to select a runtime optimized implementation, which is not usable at compile time.
+constexpr bool isConstantEvaluated() noexcept { return __builtin_is_constant_evaluated(); }
+
+} // namespace bzd
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "cc/bzd/platform/processor.hh"
+#include "cc/bzd/platform/types.hh"
+
+namespace bzd {
+
+/// Exponential backoff for spin-wait loops.
+///
+/// Each call waits twice as long as the previous one, up to `maxIterations` processor relax hints.
+template <UInt32 maxIterations = 1024u>
+class Backoff
+{
+public: // API.
+	void operator()() noexcept
+	{
+		for (UInt32 i = 0u; i < iterations_; ++i)
+		{
+			bzd::platform::relax();
+		}
+		if (iterations_ < maxIterations)
+		{
+			iterations_ <<= 1u;
+		}
+	}
+
+	/// Restart from the shortest wait.
+	constexpr void reset() noexcept { iterations_ = 1u; }
+
+private:
+	UInt32 iterations_{1u};
+};
+
+} // namespace bzd
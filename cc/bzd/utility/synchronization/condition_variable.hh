@@ -0,0 +1,98 @@
+#pragma once
+
+#include "cc/bzd/container/non_owning_list.hh"
+#include "cc/bzd/core/async.hh"
+#include "cc/bzd/utility/synchronization/mutex.hh"
+#include "cc/bzd/utility/synchronization/spin_mutex.hh"
+#include "cc/bzd/utility/synchronization/sync_lock_guard.hh"
+
+namespace bzd {
+
+/// Asynchronous condition variable, to be used together with bzd::Mutex.
+///
+/// Waiters are notified in FIFO order.
+class ConditionVariable
+{
+private:
+	struct Waiter : public bzd::NonOwningListElement
+	{
+		bzd::async::ExecutableSuspended executable{};
+	};
+
+public: // Constructors/assignments.
+	constexpr ConditionVariable() = default;
+
+	// Copy/move constructor/assignment.
+	constexpr ConditionVariable(const ConditionVariable&) noexcept = delete;
+	constexpr ConditionVariable& operator=(const ConditionVariable&) noexcept = delete;
+	ConditionVariable(ConditionVariable&&) noexcept = delete;
+	ConditionVariable& operator=(ConditionVariable&&) noexcept = delete;
+	~ConditionVariable() = default;
+
+public: // API.
+	/// Atomically unlock the mutex and wait for a notification, the mutex is locked again before returning.
+	///
+	/// \param mutex The mutex, it must be locked by the caller.
+	bzd::Async<> wait(bzd::Mutex& mutex) noexcept
+	{
+		Waiter waiter;
+		auto lock = makeSyncLockGuard(mutex_);
+		co_await bzd::async::suspend(
+			[&](auto&& executable) {
+				waiter.executable.own(bzd::move(executable));
+				bzd::ignore = waiters_.pushBack(waiter);
+				lock.release();
+				mutex.unlock();
+			},
+			[&]() {
+				const auto lock = makeSyncLockGuard(mutex_);
+				bzd::ignore = waiters_.erase(waiter);
+			});
+
+		co_await !mutex.lock();
+		co_return {};
+	}
+
+	/// Wait until the predicate is satisfied.
+	///
+	/// \param mutex The mutex, it must be locked by the caller.
+	/// \param predicate Callable returning true once the condition is met, it is called with the mutex locked.
+	template <class Predicate>
+	bzd::Async<> wait(bzd::Mutex& mutex, Predicate&& predicate) noexcept
+	{
+		while (!predicate())
+		{
+			co_await !wait(mutex);
+		}
+		co_return {};
+	}
+
+	/// Resume the first waiter, if any.
+	void notifyOne() noexcept
+	{
+		const auto lock = makeSyncLockGuard(mutex_);
+		while (auto maybeWaiter = waiters_.popFront())
+		{
+			if (maybeWaiter.valueMutable().executable.schedule())
+			{
+				return;
+			}
+		}
+	}
+
+	/// Resume all waiters.
+	void notifyAll() noexcept
+	{
+		const auto lock = makeSyncLockGuard(mutex_);
+		while (auto maybeWaiter = waiters_.popFront())
+		{
+			maybeWaiter.valueMutable().executable.schedule();
+		}
+	}
+
+private:
+	bzd::SpinMutex mutex_{};
+	bzd::NonOwningList<Waiter> waiters_{};
+};
+
+} // namespace bzd
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "cc/bzd/container/non_owning_list.hh"
+#include "cc/bzd/core/async.hh"
+#include "cc/bzd/platform/types.hh"
+#include "cc/bzd/utility/synchronization/spin_mutex.hh"
+#include "cc/bzd/utility/synchronization/sync_lock_guard.hh"
+
+namespace bzd {
+
+/// Asynchronous event with manual reset.
+///
+/// Once set, all current and future waiters are resumed until the event is reset.
+class Event
+{
+private:
+	struct Waiter : public bzd::NonOwningListElement
+	{
+		bzd::async::ExecutableSuspended executable{};
+	};
+
+public: // Constructors/assignments.
+	constexpr Event() = default;
+
+	// Copy/move constructor/assignment.
+	constexpr Event(const Event&) noexcept = delete;
+	constexpr Event& operator=(const Event&) noexcept = delete;
+	Event(Event&&) noexcept = delete;
+	Event& operator=(Event&&) noexcept = delete;
+	~Event() = default;
+
+public: // API.
+	/// Wait until the event is set, returns immediately if already set.
+	bzd::Async<> wait() noexcept
+	{
+		Waiter waiter;
+		auto lock = makeSyncLockGuard(mutex_);
+		if (set_)
+		{
+			co_return {};
+		}
+		co_await bzd::async::suspend(
+			[&](auto&& executable) {
+				waiter.executable.own(bzd::move(executable));
+				bzd::ignore = waiters_.pushBack(waiter);
+				lock.release();
+			},
+			[&]() {
+				const auto lock = makeSyncLockGuard(mutex_);
+				bzd::ignore = waiters_.erase(waiter);
+			});
+
+		co_return {};
+	}
+
+	/// Set the event and resume all waiters.
+	void set() noexcept
+	{
+		const auto lock = makeSyncLockGuard(mutex_);
+		set_ = true;
+		while (auto maybeWaiter = waiters_.popFront())
+		{
+			maybeWaiter.valueMutable().executable.schedule();
+		}
+	}
+
+	/// Reset the event, subsequent waiters will be suspended.
+	void reset() noexcept
+	{
+		const auto lock = makeSyncLockGuard(mutex_);
+		set_ = false;
+	}
+
+	/// Whether the event is set or not.
+	[[nodiscard]] bzd::Bool isSet() noexcept
+	{
+		const auto lock = makeSyncLockGuard(mutex_);
+		return set_;
+	}
+
+private:
+	bzd::Bool set_{false};
+	bzd::SpinMutex mutex_{};
+	bzd::NonOwningList<Waiter> waiters_{};
+};
+
+} // namespace bzd
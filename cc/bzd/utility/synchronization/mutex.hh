@@ -1,12 +1,26 @@
 #pragma once
 
+#include "cc/bzd/container/non_owning_list.hh"
 #include "cc/bzd/core/async.hh"
 #include "cc/bzd/platform/atomic.hh"
+#include "cc/bzd/utility/synchronization/spin_mutex.hh"
+#include "cc/bzd/utility/synchronization/sync_lock_guard.hh"
 
 namespace bzd {
 
+/// Asynchronous mutex.
+///
+/// Contending coroutines are suspended in FIFO order and the lock is handed over
+/// directly from the owner to the next waiter on unlock, therefore waiters do not
+/// consume any executor cycle and cannot be overtaken by late comers.
 class Mutex
 {
+private:
+	struct Waiter : public bzd::NonOwningListElement
+	{
+		bzd::async::ExecutableSuspended executable{};
+	};
+
 public:
 	constexpr Mutex() = default;
 
@@ -20,10 +34,30 @@ public:
 public:
 	bzd::Async<> lock() noexcept
 	{
-		while (!tryLock())
+		if (tryLock())
+		{
+			co_return {};
+		}
+
+		Waiter waiter;
+		auto lock = makeSyncLockGuard(mutex_);
+		// The owner might have released the lock in between.
+		if (tryLock())
 		{
-			co_await bzd::async::yield();
+			co_return {};
 		}
+		co_await bzd::async::suspend(
+			[&](auto&& executable) {
+				waiter.executable.own(bzd::move(executable));
+				bzd::ignore = waiters_.pushBack(waiter);
+				lock.release();
+			},
+			[&]() {
+				const auto lock = makeSyncLockGuard(mutex_);
+				bzd::ignore = waiters_.erase(waiter);
+			});
+
+		// The lock was handed over by the previous owner.
 		co_return {};
 	}
 
@@ -31,10 +65,25 @@ public:
 	/// On successful lock acquisition returns true, otherwise returns false.
 	constexpr Bool tryLock() noexcept { return !acquired_.exchange(true); }
 
-	constexpr void unlock() noexcept { acquired_.store(false); }
+	/// Unlocks the mutex, ownership is transferred to the first waiter if any.
+	void unlock() noexcept
+	{
+		const auto lock = makeSyncLockGuard(mutex_);
+		while (auto maybeWaiter = waiters_.popFront())
+		{
+			// If it fails, the waiter is being canceled, try the next one.
+			if (maybeWaiter.valueMutable().executable.schedule())
+			{
+				return;
+			}
+		}
+		acquired_.store(false);
+	}
 
 private:
 	bzd::Atomic<bzd::Bool> acquired_{false};
+	bzd::SpinMutex mutex_{};
+	bzd::NonOwningList<Waiter> waiters_{};
 };
 
 } // namespace bzd
@@ -0,0 +1,102 @@
+#pragma once
+
+#include "cc/bzd/container/non_owning_list.hh"
+#include "cc/bzd/core/async.hh"
+#include "cc/bzd/platform/types.hh"
+#include "cc/bzd/utility/synchronization/spin_mutex.hh"
+#include "cc/bzd/utility/synchronization/sync_lock_guard.hh"
+
+namespace bzd {
+
+/// Asynchronous counting semaphore.
+///
+/// Waiters are served in FIFO order, released tokens are handed over directly to them.
+class Semaphore
+{
+private:
+	struct Waiter : public bzd::NonOwningListElement
+	{
+		bzd::async::ExecutableSuspended executable{};
+	};
+
+public: // Constructors/assignments.
+	constexpr explicit Semaphore(const bzd::Size count = 0u) noexcept : count_{count} {}
+
+	// Copy/move constructor/assignment.
+	constexpr Semaphore(const Semaphore&) noexcept = delete;
+	constexpr Semaphore& operator=(const Semaphore&) noexcept = delete;
+	Semaphore(Semaphore&&) noexcept = delete;
+	Semaphore& operator=(Semaphore&&) noexcept = delete;
+	~Semaphore() = default;
+
+public: // API.
+	/// Acquire a token, wait until one is available if needed.
+	bzd::Async<> acquire() noexcept
+	{
+		Waiter waiter;
+		auto lock = makeSyncLockGuard(mutex_);
+		if (count_)
+		{
+			--count_;
+			co_return {};
+		}
+		co_await bzd::async::suspend(
+			[&](auto&& executable) {
+				waiter.executable.own(bzd::move(executable));
+				bzd::ignore = waiters_.pushBack(waiter);
+				lock.release();
+			},
+			[&]() {
+				const auto lock = makeSyncLockGuard(mutex_);
+				bzd::ignore = waiters_.erase(waiter);
+			});
+
+		co_return {};
+	}
+
+	/// Tries to acquire a token. Returns immediately.
+	/// On successful acquisition returns true, otherwise returns false.
+	[[nodiscard]] bzd::Bool tryAcquire() noexcept
+	{
+		const auto lock = makeSyncLockGuard(mutex_);
+		if (count_)
+		{
+			--count_;
+			return true;
+		}
+		return false;
+	}
+
+	/// Release `count` tokens, waiters are resumed first.
+	void release(bzd::Size count = 1u) noexcept
+	{
+		const auto lock = makeSyncLockGuard(mutex_);
+		while (count)
+		{
+			auto maybeWaiter = waiters_.popFront();
+			if (!maybeWaiter)
+			{
+				break;
+			}
+			if (maybeWaiter.valueMutable().executable.schedule())
+			{
+				--count;
+			}
+		}
+		count_ += count;
+	}
+
+	/// Number of tokens currently available.
+	[[nodiscard]] bzd::Size available() noexcept
+	{
+		const auto lock = makeSyncLockGuard(mutex_);
+		return count_;
+	}
+
+private:
+	bzd::Size count_;
+	bzd::SpinMutex mutex_{};
+	bzd::NonOwningList<Waiter> waiters_{};
+};
+
+} // namespace bzd
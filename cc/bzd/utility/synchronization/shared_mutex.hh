@@ -0,0 +1,169 @@
+#pragma once
+
+#include "cc/bzd/container/non_owning_list.hh"
+#include "cc/bzd/core/async.hh"
+#include "cc/bzd/platform/types.hh"
+#include "cc/bzd/utility/synchronization/spin_mutex.hh"
+#include "cc/bzd/utility/synchronization/sync_lock_guard.hh"
+
+namespace bzd {
+
+/// Asynchronous reader-writer lock.
+///
+/// Waiters are served in FIFO order: a pending exclusive lock blocks subsequent shared lock requests,
+/// so writers cannot be starved by a continuous flow of readers. Consecutive shared waiters are
+/// resumed together.
+class SharedMutex
+{
+private:
+	struct Waiter : public bzd::NonOwningListElement
+	{
+		bzd::async::ExecutableSuspended executable{};
+		bzd::Bool shared{false};
+	};
+
+public: // Constructors/assignments.
+	constexpr SharedMutex() = default;
+
+	// Copy/move constructor/assignment.
+	constexpr SharedMutex(const SharedMutex&) noexcept = delete;
+	constexpr SharedMutex& operator=(const SharedMutex&) noexcept = delete;
+	SharedMutex(SharedMutex&&) noexcept = delete;
+	SharedMutex& operator=(SharedMutex&&) noexcept = delete;
+	~SharedMutex() = default;
+
+public: // API.
+	/// Locks the mutex exclusively, wait if the mutex is not available.
+	bzd::Async<> lock() noexcept
+	{
+		Waiter waiter;
+		auto lock = makeSyncLockGuard(mutex_);
+		if (canLock())
+		{
+			exclusive_ = true;
+			co_return {};
+		}
+		co_await bzd::async::suspend(
+			[&](auto&& executable) {
+				waiter.executable.own(bzd::move(executable));
+				bzd::ignore = waiters_.pushBack(waiter);
+				lock.release();
+			},
+			[&]() { cancel(waiter); });
+		co_return {};
+	}
+
+	/// Tries to lock the mutex exclusively. Returns immediately.
+	/// On successful lock acquisition returns true, otherwise returns false.
+	[[nodiscard]] bzd::Bool tryLock() noexcept
+	{
+		const auto lock = makeSyncLockGuard(mutex_);
+		if (canLock())
+		{
+			exclusive_ = true;
+			return true;
+		}
+		return false;
+	}
+
+	/// Unlocks the exclusive lock.
+	void unlock() noexcept
+	{
+		const auto lock = makeSyncLockGuard(mutex_);
+		exclusive_ = false;
+		handOver();
+	}
+
+	/// Locks the mutex in shared mode, wait if the mutex is not available.
+	bzd::Async<> lockShared() noexcept
+	{
+		Waiter waiter;
+		waiter.shared = true;
+		auto lock = makeSyncLockGuard(mutex_);
+		if (canLockShared())
+		{
+			++shared_;
+			co_return {};
+		}
+		co_await bzd::async::suspend(
+			[&](auto&& executable) {
+				waiter.executable.own(bzd::move(executable));
+				bzd::ignore = waiters_.pushBack(waiter);
+				lock.release();
+			},
+			[&]() { cancel(waiter); });
+		co_return {};
+	}
+
+	/// Tries to lock the mutex in shared mode. Returns immediately.
+	/// On successful lock acquisition returns true, otherwise returns false.
+	[[nodiscard]] bzd::Bool tryLockShared() noexcept
+	{
+		const auto lock = makeSyncLockGuard(mutex_);
+		if (canLockShared())
+		{
+			++shared_;
+			return true;
+		}
+		return false;
+	}
+
+	/// Unlocks a shared lock.
+	void unlockShared() noexcept
+	{
+		const auto lock = makeSyncLockGuard(mutex_);
+		--shared_;
+		handOver();
+	}
+
+private:
+	[[nodiscard]] constexpr bzd::Bool canLock() const noexcept { return !exclusive_ && !shared_ && waiters_.empty(); }
+	[[nodiscard]] constexpr bzd::Bool canLockShared() const noexcept { return !exclusive_ && waiters_.empty(); }
+
+	/// Remove a canceled waiter, the ones behind might be able to run now.
+	void cancel(Waiter& waiter) noexcept
+	{
+		const auto lock = makeSyncLockGuard(mutex_);
+		bzd::ignore = waiters_.erase(waiter);
+		handOver();
+	}
+
+	/// Transfer the ownership to the waiters at the front of the queue.
+	/// This must be called with the internal mutex locked.
+	constexpr void handOver() noexcept
+	{
+		while (!exclusive_)
+		{
+			auto maybeWaiter = waiters_.front();
+			if (!maybeWaiter)
+			{
+				return;
+			}
+			auto& waiter = maybeWaiter.valueMutable();
+			if (!waiter.shared && shared_)
+			{
+				return;
+			}
+			bzd::ignore = waiters_.popFront();
+			if (waiter.executable.schedule())
+			{
+				if (waiter.shared)
+				{
+					++shared_;
+				}
+				else
+				{
+					exclusive_ = true;
+				}
+			}
+		}
+	}
+
+private:
+	bzd::Bool exclusive_{false};
+	bzd::Size shared_{0u};
+	bzd::SpinMutex mutex_{};
+	bzd::NonOwningList<Waiter> waiters_{};
+};
+
+} // namespace bzd
@@ -2,6 +2,7 @@
 
 #include "cc/bzd/platform/atomic.hh"
 #include "cc/bzd/platform/types.hh"
+#include "cc/bzd/utility/synchronization/backoff.hh"
 
 namespace bzd {
 class SpinMutex
@@ -17,7 +18,21 @@ public: // Constructors/assignments.
 	~SpinMutex() = default;
 
 public: // API.
-	constexpr void lock() noexcept { while (!tryLock()); }
+	/// Locks the mutex, blocks if the mutex is not available.
+	///
+	/// While the mutex is taken, the waiters only read its state (test-and-test-and-set), this keeps
+	/// the cache line shared instead of bouncing it between the cores at each attempt.
+	constexpr void lock() noexcept
+	{
+		while (!tryLock())
+		{
+			bzd::Backoff backoff;
+			while (lock_.load(MemoryOrder::relaxed))
+			{
+				backoff();
+			}
+		}
+	}
 
 	/// Tries to lock the mutex. Returns immediately.
 	/// On successful lock acquisition returns true, otherwise returns false.
@@ -2,6 +2,7 @@
 
 #include "cc/bzd/platform/atomic.hh"
 #include "cc/bzd/platform/types.hh"
+#include "cc/bzd/utility/synchronization/backoff.hh"
 
 namespace bzd {
 /// In contrast to other mutex types which facilitate exclusive access, a shared_mutex has two levels of access:
@@ -21,7 +22,17 @@ public: // Constructors/assignments.
 
 public: // API.
 	/// Locks the mutex, blocks if the mutex is not available.
-	constexpr void lock() noexcept { while (!tryLock()); }
+	constexpr void lock() noexcept
+	{
+		while (!tryLock())
+		{
+			bzd::Backoff backoff;
+			while (lock_.load(MemoryOrder::relaxed))
+			{
+				backoff();
+			}
+		}
+	}
 
 	/// Tries to lock the mutex. Returns immediately.
 	/// On successful lock acquisition returns true, otherwise returns false.
@@ -34,7 +45,18 @@ public: // API.
 	/// Unlocks the mutex.
 	constexpr void unlock() noexcept { lock_.store(0u, MemoryOrder::release); }
 
-	constexpr void lockShared() noexcept { while (!tryLockShared()); }
+	/// Locks the mutex in shared mode, blocks while it is exclusively locked.
+	constexpr void lockShared() noexcept
+	{
+		while (!tryLockShared())
+		{
+			bzd::Backoff backoff;
+			while (lock_.load(MemoryOrder::relaxed) & lockValue)
+			{
+				backoff();
+			}
+		}
+	}
 
 	/// Tries to lock the mutex. Returns immediately.
 	/// On successful lock acquisition returns true, otherwise returns false.
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "cc/bzd/platform/atomic.hh"
+#include "cc/bzd/platform/processor.hh"
+#include "cc/bzd/platform/types.hh"
+
+namespace bzd {
+/// Fair spin mutex, the lock is granted in the order it was requested.
+///
+/// Each caller takes a ticket and waits until it is served, the wait is proportional
+/// to its position in the queue. Unlike SpinMutex, a waiter cannot be starved, at the
+/// cost of a slower hand-off when the next owner is not running.
+class SpinTicketMutex
+{
+public: // Constructors/assignments.
+	constexpr SpinTicketMutex() = default;
+
+	// Copy/move constructor/assignment.
+	constexpr SpinTicketMutex(const SpinTicketMutex&) noexcept = delete;
+	constexpr SpinTicketMutex& operator=(const SpinTicketMutex&) noexcept = delete;
+	SpinTicketMutex(SpinTicketMutex&&) noexcept = delete;
+	SpinTicketMutex& operator=(SpinTicketMutex&&) noexcept = delete;
+	~SpinTicketMutex() = default;
+
+public: // API.
+	/// Locks the mutex, blocks if the mutex is not available.
+	constexpr void lock() noexcept
+	{
+		const auto ticket = next_.fetchAdd(1u, MemoryOrder::relaxed);
+		while (true)
+		{
+			const auto current = serving_.load(MemoryOrder::acquire);
+			if (current == ticket)
+			{
+				return;
+			}
+			// Proportional backoff, the further in the queue, the longer the wait.
+			for (UInt32 i = (ticket - current) * relaxPerTicket; i; --i)
+			{
+				bzd::platform::relax();
+			}
+		}
+	}
+
+	/// Tries to lock the mutex. Returns immediately.
+	/// On successful lock acquisition returns true, otherwise returns false.
+	constexpr Bool tryLock() noexcept
+	{
+		auto expected = serving_.load(MemoryOrder::acquire);
+		return next_.compareExchange(expected, expected + 1u, MemoryOrder::acquire);
+	}
+
+	/// Unlocks the mutex, only the owner writes to serving_.
+	constexpr void unlock() noexcept { serving_.store(serving_.load(MemoryOrder::relaxed) + 1u, MemoryOrder::release); }
+
+private:
+	static constexpr UInt32 relaxPerTicket{32u};
+	Atomic<UInt32> next_{0u};
+	alignas(bzd::platform::cacheLineSize) Atomic<UInt32> serving_{0u};
+};
+} // namespace bzd
@@ -0,0 +1,84 @@
+#include "cc/bzd/test/multithread.hh"
+#include "cc/bzd/utility/synchronization/lock_guard.hh"
+#include "cc/bzd/utility/synchronization/mutex.hh"
+#include "cc/bzd/utility/synchronization/spin_mutex.hh"
+#include "cc/bzd/utility/synchronization/spin_ticket_mutex.hh"
+
+namespace {
+
+bzd::Async<> worker(bzd::Mutex& mutex, const bzd::Size count)
+{
+	for (bzd::Size i = 0u; i < count; ++i)
+	{
+		auto scope = co_await !bzd::makeLockGuard(mutex);
+		co_await bzd::async::yield();
+	}
+	co_return {};
+}
+
+} // namespace
+
+// Outside of the anonymous namespace to keep the benchmark names short.
+template <class Mutex, bzd::Size threads>
+struct Contention
+{
+	using MutexType = Mutex;
+	static constexpr bzd::Size count{threads};
+};
+
+BENCHMARK(Mutex, Uncontended, (bzd::Mutex, bzd::SpinMutex, bzd::SpinTicketMutex))
+{
+	TestType mutex;
+	for (auto _ : benchmark)
+	{
+		[[maybe_unused]] const auto isLocked = mutex.tryLock();
+		mutex.unlock();
+		bzd::test::doNotOptimize(mutex);
+	}
+}
+
+// Waiters are queued and the lock is handed off directly to the next one.
+BENCHMARK_ASYNC(Mutex, HandOff)
+{
+	bzd::Mutex mutex;
+	benchmark.setItemsPerIteration(4u);
+	for (auto _ : benchmark)
+	{
+		[[maybe_unused]] const auto result = co_await bzd::async::all(worker(mutex, 1u),
+																	  worker(mutex, 1u),
+																	  worker(mutex, 1u),
+																	  worker(mutex, 1u));
+	}
+	co_return {};
+}
+
+// Lock hand-off under contention, each thread takes the lock repeatedly for a short critical section.
+// The time per item is the average latency for the lock to be handed over to the next owner.
+BENCHMARK(Mutex,
+		  Contended,
+		  (Contention<bzd::SpinMutex, 1u>,
+		   Contention<bzd::SpinMutex, 2u>,
+		   Contention<bzd::SpinMutex, 4u>,
+		   Contention<bzd::SpinTicketMutex, 1u>,
+		   Contention<bzd::SpinTicketMutex, 2u>,
+		   Contention<bzd::SpinTicketMutex, 4u>))
+{
+	constexpr bzd::Size batch{1000u};
+	typename TestType::MutexType mutex;
+	bzd::Size counter{0u};
+	bzd::test::Workers workers{TestType::count, [&](const bzd::Size) {
+								   for (bzd::Size i = 0u; i < batch; ++i)
+								   {
+									   mutex.lock();
+									   ++counter;
+									   mutex.unlock();
+								   }
+							   }};
+
+	benchmark.setItemsPerIteration(batch * TestType::count);
+	for (auto _ : benchmark)
+	{
+		workers.run();
+	}
+	bzd::test::doNotOptimize(counter);
+}
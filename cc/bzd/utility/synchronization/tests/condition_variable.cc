@@ -0,0 +1,39 @@
+#include "cc/bzd/utility/synchronization/condition_variable.hh"
+
+#include "cc/bzd/container/string.hh"
+#include "cc/bzd/test/test.hh"
+#include "cc/bzd/utility/synchronization/lock_guard.hh"
+
+TEST_ASYNC(ConditionVariable, ProducerConsumer)
+{
+	bzd::Mutex mutex;
+	bzd::ConditionVariable condition;
+	bzd::Size value{0u};
+	bzd::String<32> trace;
+
+	auto consumer = [&](const char id, const bzd::Size expected) -> bzd::Async<> {
+		auto scope = co_await !bzd::makeLockGuard(mutex);
+		co_await !condition.wait(mutex, [&]() { return value >= expected; });
+		trace += id;
+		co_return {};
+	};
+	auto producer = [&]() -> bzd::Async<> {
+		for (bzd::Size i = 0; i < 3u; ++i)
+		{
+			co_await bzd::async::yield();
+			auto scope = co_await !bzd::makeLockGuard(mutex);
+			++value;
+			trace += 'p';
+			condition.notifyAll();
+		}
+		co_return {};
+	};
+
+	[[maybe_unused]] const auto result = co_await bzd::async::all(consumer('b', 2u), consumer('a', 1u), producer());
+	EXPECT_EQ(trace, "papbp");
+
+	// The mutex is released by all parties.
+	EXPECT_TRUE(mutex.tryLock());
+	mutex.unlock();
+	co_return {};
+}
@@ -0,0 +1,33 @@
+#include "cc/bzd/utility/synchronization/event.hh"
+
+#include "cc/bzd/container/string.hh"
+#include "cc/bzd/test/test.hh"
+
+TEST_ASYNC(Event, Base)
+{
+	bzd::Event event;
+	bzd::String<32> trace;
+
+	auto waiter = [&](const char id) -> bzd::Async<> {
+		co_await !event.wait();
+		trace += id;
+		co_return {};
+	};
+	auto setter = [&]() -> bzd::Async<> {
+		co_await bzd::async::yield();
+		trace += 's';
+		event.set();
+		co_return {};
+	};
+
+	[[maybe_unused]] const auto result = co_await bzd::async::all(waiter('a'), waiter('b'), setter());
+	EXPECT_EQ(trace, "sab");
+	EXPECT_TRUE(event.isSet());
+
+	// Already set.
+	co_await !event.wait();
+
+	event.reset();
+	EXPECT_FALSE(event.isSet());
+	co_return {};
+}
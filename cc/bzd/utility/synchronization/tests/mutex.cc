@@ -0,0 +1,61 @@
+#include "cc/bzd/utility/synchronization/mutex.hh"
+
+#include "cc/bzd/container/string.hh"
+#include "cc/bzd/test/test.hh"
+#include "cc/bzd/utility/synchronization/lock_guard.hh"
+
+namespace {
+bzd::Async<> worker(bzd::Mutex& mutex, bzd::interface::String& trace, const char id)
+{
+	auto scope = co_await !bzd::makeLockGuard(mutex);
+	trace += id;
+	co_await bzd::async::yield();
+	co_await bzd::async::yield();
+	trace += id;
+	co_return {};
+}
+} // namespace
+
+TEST(Mutex, TryLock)
+{
+	bzd::Mutex mutex;
+	EXPECT_TRUE(mutex.tryLock());
+	EXPECT_FALSE(mutex.tryLock());
+	mutex.unlock();
+	EXPECT_TRUE(mutex.tryLock());
+	mutex.unlock();
+}
+
+TEST_ASYNC(Mutex, Fifo)
+{
+	bzd::Mutex mutex;
+	bzd::String<32> trace;
+	[[maybe_unused]] const auto result =
+		co_await bzd::async::all(worker(mutex, trace, 'a'), worker(mutex, trace, 'b'), worker(mutex, trace, 'c'));
+	EXPECT_EQ(trace, "aabbcc");
+
+	// The lock is released by the last owner.
+	EXPECT_TRUE(mutex.tryLock());
+	mutex.unlock();
+	co_return {};
+}
+
+TEST_ASYNC(Mutex, HandOver)
+{
+	bzd::Mutex mutex;
+	bzd::String<32> trace;
+	EXPECT_TRUE(mutex.tryLock());
+
+	auto release = [&]() -> bzd::Async<> {
+		co_await bzd::async::yield();
+		trace += 'r';
+		mutex.unlock();
+		// The ownership is transferred to the waiter, nobody can take it in between.
+		EXPECT_FALSE(mutex.tryLock());
+		co_return {};
+	};
+
+	[[maybe_unused]] const auto result = co_await bzd::async::all(worker(mutex, trace, 'a'), release());
+	EXPECT_EQ(trace, "raa");
+	co_return {};
+}
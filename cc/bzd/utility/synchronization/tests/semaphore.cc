@@ -0,0 +1,44 @@
+#include "cc/bzd/utility/synchronization/semaphore.hh"
+
+#include "cc/bzd/container/string.hh"
+#include "cc/bzd/test/test.hh"
+
+namespace {
+bzd::Async<> worker(bzd::Semaphore& semaphore, bzd::Size& active, bzd::Size& maxActive)
+{
+	co_await !semaphore.acquire();
+	++active;
+	maxActive = (active > maxActive) ? active : maxActive;
+	co_await bzd::async::yield();
+	co_await bzd::async::yield();
+	--active;
+	semaphore.release();
+	co_return {};
+}
+} // namespace
+
+TEST(Semaphore, TryAcquire)
+{
+	bzd::Semaphore semaphore{2u};
+	EXPECT_EQ(semaphore.available(), 2u);
+	EXPECT_TRUE(semaphore.tryAcquire());
+	EXPECT_TRUE(semaphore.tryAcquire());
+	EXPECT_FALSE(semaphore.tryAcquire());
+	semaphore.release(2u);
+	EXPECT_EQ(semaphore.available(), 2u);
+}
+
+TEST_ASYNC(Semaphore, Concurrency)
+{
+	bzd::Semaphore semaphore{2u};
+	bzd::Size active{0u};
+	bzd::Size maxActive{0u};
+	[[maybe_unused]] const auto result = co_await bzd::async::all(worker(semaphore, active, maxActive),
+																  worker(semaphore, active, maxActive),
+																  worker(semaphore, active, maxActive),
+																  worker(semaphore, active, maxActive));
+	EXPECT_EQ(active, 0u);
+	EXPECT_EQ(maxActive, 2u);
+	EXPECT_EQ(semaphore.available(), 2u);
+	co_return {};
+}
@@ -0,0 +1,53 @@
+#include "cc/bzd/utility/synchronization/shared_mutex.hh"
+
+#include "cc/bzd/container/string.hh"
+#include "cc/bzd/test/test.hh"
+#include "cc/bzd/utility/synchronization/lock_guard.hh"
+
+namespace {
+bzd::Async<> reader(bzd::SharedMutex& mutex, bzd::interface::String& trace, const char id)
+{
+	auto scope = co_await !bzd::makeSharedLockGuard(mutex);
+	trace += id;
+	co_await bzd::async::yield();
+	co_await bzd::async::yield();
+	trace += id;
+	co_return {};
+}
+
+bzd::Async<> writer(bzd::SharedMutex& mutex, bzd::interface::String& trace, const char id)
+{
+	auto scope = co_await !bzd::makeLockGuard(mutex);
+	trace += id;
+	co_await bzd::async::yield();
+	trace += id;
+	co_return {};
+}
+} // namespace
+
+TEST(SharedMutex, TryLock)
+{
+	bzd::SharedMutex mutex;
+	EXPECT_TRUE(mutex.tryLockShared());
+	EXPECT_TRUE(mutex.tryLockShared());
+	EXPECT_FALSE(mutex.tryLock());
+	mutex.unlockShared();
+	mutex.unlockShared();
+	EXPECT_TRUE(mutex.tryLock());
+	EXPECT_FALSE(mutex.tryLockShared());
+	mutex.unlock();
+}
+
+TEST_ASYNC(SharedMutex, Fifo)
+{
+	bzd::SharedMutex mutex;
+	bzd::String<32> trace;
+	[[maybe_unused]] const auto result = co_await bzd::async::all(reader(mutex, trace, 'a'),
+																  reader(mutex, trace, 'b'),
+																  writer(mutex, trace, 'W'),
+																  reader(mutex, trace, 'c'),
+																  reader(mutex, trace, 'd'));
+	// Readers share the lock, the writer blocks subsequent readers.
+	EXPECT_EQ(trace, "ababWWcdcd");
+	co_return {};
+}
@@ -0,0 +1,79 @@
+#include "cc/bzd/container/array.hh"
+#include "cc/bzd/test/test.hh"
+#include "cc/bzd/utility/synchronization/spin_mutex.hh"
+#include "cc/bzd/utility/synchronization/spin_shared_mutex.hh"
+#include "cc/bzd/utility/synchronization/spin_ticket_mutex.hh"
+#include "cc/bzd/utility/synchronization/sync_lock_guard.hh"
+
+#include <thread>
+
+namespace {
+template <class Mutex>
+void stressExclusive(const bzd::Size iterations)
+{
+	Mutex mutex;
+	bzd::Size counter{0u};
+	bzd::Array<std::thread, 4u> threads;
+	for (auto& thread : threads)
+	{
+		thread = std::thread{[&]() {
+			for (bzd::Size i = 0u; i < iterations; ++i)
+			{
+				const auto lock = bzd::makeSyncLockGuard(mutex);
+				++counter;
+			}
+		}};
+	}
+	for (auto& thread : threads)
+	{
+		thread.join();
+	}
+	EXPECT_EQ(counter, iterations * threads.size());
+}
+} // namespace
+
+TEST(SpinMutex, Stress) { stressExclusive<bzd::SpinMutex>(100000u); }
+
+TEST(SpinTicketMutex, Stress) { stressExclusive<bzd::SpinTicketMutex>(1000u); }
+
+TEST(SpinSharedMutex, Stress)
+{
+	stressExclusive<bzd::SpinSharedMutex>(100000u);
+
+	bzd::SpinSharedMutex mutex;
+	bzd::Size counter{0u};
+	bzd::Atomic<bzd::Bool> error{false};
+	std::thread writer{[&]() {
+		for (bzd::Size i = 0u; i < 10000u; ++i)
+		{
+			const auto lock = bzd::makeSyncLockGuard(mutex);
+			// Readers must never observe an odd value.
+			++counter;
+			++counter;
+		}
+	}};
+	std::thread reader{[&]() {
+		for (bzd::Size i = 0u; i < 10000u; ++i)
+		{
+			const auto lock = bzd::makeSyncSharedLockGuard(mutex);
+			if (counter % 2u)
+			{
+				error.store(true);
+			}
+		}
+	}};
+	writer.join();
+	reader.join();
+	EXPECT_FALSE(error.load());
+	EXPECT_EQ(counter, 20000u);
+}
+
+TEST(SpinTicketMutex, TryLock)
+{
+	bzd::SpinTicketMutex mutex;
+	EXPECT_TRUE(mutex.tryLock());
+	EXPECT_FALSE(mutex.tryLock());
+	mutex.unlock();
+	EXPECT_TRUE(mutex.tryLock());
+	mutex.unlock();
+}
@@ -14,7 +14,7 @@
 namespace bzd::components::esp32 {
 
 template <class Context>
-class Core : public bzd::Core
+class Core final : public bzd::Core
 {
 private:
 	using Self = Core<Context>;
@@ -66,7 +66,9 @@ public:
 
 	StackSize getStackUsage() noexcept override { return stack_.estimateMaxUsage(freertosStackTaintingByte); }
 
-	void getUsage() noexcept {}
+	void setBusy(const bzd::Bool) noexcept override {}
+
+	bzd::Result<bzd::CoreUsage, bzd::Error> getUsage() noexcept override { return bzd::error::Failure("Not supported."_csv); }
 
 	CoreId getId() noexcept override { return 0; }
 
@@ -5,7 +5,7 @@
 
 namespace bzd::components::esp32::timer {
 
-class Xthal : public bzd::Timer
+class Xthal final : public bzd::Timer
 {
 public:
 	template <class Context>
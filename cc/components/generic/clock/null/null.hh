@@ -4,7 +4,7 @@
 
 namespace bzd::components::generic::clock {
 
-class Null : public bzd::Clock
+class Null final : public bzd::Clock
 {
 public:
 	template <class Context>
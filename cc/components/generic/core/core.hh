@@ -3,11 +3,12 @@
 #include "cc/bzd/container/optional.hh"
 #include "cc/bzd/container/result.hh"
 #include "cc/bzd/container/stack.hh"
+#include "cc/bzd/core/error.hh"
 #include "cc/components/generic/core/interface.hh"
 
 namespace bzd::components::generic {
 
-class Core : public bzd::Core
+class Core final : public bzd::Core
 {
 private:
 	using Self = Core;
@@ -30,9 +31,9 @@ public:
 
 	StackSize getStackUsage() noexcept override { return 0; }
 
-	bzd::Size startUsageMonitoring() noexcept { return 0; }
+	void setBusy(const bzd::Bool) noexcept override {}
 
-	void getUsage() noexcept {}
+	bzd::Result<bzd::CoreUsage, bzd::Error> getUsage() noexcept override { return bzd::error::Failure("Not supported."_csv); }
 
 	CoreId getId() noexcept override { return 0; }
 };
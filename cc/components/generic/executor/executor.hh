@@ -1,8 +1,14 @@
 #pragma once
 
+#include "cc/bzd/container/array.hh"
 #include "cc/bzd/container/function_ref.hh"
 #include "cc/bzd/core/async.hh"
 #include "cc/bzd/core/logger.hh"
+#include "cc/bzd/platform/atomic.hh"
+#include "cc/bzd/platform/processor.hh"
+#include "cc/bzd/type_traits/declval.hh"
+#include "cc/bzd/type_traits/is_same.hh"
+#include "cc/bzd/type_traits/remove_cvref.hh"
 #include "cc/bzd/utility/apply.hh"
 #include "cc/components/generic/executor_profiler/noop/noop.hh"
 #include "interfaces/core.hh"
@@ -10,14 +16,79 @@
 
 namespace bzd::components::generic {
 
+/// Executor running on a pool of cores.
+///
+/// The first core always runs, it drives the services. The other cores are elastic, they park when
+/// they run out of work and are woken up when an executable pinned to them is scheduled or when the
+/// queue depth passes `wakeQueueDepth`. They are only retired once all workloads are completed.
 template <class Context>
 class Executor : public bzd::Executor<Executor<Context>>
 {
 public:
 	using Self = Executor<Context>;
 
+private:
+	/// Number of cores managed by this executor.
+	static constexpr Size coreCount{bzd::typeTraits::RemoveCVRef<decltype(bzd::typeTraits::declval<Context&>().config.cores)>::size()};
+
+	enum class CoreState : UInt8
+	{
+		/// The core is processing executables.
+		running,
+		/// The core is waiting to be woken up.
+		parked,
+		/// The core has been woken up but did not resume yet.
+		notified
+	};
+
+	/// Parking slot of a core, written by other cores to wake it up, so it lives on its own cache line.
+	struct alignas(bzd::platform::cacheLineSize) Slot
+	{
+		bzd::Atomic<CoreState> state{CoreState::running};
+	};
+
+	/// Core profiler forwarding the events to the configured one, and reporting to the core
+	/// when it starts and stops processing executables.
+	template <class Profiler>
+	class CoreProfilerUsage
+	{
+	public:
+		constexpr CoreProfilerUsage(Profiler& profiler, bzd::Core& core) noexcept : profiler_{profiler}, core_{core} {}
+
+		template <class Event>
+		constexpr void event(const Event event) noexcept
+		{
+			if constexpr (bzd::concepts::sameAs<Event, bzd::async::profiler::ExecutableScheduled>)
+			{
+				setBusy(true);
+			}
+			else if constexpr (bzd::concepts::sameAs<Event, bzd::async::profiler::CoreIdle>)
+			{
+				setBusy(false);
+			}
+			profiler_.event(event);
+		}
+
+		constexpr void setBusy(const Bool busy) noexcept
+		{
+			if (busy != busy_)
+			{
+				busy_ = busy;
+				core_.setBusy(busy);
+			}
+		}
+
+	private:
+		Profiler& profiler_;
+		bzd::Core& core_;
+		Bool busy_{false};
+	};
+
 public:
-	constexpr Executor(Context& context) noexcept : context_{context}, executor_{}, logger_{context.config.out} {}
+	constexpr Executor(Context& context) noexcept : context_{context}, executor_{}, logger_{context.config.out}
+	{
+		executor_.setOnSchedule(bzd::async::Executor::OnScheduleCallback::toMember<Self, &Self::onSchedule>(*this));
+	}
 
 	/// Assign a workload to this executor.
 	constexpr void schedule(bzd::concepts::async auto& async, const bzd::async::Type type) noexcept
@@ -49,6 +120,8 @@ public:
 	/// Stop the executor.
 	bzd::Result<void, bzd::Error> stop() noexcept
 	{
+		// Parked cores must be released to be joined.
+		wakeAll();
 		for (auto& core : context_.config.cores)
 		{
 			if (auto result = core.stop(); !result)
@@ -57,9 +130,22 @@ public:
 			}
 		}
 		executor_.shutdown();
+		// All the core profilers are gone at this point, the profile is complete.
+		context_.config.profiler.stop();
 		return bzd::nullresult;
 	}
 
+public: // Statistics.
+	/// Number of cores currently processing executables.
+	[[nodiscard]] Size getActiveCoreCount() const noexcept
+	{
+		const auto running = runningCount_.load();
+		const auto parked = parkedCount_.load();
+		return (running > parked) ? running - parked : 0u;
+	}
+	/// Number of cores currently parked, waiting for work.
+	[[nodiscard]] Size getParkedCoreCount() const noexcept { return parkedCount_.load(); }
+
 private:
 	/// Call the idle function for each core.
 	///
@@ -68,8 +154,94 @@ private:
 	/// \return True if the core should continue running, false if it should be stopped.
 	Bool idle(const Size index, bzd::Core&) noexcept
 	{
-		// Only keep core 0 running.
-		return (index == 0u);
+		// The first core keeps running to drive the services, the others park until there is work for them.
+		if (index != 0u)
+		{
+			park(index);
+		}
+		return (workloadCount_.load() != 0u);
+	}
+
+	/// Park the current core until it is woken up.
+	///
+	/// \param index The core index the way it was registered within the executor.
+	void park(const Size index) noexcept
+	{
+		auto& state = slots_[index].state;
+		++parkedCount_;
+		state.store(CoreState::parked);
+		// Check again after announcing the parking, an executable scheduled in between would otherwise be
+		// missed, as schedulers only look for parked cores. The queue counters are increased before an
+		// executable is scheduled, so either the scheduler or this check sees the other. The conditions
+		// are the ones of `onSchedule`.
+		if (executor_.getPinnedCount(static_cast<UInt16>(index)) != 0u ||
+			executor_.getQueueCount() > static_cast<Size>(context_.config.wakeQueueDepth) || workloadCount_.load() == 0u)
+		{
+			wake(index);
+		}
+		state.wait(CoreState::parked);
+		state.store(CoreState::running);
+	}
+
+	/// Wake up a core if parked.
+	///
+	/// \return True if the core was parked, false otherwise.
+	Bool wake(const Size index) noexcept
+	{
+		auto& state = slots_[index].state;
+		// Read first to avoid bouncing the cache line of running cores.
+		if (state.load() != CoreState::parked)
+		{
+			return false;
+		}
+		auto expected{CoreState::parked};
+		if (!state.compareExchange(expected, CoreState::notified))
+		{
+			return false;
+		}
+		--parkedCount_;
+		state.notifyOne();
+		return true;
+	}
+
+	/// Wake up the first parked core found, if any.
+	void wakeOne() noexcept
+	{
+		for (Size index = 1u; index < coreCount; ++index)
+		{
+			if (wake(index))
+			{
+				return;
+			}
+		}
+	}
+
+	/// Wake up all parked cores.
+	void wakeAll() noexcept
+	{
+		for (Size index = 1u; index < coreCount; ++index)
+		{
+			wake(index);
+		}
+	}
+
+	/// Callback triggered every time an executable is ready to be scheduled.
+	void onSchedule(const UInt16 coreUId, const Bool isPinned) noexcept
+	{
+		// Fast path, no core to wake up.
+		if (parkedCount_.load() == 0u)
+		{
+			return;
+		}
+		// Pinned executables can only be processed by their core.
+		if (isPinned && coreUId < coreCount && wake(coreUId))
+		{
+			return;
+		}
+		if (executor_.getQueueCount() > static_cast<Size>(context_.config.wakeQueueDepth))
+		{
+			wakeOne();
+		}
 	}
 
 private:
@@ -79,22 +251,34 @@ private:
 		Bool runCore{true};
 
 		// Get the index of the core in the array.
-		const auto it = bzd::algorithm::findIf(context_.config.cores, [&core](auto& value) { return &core == &value; });
-		bzd::assert::isTrue(it != context_.config.cores.end(), "Core must be registered.");
-		const auto index = bzd::distance(context_.config.cores.begin(), it);
+		// Note, it is counted explicitly as the iterator distance over an array of references is not in elements.
+		Size index{0u};
+		for (auto& value : context_.config.cores)
+		{
+			if (&core == &value)
+			{
+				break;
+			}
+			++index;
+		}
+		bzd::assert::isTrue(index < coreCount, "Core must be registered.");
 
 		// Create the profiler for this core.
-		auto profiler = context_.config.profiler.makeCoreProfiler();
+		auto coreProfiler = context_.config.profiler.makeCoreProfiler();
+		CoreProfilerUsage profiler{coreProfiler, core};
 
+		++runningCount_;
 		do
 		{
-			executor_.run(/*coreUId*/ index, profiler);
+			executor_.run(/*coreUId*/ static_cast<UInt16>(index), profiler);
+			profiler.setBusy(false);
 			if (workloadCount_.load() == 0u)
 			{
 				break;
 			}
 			runCore = idle(index, core);
 		} while (runCore);
+		--runningCount_;
 	}
 
 	/// Callback triggered when an active async is terminated.
@@ -105,6 +289,8 @@ private:
 			// This might be blocking if the services are not running anymore.
 			// logger_.info("All workloads are terminated, requesting shutdown.").sync();
 			executor_.requestShutdown();
+			// Retire the parked cores.
+			wakeAll();
 		}
 		return bzd::nullopt;
 	}
@@ -114,6 +300,11 @@ private:
 	bzd::async::Executor executor_;
 	bzd::Logger logger_;
 	bzd::Atomic<bzd::Size> workloadCount_{0};
+	/// Number of cores currently in their run loop.
+	bzd::Atomic<bzd::Size> runningCount_{0};
+	/// Number of cores currently parked.
+	bzd::Atomic<bzd::Size> parkedCount_{0};
+	bzd::Array<Slot, coreCount> slots_{};
 };
 
 } // namespace bzd::components::generic
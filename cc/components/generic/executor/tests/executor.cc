@@ -0,0 +1,144 @@
+#include "cc/components/generic/executor/executor.hh"
+
+#include "cc/bzd/container/array.hh"
+#include "cc/bzd/test/test.hh"
+#include "cc/components/std/stream/out/out.hh"
+
+#include <chrono>
+#include <thread>
+
+namespace {
+
+/// Index of the core the current thread belongs to.
+thread_local bzd::UInt32 currentCore{0u};
+
+/// Core running its workload on a dedicated thread.
+class ThreadCore : public bzd::Core
+{
+public:
+	explicit ThreadCore(const bzd::UInt32 index) noexcept : index_{index} {}
+
+	bzd::Result<void, bzd::Error> start(const bzd::FunctionRef<void(bzd::Core&)> workload) noexcept override
+	{
+		thread_ = ::std::thread{[this, workload]() {
+			currentCore = index_;
+			workload(*this);
+		}};
+		return bzd::nullresult;
+	}
+
+	bzd::Result<void, bzd::Error> stop() noexcept override
+	{
+		thread_.join();
+		return bzd::nullresult;
+	}
+
+	bzd::StackSize getStackUsage() noexcept override { return 0u; }
+
+	bzd::CoreId getId() noexcept override { return static_cast<bzd::CoreId>(index_); }
+
+	void setBusy(const bzd::Bool busy) noexcept override
+	{
+		if (busy)
+		{
+			++busyCount;
+		}
+	}
+
+	bzd::Result<bzd::CoreUsage, bzd::Error> getUsage() noexcept override { return bzd::CoreUsage{}; }
+
+	/// Number of times the core became busy.
+	bzd::Atomic<bzd::Size> busyCount{0u};
+
+private:
+	bzd::UInt32 index_;
+	::std::thread thread_{};
+};
+
+struct Config
+{
+	bzd::OStream& out;
+	bzd::Array<bzd::Core&, 4u> cores;
+	bzd::components::generic::ExecutorProfilerNoop<> profiler{};
+	static constexpr bzd::Int32 wakeQueueDepth{1};
+};
+
+struct Context
+{
+	using Config = ::Config;
+	Config config;
+};
+
+using Executor = bzd::components::generic::Executor<Context>;
+
+/// Wait until a condition is met, with a timeout.
+template <class Predicate>
+bool waitFor(Predicate&& predicate)
+{
+	for (bzd::Size retry = 0u; retry < 5000u; ++retry)
+	{
+		if (predicate())
+		{
+			return true;
+		}
+		::std::this_thread::sleep_for(::std::chrono::milliseconds{1});
+	}
+	return false;
+}
+
+/// Busy work, recording the cores it ran on.
+bzd::Async<> busy(bzd::Atomic<bzd::UInt32>& cores)
+{
+	for (bzd::Size i = 0u; i < 10u; ++i)
+	{
+		cores |= (1u << currentCore);
+		::std::this_thread::sleep_for(::std::chrono::microseconds{100});
+		co_await bzd::async::yield();
+	}
+	co_return {};
+}
+
+} // namespace
+
+TEST(Executor, ElasticPool)
+{
+	bzd::components::std::Out out;
+	ThreadCore core0{0u}, core1{1u}, core2{2u}, core3{3u};
+	Context context{Config{out, bzd::Array<bzd::Core&, 4u>{bzd::inPlace, core0, core1, core2, core3}}};
+	Executor executor{context};
+
+	bzd::Atomic<bzd::Bool> release{false};
+	bzd::Atomic<bzd::UInt32> cores{0u};
+	bzd::Atomic<bzd::UInt32> parkedSeen{0u};
+
+	auto workload = [&]() -> bzd::Async<> {
+		// Idle phase, there is nothing to do for most cores, they park.
+		while (!release.load())
+		{
+			parkedSeen.store(static_cast<bzd::UInt32>(executor.getParkedCoreCount()));
+			co_await bzd::async::yield();
+		}
+		// Burst of parallel work, the parked cores must be woken up.
+		co_await bzd::async::allParallel(busy(cores), busy(cores), busy(cores), busy(cores));
+		co_return {};
+	};
+
+	auto async = workload();
+	executor.schedule(async, bzd::async::Type::workload);
+	EXPECT_TRUE(executor.start());
+
+	// The workload is pinned to the core that first ran it, the first core always runs, all others park.
+	EXPECT_TRUE(waitFor([&]() { return parkedSeen.load() >= 2u; }));
+	EXPECT_LE(executor.getActiveCoreCount(), 2u);
+	release.store(true);
+
+	EXPECT_TRUE(executor.stop());
+	EXPECT_TRUE(async.isCompleted());
+	// The burst ran on more than the first core.
+	EXPECT_NE(cores.load() & 0xeu, 0u);
+	// Utilization is reported by the executor loop.
+	EXPECT_GT(core0.busyCount.load() + core1.busyCount.load() + core2.busyCount.load() + core3.busyCount.load(), 0u);
+	// All cores are retired.
+	EXPECT_EQ(executor.getActiveCoreCount(), 0u);
+	EXPECT_EQ(executor.getParkedCoreCount(), 0u);
+}
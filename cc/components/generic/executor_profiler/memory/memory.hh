@@ -25,7 +25,10 @@ public:
 								   bzd::async::profiler::DeleteCore,
 								   bzd::async::profiler::ExecutableScheduled,
 								   bzd::async::profiler::ExecutableUnscheduled,
-								   bzd::async::profiler::ExecutableCanceled>;
+								   bzd::async::profiler::ExecutableCanceled,
+								   bzd::async::profiler::ExecutableResumed,
+								   bzd::async::profiler::ExecutableSuspended,
+								   bzd::async::profiler::CoreIdle>;
 		bzd::RingBuffer<Event, Context::Config::size> events_{};
 	};
 
@@ -33,6 +36,7 @@ public:
 	constexpr ExecutorProfilerMemory(Context& context) noexcept : context_{context} {}
 
 	constexpr auto makeCoreProfiler() noexcept { return CoreProfilerMemory{}; }
+	constexpr void stop() noexcept {}
 
 private:
 	Context& context_;
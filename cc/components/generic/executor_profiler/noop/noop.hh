@@ -12,6 +12,7 @@ public:
 	ExecutorProfilerNoop() = default;
 	constexpr ExecutorProfilerNoop(auto&) noexcept {}
 	constexpr CoreProfilerNoop makeCoreProfiler() const noexcept { return CoreProfilerNoop{}; }
+	constexpr void stop() const noexcept {}
 };
 
 } // namespace bzd::components::generic
@@ -4,7 +4,7 @@
 
 namespace bzd::components::generic::timer {
 
-class Null : public bzd::Timer
+class Null final : public bzd::Timer
 {
 public:
 	template <class Context>
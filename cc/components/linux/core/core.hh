@@ -2,66 +2,68 @@
 
 #include "cc/bzd/container/optional.hh"
 #include "cc/bzd/container/result.hh"
-#include "cc/bzd/container/stack.hh"
+#include "cc/bzd/container/span.hh"
+#include "cc/bzd/core/async.hh"
 #include "cc/bzd/core/error.hh"
 #include "cc/bzd/core/print.hh"
+#include "cc/bzd/core/units.hh"
 #include "cc/bzd/math/ceil.hh"
+#include "cc/bzd/platform/atomic.hh"
 #include "cc/bzd/utility/align_up.hh"
+#include "cc/bzd/utility/min.hh"
 #include "cc/components/linux/core/interface.hh"
 #include "cc/components/posix/error.hh"
 #ifndef _GNU_SOURCE
-#define _GNU_SOURCE // Needed for sched_setaffinity
+#define _GNU_SOURCE // Needed for pthread_attr_setaffinity_np and pthread_setname_np
 #endif
+#include <cstring>
+#include <fcntl.h>
 #include <iostream>
+#include <linux/mempolicy.h>
 #include <pthread.h>
 #include <sched.h>
-#include <stdlib.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <time.h>
 #include <unistd.h>
 
 namespace bzd::components::linux {
 
 template <class Context>
-class Core : public bzd::Core
+class Core final : public bzd::Core
 {
 private:
 	using Self = Core<Context>;
+	/// Maximum length of a thread name, without the null terminating character.
+	static constexpr Size threadNameMaxSize{15u};
 
 public:
-	explicit Core(Context&) noexcept : core_id_{0}
-	{
-		bzd::ignore = Context::Config::priority;
-		bzd::ignore = Context::Config::name;
-	}
+	explicit Core(Context& context) noexcept : context_{context}, core_id_{0} {}
 
 	~Core() noexcept
 	{
-		if (stack_.hasValue())
+		if (statusFd_ != -1)
 		{
-			::free(stack_->data());
+			::close(statusFd_);
+		}
+		if (!stack_.empty())
+		{
+			// Also release the guard page.
+			::munmap(stack_.data() - pageSize_, stack_.size() + pageSize_);
 		}
 	}
 
 	Result<void, bzd::Error> start(const bzd::FunctionRef<void(bzd::Core&)> workload) noexcept override
 	{
-		// Allocate the aligned memory for the stack.
+		// Map the memory for the stack, it is committed lazily.
 		if (stack_.empty())
 		{
-			const auto alignment = ::sysconf(_SC_PAGESIZE);
-			if (alignment == -1)
+			auto maybeStack = allocateStack();
+			if (!maybeStack)
 			{
-				return bzd::error::Errno("sysconf");
+				return bzd::move(maybeStack).propagate();
 			}
-
-			const Size actualSize = bzd::alignUp(Context::Config::stackSize, alignment);
-			void* memory = nullptr;
-			if (const auto result = ::posix_memalign(&memory, alignment, actualSize); result != 0)
-			{
-				return bzd::error::Errno("sysconf", result);
-			}
-			stack_.emplace(Span<Byte>{static_cast<Byte*>(memory), actualSize});
-
-			// Taint the stack to monitor its usage.
-			stack_->taint();
+			stack_ = maybeStack.value();
 		}
 
 		if (::pthread_attr_init(&attr_) != 0)
@@ -69,16 +71,27 @@ public:
 			return bzd::error::Errno("pthread_attr_init");
 		}
 
-		if (::pthread_attr_setstack(&attr_, stack_->data(), stack_->size()) != 0)
+		if (::pthread_attr_setstack(&attr_, stack_.data(), stack_.size()) != 0)
 		{
 			return bzd::error::Errno("pthread_attr_setstack");
 		}
 
+		if (auto result = setAffinity(); !result)
+		{
+			return bzd::move(result).propagate();
+		}
+
+		if (auto result = setScheduling(); !result)
+		{
+			return bzd::move(result).propagate();
+		}
+
 		workload_ = workload;
 
-		if (::pthread_create(&thread_, &attr_, &workloadWrapper, this) != 0)
+		if (const auto result = ::pthread_create(&thread_, &attr_, &workloadWrapper, this); result != 0)
 		{
-			return bzd::error::Errno("pthread_create");
+			// Realtime scheduling policies require the CAP_SYS_NICE capability, EPERM is returned otherwise.
+			return bzd::error::Errno("pthread_create", result);
 		}
 
 		return bzd::nullresult;
@@ -99,48 +112,375 @@ public:
 		return bzd::nullresult;
 	}
 
-	StackSize getStackUsage() noexcept override { return stack_->estimateMaxUsage(); }
+	/// Estimate the maximum stack usage, with a page granularity.
+	///
+	/// Stack pages are only committed when first touched, so the lowest resident page gives the
+	/// high-water mark. Pages swapped out are not accounted for.
+	StackSize getStackUsage() noexcept override
+	{
+		constexpr Size chunkPageCount{64u};
+		unsigned char residency[chunkPageCount];
+		const Size pageCount = stack_.size() / pageSize_;
+		// The stack grows downward, look for the first resident page from the lowest address.
+		for (Size first = 0u; first < pageCount; first += chunkPageCount)
+		{
+			const auto count = bzd::min(chunkPageCount, pageCount - first);
+			if (::mincore(stack_.data() + first * pageSize_, count * pageSize_, residency) != 0)
+			{
+				return 0u;
+			}
+			for (Size index = 0u; index < count; ++index)
+			{
+				if (residency[index] & 0x1u)
+				{
+					return static_cast<StackSize>((pageCount - first - index) * pageSize_);
+				}
+			}
+		}
+		return 0u;
+	}
 
-	bzd::Size startUsageMonitoring() noexcept
+	void setBusy(const bzd::Bool busy) noexcept override
 	{
-		// We can use https://man7.org/linux/man-pages/man2/getrusage.2.html
+		const auto now = getMonotonicTime();
+		if (busy)
+		{
+			busySince_.store(now, MemoryOrder::relaxed);
+		}
+		else if (const auto since = busySince_.exchange(0u, MemoryOrder::relaxed); since)
+		{
+			busyTime_.fetchAdd(now - since, MemoryOrder::relaxed);
+		}
+	}
 
-		// Get the clock_id associated to the current thread.
-		clockid_t clockId;
-		::pthread_getcpuclockid(thread_, &clockId);
+	/// Get the usage of the core since the previous call.
+	///
+	/// The CPU time is read from the thread CPU clock and the context switches from the procfs status
+	/// of the thread, opened once by the thread itself. This is meant to be called periodically from a
+	/// single sampler.
+	Result<bzd::CoreUsage, bzd::Error> getUsage() noexcept override
+	{
+		const auto tid = tid_.load();
+		if (tid == 0)
+		{
+			return bzd::error::Failure("Core not started."_csv);
+		}
 
-		struct timespec ts;
-		if (::clock_gettime(clockId, &ts))
+		auto maybeSample = takeSample(thread_);
+		if (!maybeSample)
 		{
+			return bzd::move(maybeSample).propagate();
 		}
+		const auto& sample = maybeSample.value();
 
-		[[maybe_unused]] const auto timeNano = ts.tv_sec * 1000000000 + ts.tv_nsec;
+		const auto percent = [&](const UInt64 current, const UInt64 previous) -> bzd::Float32 {
+			const auto period = sample.wall - sample_.wall;
+			if (period == 0u || current < previous)
+			{
+				return 0.f;
+			}
+			const auto value = static_cast<bzd::Float32>(current - previous) * 100.f / static_cast<bzd::Float32>(period);
+			return (value > 100.f) ? 100.f : value;
+		};
+		bzd::CoreUsage usage{};
+		usage.cpu = percent(sample.cpu, sample_.cpu);
+		usage.busy = percent(sample.busy, sample_.busy);
+		usage.voluntarySwitches = static_cast<UInt32>(sample.voluntarySwitches - sample_.voluntarySwitches);
+		usage.involuntarySwitches = static_cast<UInt32>(sample.involuntarySwitches - sample_.involuntarySwitches);
+		sample_ = sample;
 
-		// in percent
-		// use pthread_getcpuclockid
-		return 0;
+		return usage;
 	}
 
-	void getUsage() noexcept {}
+	/// Periodically sample the usage of the core and publish it.
+	bzd::Async<> monitor() noexcept
+	{
+		while (true)
+		{
+			co_await !context_.config.timer.delay(bzd::units::Millisecond{context_.config.samplingPeriod});
+			if (const auto maybeUsage = getUsage(); maybeUsage)
+			{
+				const auto& usage = maybeUsage.value();
+				co_await !context_.io.cpu.set(usage.cpu);
+				co_await !context_.io.busy.set(usage.busy);
+				co_await !context_.io.voluntarySwitches.set(static_cast<bzd::Int32>(usage.voluntarySwitches));
+				co_await !context_.io.involuntarySwitches.set(static_cast<bzd::Int32>(usage.involuntarySwitches));
+			}
+		}
+		co_return {};
+	}
 
 	CoreId getId() noexcept override { return core_id_; }
 
 private:
+	/// Snapshot of the usage counters, times are in nanoseconds.
+	struct Sample
+	{
+		UInt64 wall{0u};
+		UInt64 cpu{0u};
+		UInt64 busy{0u};
+		UInt64 voluntarySwitches{0u};
+		UInt64 involuntarySwitches{0u};
+	};
+
+	/// Take a snapshot of the usage counters of a thread.
+	Result<Sample, bzd::Error> takeSample(const ::pthread_t thread) const noexcept
+	{
+		Sample sample{};
+		sample.wall = getMonotonicTime();
+
+		clockid_t clockId;
+		if (const auto result = ::pthread_getcpuclockid(thread, &clockId); result != 0)
+		{
+			return bzd::error::Errno("pthread_getcpuclockid", result);
+		}
+		::timespec ts{};
+		if (::clock_gettime(clockId, &ts) != 0)
+		{
+			return bzd::error::Errno("clock_gettime");
+		}
+		sample.cpu = static_cast<UInt64>(ts.tv_sec) * 1000000000u + static_cast<UInt64>(ts.tv_nsec);
+
+		// Account for the current busy period if any.
+		const auto since = busySince_.load(MemoryOrder::relaxed);
+		sample.busy = busyTime_.load(MemoryOrder::relaxed) + ((since && sample.wall > since) ? sample.wall - since : 0u);
+
+		if (auto result = readContextSwitches(sample); !result)
+		{
+			return bzd::move(result).propagate();
+		}
+		return sample;
+	}
+
+	static UInt64 getMonotonicTime() noexcept
+	{
+		::timespec ts{};
+		::clock_gettime(CLOCK_MONOTONIC, &ts);
+		return static_cast<UInt64>(ts.tv_sec) * 1000000000u + static_cast<UInt64>(ts.tv_nsec);
+	}
+
+	/// Read the context switch counters of the thread.
+	///
+	/// getrusage(RUSAGE_THREAD) only reports the calling thread, so they are read from procfs instead.
+	/// The file is kept open and read from its start, its content is generated on each read.
+	Result<void, bzd::Error> readContextSwitches(Sample& sample) const noexcept
+	{
+		if (statusFd_ == -1)
+		{
+			return bzd::error::Failure("Thread status not available."_csv);
+		}
+		char buffer[4096];
+		const auto size = ::pread(statusFd_, buffer, sizeof(buffer) - 1u, 0);
+		if (size <= 0)
+		{
+			return bzd::error::Errno("read");
+		}
+		buffer[size] = '\0';
+
+		const auto parse = [&buffer](const char* key) -> bzd::Optional<UInt64> {
+			const char* it = ::strstr(buffer, key);
+			if (!it)
+			{
+				return bzd::nullopt;
+			}
+			it += ::strlen(key);
+			while (*it == ' ' || *it == '\t')
+			{
+				++it;
+			}
+			UInt64 value{0u};
+			for (; *it >= '0' && *it <= '9'; ++it)
+			{
+				value = value * 10u + static_cast<UInt64>(*it - '0');
+			}
+			return value;
+		};
+		const auto voluntary = parse("\nvoluntary_ctxt_switches:");
+		const auto involuntary = parse("\nnonvoluntary_ctxt_switches:");
+		if (!voluntary || !involuntary)
+		{
+			return bzd::error::Failure("Context switches not found in the thread status."_csv);
+		}
+		sample.voluntarySwitches = voluntary.value();
+		sample.involuntarySwitches = involuntary.value();
+		return bzd::nullresult;
+	}
+
+	/// Map the stack, on a specific NUMA node if requested.
+	///
+	/// Pages are committed lazily by the kernel on first access and a guard page is placed right below
+	/// the stack, so an overflow faults deterministically.
+	Result<Span<Byte>, bzd::Error> allocateStack() noexcept
+	{
+		const auto pageSize = ::sysconf(_SC_PAGESIZE);
+		if (pageSize == -1)
+		{
+			return bzd::error::Errno("sysconf");
+		}
+		pageSize_ = static_cast<Size>(pageSize);
+		const Size stackSize = bzd::alignUp(Context::Config::stackSize, pageSize_);
+
+		void* memory = ::mmap(nullptr,
+							  stackSize + pageSize_,
+							  PROT_READ | PROT_WRITE,
+							  MAP_PRIVATE | MAP_ANONYMOUS | MAP_STACK | MAP_NORESERVE,
+							  -1,
+							  0);
+		if (memory == MAP_FAILED)
+		{
+			return bzd::error::Errno("mmap");
+		}
+		// The stack grows downward, the guard page is therefore the lowest one.
+		if (::mprotect(memory, pageSize_, PROT_NONE) != 0)
+		{
+			const auto error = errno;
+			::munmap(memory, stackSize + pageSize_);
+			return bzd::error::Errno("mprotect", error);
+		}
+		auto* stack = static_cast<Byte*>(memory) + pageSize_;
+
+		// Bind the memory to the node, pages will then be allocated on this node when first touched.
+		if (context_.config.numaNode >= 0)
+		{
+			constexpr Size maskBits = sizeof(unsigned long) * 8u;
+			// The node is within [0; 63] by contract, the mask only keeps the compiler from warning about the negative case.
+			const unsigned long nodeMask = 1ul << (static_cast<unsigned long>(context_.config.numaNode) & (maskBits - 1u));
+			// The kernel reads maxnode - 1 bits of the mask, so one more is needed for the last node of the mask.
+			if (::syscall(SYS_mbind, stack, stackSize, MPOL_BIND, &nodeMask, maskBits + 1u, 0u) != 0)
+			{
+				const auto error = errno;
+				::munmap(memory, stackSize + pageSize_);
+				return bzd::error::Errno("mbind", error);
+			}
+		}
+
+		return Span<Byte>{stack, stackSize};
+	}
+
+	/// Pin the thread to the configured CPU set, if any.
+	Result<void, bzd::Error> setAffinity() noexcept
+	{
+		if (context_.config.cpus.empty())
+		{
+			return bzd::nullresult;
+		}
+		::cpu_set_t set;
+		CPU_ZERO(&set);
+		for (const auto cpu : context_.config.cpus)
+		{
+			if (cpu < 0 || cpu >= CPU_SETSIZE)
+			{
+				return bzd::error::Failure("CPU {} is out of range."_csv, cpu);
+			}
+			CPU_SET(static_cast<Size>(cpu), &set);
+		}
+		if (const auto result = ::pthread_attr_setaffinity_np(&attr_, sizeof(set), &set); result != 0)
+		{
+			return bzd::error::Errno("pthread_attr_setaffinity_np", result);
+		}
+		return bzd::nullresult;
+	}
+
+	/// Set the scheduling policy and priority, the default policy inherits the ones of the creating thread.
+	Result<void, bzd::Error> setScheduling() noexcept
+	{
+		int policy;
+		switch (context_.config.policy)
+		{
+		case SchedulingPolicy::fifo:
+			policy = SCHED_FIFO;
+			break;
+		case SchedulingPolicy::roundRobin:
+			policy = SCHED_RR;
+			break;
+		case SchedulingPolicy::other:
+		default:
+			return bzd::nullresult;
+		}
+
+		const auto min = ::sched_get_priority_min(policy);
+		const auto max = ::sched_get_priority_max(policy);
+		if (min == -1 || max == -1)
+		{
+			return bzd::error::Errno("sched_get_priority_min/max");
+		}
+		::sched_param param{};
+		param.sched_priority = min + (max - min) * static_cast<int>(context_.config.priority) / 100;
+
+		if (const auto result = ::pthread_attr_setinheritsched(&attr_, PTHREAD_EXPLICIT_SCHED); result != 0)
+		{
+			return bzd::error::Errno("pthread_attr_setinheritsched", result);
+		}
+		if (const auto result = ::pthread_attr_setschedpolicy(&attr_, policy); result != 0)
+		{
+			return bzd::error::Errno("pthread_attr_setschedpolicy", result);
+		}
+		if (const auto result = ::pthread_attr_setschedparam(&attr_, &param); result != 0)
+		{
+			return bzd::error::Errno("pthread_attr_setschedparam", result);
+		}
+		return bzd::nullresult;
+	}
+
+	/// Name the calling thread, to identify it in tools like top or gdb.
+	/// This is done from the thread itself, as the workload might already be completed otherwise.
+	void setName() noexcept
+	{
+		const bzd::StringView name{context_.config.name};
+		if (name.empty())
+		{
+			return;
+		}
+		char buffer[threadNameMaxSize + 1u]{};
+		const auto size = bzd::min(name.size(), threadNameMaxSize);
+		for (Size i = 0u; i < size; ++i)
+		{
+			buffer[i] = name[i];
+		}
+		// Naming is only informative, a failure is not fatal.
+		[[maybe_unused]] const auto result = ::pthread_setname_np(::pthread_self(), buffer);
+	}
+
 	static void* workloadWrapper(void* object)
 	{
 		auto linux = reinterpret_cast<Self*>(object);
 		auto& workload = linux->workload_.value();
+		const auto tid = ::gettid();
+		if (linux->statusFd_ != -1)
+		{
+			::close(linux->statusFd_);
+		}
+		linux->statusFd_ = ::open("/proc/thread-self/status", O_RDONLY | O_CLOEXEC);
+		// Seed the usage before publishing the thread identifier, so the first sample covers the period since the start.
+		if (auto maybeSample = linux->takeSample(::pthread_self()); maybeSample)
+		{
+			linux->sample_ = maybeSample.value();
+		}
+		linux->tid_.store(tid);
+		linux->setName();
 		// bzd::print("Workload Wrapper Enter\n"_csv).sync();
 		workload(*linux);
 		// bzd::print("Workload Wrapper Exit\n"_csv).sync();
-		// bzd::print("Stack usage: {:} / {:}\n"_csv, linux->getStackUsage(), linux->stack_->size()).sync();
+		// bzd::print("Stack usage: {:} / {:}\n"_csv, linux->getStackUsage(), linux->stack_.size()).sync();
 
 		return nullptr;
 	}
 
 private:
+	Context& context_;
 	CoreId core_id_;
-	bzd::Optional<bzd::interface::Stack<StackDirection::downward>> stack_{};
+	bzd::Span<Byte> stack_{};
+	Size pageSize_{0u};
+	/// Kernel identifier of the thread, 0 until started.
+	bzd::Atomic<::pid_t> tid_{0};
+	/// Procfs status of the thread, opened by the thread before its identifier is published.
+	int statusFd_{-1};
+	/// Start of the current busy period in nanoseconds, 0 when idle.
+	bzd::Atomic<UInt64> busySince_{0u};
+	/// Accumulated busy time in nanoseconds.
+	bzd::Atomic<UInt64> busyTime_{0u};
+	/// Previous usage sample.
+	Sample sample_{};
 	bzd::Optional<bzd::FunctionRef<void(bzd::Core&)>> workload_;
 	pthread_attr_t attr_;
 	pthread_t thread_;
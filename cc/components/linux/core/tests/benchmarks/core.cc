@@ -0,0 +1,182 @@
+#include "cc/components/linux/core/core.hh"
+
+#include "cc/bzd/algorithm/sort.hh"
+#include "cc/bzd/container/array.hh"
+#include "cc/bzd/container/vector.hh"
+#include "cc/bzd/platform/atomic.hh"
+#include "cc/bzd/test/test.hh"
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <sched.h>
+#include <thread>
+
+namespace {
+
+struct Config
+{
+	static constexpr bzd::Size stackSize{65536u};
+	bzd::StringView name{"benchmark"};
+	bzd::Vector<bzd::Int32, 16u> cpus{};
+	bzd::Int32 numaNode{-1};
+	bzd::components::linux::SchedulingPolicy policy{bzd::components::linux::SchedulingPolicy::other};
+	bzd::Int32 priority{0};
+};
+
+struct Context
+{
+	using Config = ::Config;
+	Config config{};
+};
+
+using Core = bzd::components::linux::Core<Context>;
+
+/// Wake-up latencies, accumulated over all the runs of a benchmark.
+class Latencies
+{
+public:
+	/// Maximum number of latencies recorded, the following ones are ignored.
+	static constexpr bzd::Size capacity{16384u};
+
+	void push(const bzd::Float64 ns) noexcept
+	{
+		if (size_ < capacity)
+		{
+			values_[size_++] = ns;
+		}
+	}
+
+	/// Report the maximum, the 99th percentile and the standard deviation of the latencies, in nanoseconds.
+	void report(bzd::test::Benchmark& benchmark) noexcept
+	{
+		if (size_ == 0u)
+		{
+			return;
+		}
+		bzd::Span<bzd::Float64> values{values_.data(), size_};
+		bzd::algorithm::sort(values);
+		bzd::Float64 mean{0.};
+		for (const auto value : values)
+		{
+			mean += value;
+		}
+		mean /= static_cast<bzd::Float64>(size_);
+		bzd::Float64 variance{0.};
+		for (const auto value : values)
+		{
+			variance += (value - mean) * (value - mean);
+		}
+		variance /= static_cast<bzd::Float64>(size_);
+		benchmark.setMetric("latencyMax"_sv, values[size_ - 1u]);
+		benchmark.setMetric("latencyP99"_sv, values[(size_ - 1u) * 99u / 100u]);
+		benchmark.setMetric("latencyStddev"_sv, std::sqrt(variance));
+	}
+
+private:
+	bzd::Array<bzd::Float64, capacity> values_{};
+	bzd::Size size_{0u};
+};
+
+} // namespace
+
+// Outside of the anonymous namespace to keep the benchmark names short.
+struct Unpinned
+{
+	static void configure(Config&) noexcept {}
+};
+
+/// Pinned to the CPU set by the `BZD_BENCHMARK_CPU` environment variable, by default to the last CPU this process
+/// can run on, as the first ones usually handle more interrupts.
+struct Pinned
+{
+	static void configure(Config& config) noexcept
+	{
+		if (const char* cpu = ::std::getenv("BZD_BENCHMARK_CPU"); cpu && *cpu)
+		{
+			config.cpus.pushBack(static_cast<bzd::Int32>(::std::atoi(cpu)));
+			return;
+		}
+		::cpu_set_t set;
+		CPU_ZERO(&set);
+		if (::sched_getaffinity(0, sizeof(set), &set) == 0)
+		{
+			for (bzd::Int32 cpu = CPU_SETSIZE - 1; cpu >= 0; --cpu)
+			{
+				if (CPU_ISSET(cpu, &set))
+				{
+					config.cpus.pushBack(cpu);
+					return;
+				}
+			}
+		}
+	}
+};
+
+// Each iteration sleeps for a fixed period on the core. The latency of every wake-up past this period is recorded,
+// its maximum, 99th percentile and standard deviation are reported as `latencyMax`, `latencyP99` and `latencyStddev`.
+BENCHMARK(LinuxCore, Jitter, (Unpinned, Pinned))
+{
+	constexpr auto period = ::std::chrono::microseconds{100};
+	static Latencies latencies{};
+
+	Context context{};
+	TestType::configure(context.config);
+	Core core{context};
+
+	const auto workload = [&](bzd::Core&) {
+		for (auto _ : benchmark)
+		{
+			const auto start = ::std::chrono::steady_clock::now();
+			::std::this_thread::sleep_for(period);
+			const auto elapsed = ::std::chrono::steady_clock::now() - start;
+			latencies.push(::std::chrono::duration<bzd::Float64, ::std::nano>{elapsed - period}.count());
+		}
+	};
+	ASSERT_TRUE(core.start(bzd::FunctionRef<void(bzd::Core&)>{workload}));
+	ASSERT_TRUE(core.stop());
+	latencies.report(benchmark);
+}
+
+// Cost of bringing a core up and down: mapping its stack, creating and joining its thread.
+BENCHMARK(LinuxCore, Startup)
+{
+	Context context{};
+	const auto workload = [](bzd::Core&) {};
+
+	for (auto _ : benchmark)
+	{
+		Core core{context};
+		[[maybe_unused]] const auto isStarted = core.start(bzd::FunctionRef<void(bzd::Core&)>{workload});
+		[[maybe_unused]] const auto isStopped = core.stop();
+	}
+}
+
+// Cost of a usage sample, with the minimum sampling period of 10 ms the 0.1% overhead target allows 10 us per sample.
+BENCHMARK(LinuxCore, Sampling)
+{
+	Context context{};
+	Core core{context};
+	bzd::Atomic<bzd::Bool> isStarted{false};
+	bzd::Atomic<bzd::Bool> isDone{false};
+	const auto workload = [&](bzd::Core&) {
+		isStarted.store(true);
+		while (!isDone.load())
+		{
+			::std::this_thread::sleep_for(::std::chrono::milliseconds{1});
+		}
+	};
+	ASSERT_TRUE(core.start(bzd::FunctionRef<void(bzd::Core&)>{workload}));
+	while (!isStarted.load())
+	{
+		::std::this_thread::yield();
+	}
+
+	for (auto _ : benchmark)
+	{
+		bzd::test::doNotOptimize(core.getUsage());
+	}
+
+	isDone.store(true);
+	ASSERT_TRUE(core.stop());
+}
@@ -0,0 +1,129 @@
+#include "cc/components/linux/core/core.hh"
+
+#include "cc/bzd/container/vector.hh"
+#include "cc/bzd/platform/atomic.hh"
+#include "cc/bzd/test/test.hh"
+
+#include <chrono>
+#include <csignal>
+#include <sys/wait.h>
+#include <thread>
+#include <unistd.h>
+
+namespace {
+
+template <bzd::Size stackSizeValue>
+struct Config
+{
+	static constexpr bzd::Size stackSize{stackSizeValue};
+	bzd::StringView name{"test"};
+	bzd::Vector<bzd::Int32, 16u> cpus{};
+	bzd::Int32 numaNode{-1};
+	bzd::components::linux::SchedulingPolicy policy{bzd::components::linux::SchedulingPolicy::other};
+	bzd::Int32 priority{0};
+};
+
+template <bzd::Size stackSize = 65536u>
+struct Context
+{
+	using Config = ::Config<stackSize>;
+	Config config{};
+};
+
+template <bzd::Size stackSize = 65536u>
+using Core = bzd::components::linux::Core<Context<stackSize>>;
+
+/// Keep the core busy on the CPU for a specific duration.
+void spin(const ::std::chrono::milliseconds duration) noexcept
+{
+	const auto end = ::std::chrono::steady_clock::now() + duration;
+	while (::std::chrono::steady_clock::now() < end)
+	{
+	}
+}
+
+/// Recurse until the stack overflows, each frame is written to so that the pages are actually touched.
+[[gnu::noinline]] bzd::Size recurse(const bzd::Size depth) noexcept
+{
+	volatile bzd::Byte frame[1024];
+	frame[0] = static_cast<bzd::Byte>(depth);
+	// Far beyond the size of the stacks used in this test, only there to make the recursion finite.
+	if (depth > 1024u * 1024u)
+	{
+		return depth;
+	}
+	return recurse(depth + 1u) + static_cast<bzd::Size>(frame[0]);
+}
+
+} // namespace
+
+TEST(LinuxCore, Usage)
+{
+	Context<> context{};
+	Core<> core{context};
+	EXPECT_FALSE(core.getUsage());
+
+	bzd::Atomic<bzd::Bool> isStarted{false};
+	bzd::Atomic<bzd::Bool> isDone{false};
+	const auto workload = [&](bzd::Core&) {
+		isStarted.store(true);
+		while (!isDone.load())
+		{
+			spin(::std::chrono::milliseconds{1});
+		}
+	};
+	ASSERT_TRUE(core.start(bzd::FunctionRef<void(bzd::Core&)>{workload}));
+	while (!isStarted.load())
+	{
+		::std::this_thread::yield();
+	}
+
+	// The first sample covers the period since the core started, not since an arbitrary origin.
+	::std::this_thread::sleep_for(::std::chrono::milliseconds{50});
+	const auto usage = core.getUsage();
+	isDone.store(true);
+	ASSERT_TRUE(core.stop());
+
+	ASSERT_TRUE(usage);
+	EXPECT_GT(usage.value().cpu, 10.f);
+	EXPECT_LE(usage.value().cpu, 100.f);
+}
+
+TEST(LinuxCore, LazyStack)
+{
+	constexpr bzd::Size stackSize{1024u * 1024u};
+	Context<stackSize> context{};
+	Core<stackSize> core{context};
+
+	const auto workload = [](bzd::Core&) {};
+	ASSERT_TRUE(core.start(bzd::FunctionRef<void(bzd::Core&)>{workload}));
+	ASSERT_TRUE(core.stop());
+
+	// Only the pages touched by the thread are resident, not the whole stack.
+	EXPECT_GT(core.getStackUsage(), 0u);
+	EXPECT_LT(core.getStackUsage(), stackSize / 4u);
+}
+
+TEST(LinuxCore, StackOverflow)
+{
+	// The overflow happens in a child process, which is expected to be killed by the guard page.
+	const auto pid = ::fork();
+	ASSERT_NE(pid, -1);
+	if (pid == 0)
+	{
+		::signal(SIGSEGV, SIG_DFL);
+		Context<> context{};
+		Core<> core{context};
+		const auto workload = [](bzd::Core&) { bzd::test::doNotOptimize(recurse(0u)); };
+		if (core.start(bzd::FunctionRef<void(bzd::Core&)>{workload}))
+		{
+			static_cast<void>(core.stop());
+		}
+		::_exit(0);
+	}
+
+	int status{0};
+	ASSERT_EQ(::waitpid(pid, &status, 0), pid);
+	ASSERT_TRUE(WIFSIGNALED(status));
+	EXPECT_EQ(WTERMSIG(status), SIGSEGV);
+}
@@ -0,0 +1,469 @@
+#pragma once
+
+#include "cc/bzd/algorithm/sort.hh"
+#include "cc/bzd/container/array.hh"
+#include "cc/bzd/container/hash_map.hh"
+#include "cc/bzd/container/optional.hh"
+#include "cc/bzd/container/span.hh"
+#include "cc/bzd/core/async/executor_profiler.hh"
+#include "cc/bzd/platform/processor.hh"
+#include "cc/bzd/type_traits/is_same.hh"
+#include "cc/bzd/utility/synchronization/spin_mutex.hh"
+#include "cc/bzd/utility/synchronization/sync_lock_guard.hh"
+#include "cc/components/linux/executor_profiler/perf/interface.hh"
+
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cxxabi.h>
+#include <dlfcn.h>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace bzd::components::linux {
+
+/// Hardware counters read around the executables.
+enum class PerfCounter : UInt8
+{
+	cycles = 0,
+	instructions = 1,
+	cacheMisses = 2,
+	branchMisses = 3,
+};
+
+/// Where the counters come from.
+enum class PerfSource : UInt8
+{
+	/// The hardware performance counters, through perf_event_open.
+	perf,
+	/// Only the cycle counter of the processor, which might not run at the frequency of the core.
+	cycleCounter,
+	/// Only the number of resumes is counted.
+	none,
+};
+
+/// Counters accumulated for a coroutine.
+struct PerfCounters
+{
+	static constexpr Size size{4u};
+
+	/// Number of times the coroutine was resumed.
+	UInt64 count{0u};
+	bzd::Array<UInt64, size> values{};
+
+	[[nodiscard]] constexpr UInt64 get(const PerfCounter counter) const noexcept { return values[static_cast<Size>(counter)]; }
+
+	constexpr PerfCounters& operator+=(const PerfCounters& other) noexcept
+	{
+		count += other.count;
+		for (Size i = 0u; i < size; ++i)
+		{
+			values[i] += other.values[i];
+		}
+		return *this;
+	}
+};
+
+template <class Context>
+class ExecutorProfilerPerf
+{
+private:
+	using Self = ExecutorProfilerPerf<Context>;
+	/// Maximum number of coroutines tracked.
+	static constexpr Size capacity{static_cast<Size>(Context::Config::size)};
+	using Map = bzd::HashMap<const void*, PerfCounters, capacity>;
+
+public:
+	/// Profiler of a single core, it must be created and used from the thread of the core.
+	class CoreProfilerPerf
+	{
+	public:
+		explicit CoreProfilerPerf(Self& parent) noexcept : parent_{parent} { open(); }
+
+		CoreProfilerPerf(const CoreProfilerPerf&) = delete;
+		CoreProfilerPerf& operator=(const CoreProfilerPerf&) = delete;
+		CoreProfilerPerf(CoreProfilerPerf&&) = delete;
+		CoreProfilerPerf& operator=(CoreProfilerPerf&&) = delete;
+
+		~CoreProfilerPerf() noexcept
+		{
+			if (leader_ != -1)
+			{
+				for (Size i = 0u; i < PerfCounters::size; ++i)
+				{
+					if (pages_[i])
+					{
+						::munmap(const_cast<::perf_event_mmap_page*>(pages_[i]), pageSize_);
+					}
+					if (fds_[i] != -1)
+					{
+						::close(fds_[i]);
+					}
+				}
+			}
+			parent_.merge(*this);
+		}
+
+		template <class Event>
+		void event(const Event event) noexcept
+		{
+			if constexpr (bzd::concepts::sameAs<Event, bzd::async::profiler::ExecutableResumed>)
+			{
+				type_ = event.type;
+				read(start_);
+			}
+			else if constexpr (bzd::concepts::sameAs<Event, bzd::async::profiler::ExecutableSuspended>)
+			{
+				PerfCounters counters{.count = 1u};
+				read(counters.values);
+				for (Size i = 0u; i < PerfCounters::size; ++i)
+				{
+					counters.values[i] -= start_[i];
+				}
+				accumulate(type_, counters);
+			}
+		}
+
+	private:
+		friend class ExecutorProfilerPerf<Context>;
+
+		/// Open the counters as a single group, so they are scheduled together and read with a single system call.
+		void open() noexcept
+		{
+			constexpr bzd::Array<UInt64, PerfCounters::size> configs{bzd::inPlace,
+																	 PERF_COUNT_HW_CPU_CYCLES,
+																	 PERF_COUNT_HW_INSTRUCTIONS,
+																	 PERF_COUNT_HW_CACHE_MISSES,
+																	 PERF_COUNT_HW_BRANCH_MISSES};
+
+			for (Size i = 0u; i < PerfCounters::size; ++i)
+			{
+				::perf_event_attr attr{};
+				attr.type = PERF_TYPE_HARDWARE;
+				attr.size = sizeof(attr);
+				attr.config = configs[i];
+				attr.disabled = (leader_ == -1) ? 1 : 0;
+				// Only measure the executables, not the kernel, this also works with restrictive perf_event_paranoid.
+				attr.exclude_kernel = 1;
+				attr.exclude_hv = 1;
+				attr.read_format = PERF_FORMAT_GROUP;
+				// Calling thread, on any CPU.
+				const auto fd = static_cast<int>(::syscall(SYS_perf_event_open, &attr, 0, -1, leader_, PERF_FLAG_FD_CLOEXEC));
+				if (i == 0u && fd == -1)
+				{
+					// Without the cycles there is no point in the others.
+					source_ = (bzd::platform::readCycleCounter() != 0u) ? PerfSource::cycleCounter : PerfSource::none;
+					error_ = errno;
+					return;
+				}
+				fds_[i] = fd;
+				if (fd != -1)
+				{
+					leader_ = (leader_ == -1) ? fd : leader_;
+					available_ |= (1u << i);
+					// Map the metadata page of the counter, to read it from user space when the processor allows it.
+					void* page = ::mmap(nullptr, pageSize_, PROT_READ, MAP_SHARED, fd, 0);
+					pages_[i] = (page == MAP_FAILED) ? nullptr : static_cast<const volatile ::perf_event_mmap_page*>(page);
+				}
+			}
+			source_ = PerfSource::perf;
+			::ioctl(leader_, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+			::ioctl(leader_, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+		}
+
+		void read(bzd::Array<UInt64, PerfCounters::size>& values) noexcept
+		{
+			if (source_ == PerfSource::perf)
+			{
+				if (readUser(values))
+				{
+					return;
+				}
+				// The values of the counters that could be opened, in their opening order.
+				struct
+				{
+					UInt64 count;
+					UInt64 values[PerfCounters::size];
+				} data{};
+				if (::read(leader_, &data, sizeof(data)) > 0)
+				{
+					for (Size i = 0u, index = 0u; i < PerfCounters::size; ++i)
+					{
+						values[i] = (fds_[i] != -1 && index < data.count) ? data.values[index++] : 0u;
+					}
+				}
+			}
+			else if (source_ == PerfSource::cycleCounter)
+			{
+				values[static_cast<Size>(PerfCounter::cycles)] = bzd::platform::readCycleCounter();
+			}
+		}
+
+		/// Read the counters with rdpmc, which avoids the cost of a system call on every resume and suspend.
+		///
+		/// \return false if one of the counters cannot be read this way, in which case values might be partially updated.
+		bool readUser(bzd::Array<UInt64, PerfCounters::size>& values) const noexcept
+		{
+#if defined(__x86_64__) || defined(__i386__)
+			for (Size i = 0u; i < PerfCounters::size; ++i)
+			{
+				values[i] = 0u;
+				if (fds_[i] == -1)
+				{
+					continue;
+				}
+				const auto* page = pages_[i];
+				if (!page)
+				{
+					return false;
+				}
+				// The kernel updates the page under a sequence lock, retry until the values read are consistent.
+				UInt32 sequence{};
+				do
+				{
+					sequence = page->lock;
+					__atomic_signal_fence(__ATOMIC_SEQ_CST);
+					const UInt32 index = page->index;
+					if (!page->cap_user_rdpmc || index == 0u)
+					{
+						return false;
+					}
+					const UInt32 shift = 64u - static_cast<UInt32>(page->pmc_width);
+					// Sign extend the counter from its hardware width.
+					const auto count = static_cast<Int64>(__builtin_ia32_rdpmc(static_cast<int>(index - 1u)) << shift) >> shift;
+					values[i] = static_cast<UInt64>(page->offset + count);
+					__atomic_signal_fence(__ATOMIC_SEQ_CST);
+				} while (page->lock != sequence);
+			}
+			return true;
+#else
+			(void)values;
+			return false;
+#endif
+		}
+
+		void accumulate(const void* type, const PerfCounters& counters) noexcept
+		{
+			if (auto it = counters_.find(type); it != counters_.end())
+			{
+				it->second += counters;
+			}
+			else if (counters_.size() < counters_.capacity())
+			{
+				counters_.insert(type, counters);
+			}
+			else
+			{
+				others_ += counters;
+			}
+		}
+
+	private:
+		Self& parent_;
+		PerfSource source_{PerfSource::none};
+		int error_{0};
+		int leader_{-1};
+		bzd::Array<int, PerfCounters::size> fds_{bzd::inPlace, -1, -1, -1, -1};
+		Size pageSize_{static_cast<Size>(::sysconf(_SC_PAGESIZE))};
+		bzd::Array<const volatile ::perf_event_mmap_page*, PerfCounters::size> pages_{};
+		/// Bitmask of the counters available.
+		UInt32 available_{0u};
+		const void* type_{nullptr};
+		bzd::Array<UInt64, PerfCounters::size> start_{};
+		Map counters_{};
+		PerfCounters others_{};
+	};
+
+public:
+	constexpr explicit ExecutorProfilerPerf(Context&) noexcept {}
+
+	/// Create the profiler of a core, this must be called from the thread of the core.
+	[[nodiscard]] CoreProfilerPerf makeCoreProfiler() noexcept { return CoreProfilerPerf{*this}; }
+
+	/// Report the profile, this must be called once all the cores are done.
+	void stop() noexcept { print(); }
+
+	/// Get the counters accumulated for a coroutine, from the cores that are done.
+	///
+	/// \param type The type identifier of the coroutine, see `ExecutableResumed::type`.
+	[[nodiscard]] bzd::Optional<PerfCounters> getCounters(const void* type) noexcept
+	{
+		const auto lock = makeSyncLockGuard(mutex_);
+		if (const auto it = counters_.find(type); it != counters_.end())
+		{
+			return it->second;
+		}
+		return bzd::nullopt;
+	}
+
+	/// Get the counters accumulated for all the coroutines, from the cores that are done.
+	[[nodiscard]] PerfCounters getTotal() noexcept
+	{
+		const auto lock = makeSyncLockGuard(mutex_);
+		PerfCounters total{others_};
+		for (const auto& [type, counters] : counters_)
+		{
+			total += counters;
+		}
+		return total;
+	}
+
+	/// Get the least capable source of counters among the cores that are done.
+	[[nodiscard]] PerfSource getSource() noexcept
+	{
+		const auto lock = makeSyncLockGuard(mutex_);
+		return source_;
+	}
+
+	/// Print the profile on the standard error, the coroutines using the most cycles first.
+	void print() noexcept
+	{
+		const auto lock = makeSyncLockGuard(mutex_);
+
+		struct Entry
+		{
+			const void* type;
+			PerfCounters counters;
+		};
+		bzd::Array<Entry, capacity + 1u> entries{};
+		Size size{0u};
+		PerfCounters total{};
+		for (const auto& [type, counters] : counters_)
+		{
+			entries[size++] = {type, counters};
+			total += counters;
+		}
+		if (others_.count)
+		{
+			entries[size++] = {nullptr, others_};
+			total += others_;
+		}
+		bzd::algorithm::sort(bzd::Span<Entry>{entries.data(), size}, [](const auto& a, const auto& b) {
+			return a.counters.get(PerfCounter::cycles) > b.counters.get(PerfCounter::cycles);
+		});
+
+		switch (source_)
+		{
+		case PerfSource::perf:
+			::fprintf(stderr, "Executor profile, %llu resume(s):\n", static_cast<unsigned long long>(total.count));
+			break;
+		case PerfSource::cycleCounter:
+			::fprintf(stderr,
+					  "Executor profile, %llu resume(s), performance counters not available (%s), using the processor cycle counter:\n",
+					  static_cast<unsigned long long>(total.count),
+					  ::strerror(error_));
+			break;
+		case PerfSource::none:
+			::fprintf(stderr,
+					  "Executor profile, %llu resume(s), performance counters not available (%s):\n",
+					  static_cast<unsigned long long>(total.count),
+					  ::strerror(error_));
+			break;
+		}
+		::fprintf(stderr,
+				  "%10s %8s %14s %8s %14s %14s  %s\n",
+				  "resumes",
+				  "cycles%",
+				  "cycles/resume",
+				  "IPC",
+				  "cacheMiss/res",
+				  "branchMiss/res",
+				  "coroutine");
+		const auto totalCycles = static_cast<double>(total.get(PerfCounter::cycles));
+		for (Size index = 0u; index < size; ++index)
+		{
+			const auto& [type, counters] = entries[index];
+			const auto count = static_cast<double>(counters.count);
+			const auto cycles = static_cast<double>(counters.get(PerfCounter::cycles));
+			::fprintf(stderr, "%10llu ", static_cast<unsigned long long>(counters.count));
+			::fprintf(stderr, "%7.2f%% ", (totalCycles > 0.) ? 100. * cycles / totalCycles : 0.);
+			::fprintf(stderr, "%14.1f ", cycles / count);
+			printRatio(PerfCounter::instructions, static_cast<double>(counters.get(PerfCounter::instructions)) / cycles, "%8.2f ", "%8s ");
+			printRatio(PerfCounter::cacheMisses, static_cast<double>(counters.get(PerfCounter::cacheMisses)) / count, "%14.2f ", "%14s ");
+			printRatio(PerfCounter::branchMisses, static_cast<double>(counters.get(PerfCounter::branchMisses)) / count, "%14.2f ", "%14s ");
+			printType(type);
+		}
+	}
+
+private:
+	void merge(const CoreProfilerPerf& profiler) noexcept
+	{
+		const auto lock = makeSyncLockGuard(mutex_);
+		for (const auto& [type, counters] : profiler.counters_)
+		{
+			if (auto it = counters_.find(type); it != counters_.end())
+			{
+				it->second += counters;
+			}
+			else if (counters_.size() < counters_.capacity())
+			{
+				counters_.insert(type, counters);
+			}
+			else
+			{
+				others_ += counters;
+			}
+		}
+		others_ += profiler.others_;
+		if (static_cast<UInt8>(profiler.source_) > static_cast<UInt8>(source_))
+		{
+			source_ = profiler.source_;
+			error_ = profiler.error_;
+		}
+		available_ &= (profiler.source_ == PerfSource::perf) ? profiler.available_ : 0u;
+	}
+
+	void printRatio(const PerfCounter counter, const double value, const char* format, const char* formatUnavailable) const noexcept
+	{
+		if (available_ & (1u << static_cast<UInt32>(counter)))
+		{
+			::fprintf(stderr, format, value);
+		}
+		else
+		{
+			::fprintf(stderr, formatUnavailable, "-");
+		}
+	}
+
+	/// Print the name of the coroutine if it is exported, its location in its module otherwise, to be used with addr2line.
+	static void printType(const void* type) noexcept
+	{
+		::Dl_info info{};
+		if (!type)
+		{
+			::fprintf(stderr, "<others>\n");
+		}
+		else if (::dladdr(type, &info) && info.dli_sname && info.dli_saddr == type)
+		{
+			int status{0};
+			char* name = abi::__cxa_demangle(info.dli_sname, nullptr, nullptr, &status);
+			::fprintf(stderr, "%s\n", (status == 0 && name) ? name : info.dli_sname);
+			::free(name);
+		}
+		else if (info.dli_fname && info.dli_fbase)
+		{
+			::fprintf(stderr,
+					  "%s+0x%llx\n",
+					  info.dli_fname,
+					  static_cast<unsigned long long>(reinterpret_cast<IntPointer>(type) - reinterpret_cast<IntPointer>(info.dli_fbase)));
+		}
+		else
+		{
+			::fprintf(stderr, "%p\n", type);
+		}
+	}
+
+private:
+	bzd::SpinMutex mutex_{};
+	PerfSource source_{PerfSource::perf};
+	int error_{0};
+	UInt32 available_{~UInt32{0u}};
+	Map counters_{};
+	PerfCounters others_{};
+};
+
+} // namespace bzd::components::linux
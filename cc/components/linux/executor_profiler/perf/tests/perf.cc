@@ -0,0 +1,112 @@
+#include "cc/components/linux/executor_profiler/perf/perf.hh"
+
+#include "cc/bzd/core/async.hh"
+#include "cc/bzd/test/test.hh"
+
+namespace {
+
+struct Config
+{
+	static constexpr bzd::Size size{2u};
+};
+
+struct Context
+{
+	using Config = ::Config;
+	Config config;
+};
+
+using Profiler = bzd::components::linux::ExecutorProfilerPerf<Context>;
+using bzd::components::linux::PerfCounter;
+using bzd::components::linux::PerfSource;
+
+void resume(auto& profiler, const void* type) noexcept
+{
+	profiler.event(bzd::async::profiler::ExecutableResumed{/*id*/ nullptr, type});
+	volatile bzd::UInt64 sum{0u};
+	for (bzd::Size i = 0u; i < 1000u; ++i)
+	{
+		sum = sum + i;
+	}
+	profiler.event(bzd::async::profiler::ExecutableSuspended{});
+}
+
+bzd::Async<> workload() noexcept
+{
+	for (bzd::Size i = 0u; i < 10u; ++i)
+	{
+		co_await bzd::async::yield();
+	}
+	co_return {};
+}
+
+} // namespace
+
+TEST(ExecutorProfilerPerf, Counters)
+{
+	Context context{};
+	Profiler profiler{context};
+	const int a{0}, b{0}, c{0};
+
+	{
+		auto core = profiler.makeCoreProfiler();
+		resume(core, &a);
+		resume(core, &b);
+		resume(core, &a);
+		// Unrelated events are ignored.
+		core.event(bzd::async::profiler::CoreIdle{});
+		// Above the capacity, the counters are merged together.
+		resume(core, &c);
+	}
+
+	const auto counters = profiler.getCounters(&a);
+	ASSERT_TRUE(counters);
+	EXPECT_EQ(counters->count, 2u);
+	if (profiler.getSource() != PerfSource::none)
+	{
+		EXPECT_GT(counters->get(PerfCounter::cycles), 0u);
+	}
+	EXPECT_EQ(profiler.getCounters(&b)->count, 1u);
+	EXPECT_FALSE(profiler.getCounters(&c));
+	EXPECT_EQ(profiler.getTotal().count, 4u);
+}
+
+TEST(ExecutorProfilerPerf, MultipleCores)
+{
+	Context context{};
+	Profiler profiler{context};
+	const int a{0};
+
+	{
+		auto core1 = profiler.makeCoreProfiler();
+		{
+			auto core2 = profiler.makeCoreProfiler();
+			resume(core2, &a);
+		}
+		resume(core1, &a);
+		resume(core1, &a);
+	}
+
+	EXPECT_EQ(profiler.getCounters(&a)->count, 3u);
+}
+
+TEST(ExecutorProfilerPerf, Executor)
+{
+	Context context{};
+	Profiler profiler{context};
+	bzd::async::Executor executor{};
+
+	auto promise = workload();
+	promise.enqueue(executor);
+	{
+		auto core = profiler.makeCoreProfiler();
+		executor.run(/*coreUId*/ 0u, core);
+	}
+
+	EXPECT_TRUE(promise.hasResult());
+	// Once to start and once after each yield.
+	EXPECT_EQ(profiler.getTotal().count, 11u);
+
+	// The profile is reported explicitly at the end of the run, not when the last core is done.
+	profiler.stop();
+}
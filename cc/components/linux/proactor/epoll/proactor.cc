@@ -23,7 +23,7 @@ bzd::Async<> Proactor::init() noexcept
 }
 
 // NOLINTNEXTLINE(bugprone-exception-escape)
-bzd::Async<bzd::Span<const bzd::Byte>> Proactor::read(const posix::FileDescriptor fd, bzd::Span<bzd::Byte>&& data) noexcept
+bzd::Async<> Proactor::waitReadable(const posix::FileDescriptor fd) noexcept
 {
 	// Wait until some data is available.
 	{
@@ -51,6 +51,13 @@ bzd::Async<bzd::Span<const bzd::Byte>> Proactor::read(const posix::FileDescripto
 		// Sleeping is active for the whole executor (so all cores associated with an executor).
 		// The idle task runs once all run from the executor are done.
 	}
+	co_return {};
+}
+
+// NOLINTNEXTLINE(bugprone-exception-escape)
+bzd::Async<bzd::Span<const bzd::Byte>> Proactor::read(const posix::FileDescriptor fd, bzd::Span<bzd::Byte>&& data) noexcept
+{
+	co_await !waitReadable(fd);
 
 	// TODO: create a scope to opt-out as well.
 
@@ -63,6 +70,21 @@ bzd::Async<bzd::Span<const bzd::Byte>> Proactor::read(const posix::FileDescripto
 	co_return data.first(static_cast<bzd::Size>(size));
 }
 
+// NOLINTNEXTLINE(bugprone-exception-escape)
+bzd::Async<posix::ReceiveBuffer> Proactor::readProvided(const posix::FileDescriptor fd) noexcept
+{
+	co_await !waitReadable(fd);
+
+	auto buffer = co_await !receiveBuffers_.acquire();
+	const auto size = ::read(fd.native(), buffer.storage().data(), buffer.storage().size());
+	if (size < 0)
+	{
+		co_return bzd::error::Errno("read");
+	}
+	buffer.resize(static_cast<bzd::Size>(size));
+	co_return bzd::move(buffer);
+}
+
 // NOLINTNEXTLINE(bugprone-exception-escape)
 bzd::Async<> Proactor::exec() noexcept
 {
@@ -21,6 +21,7 @@ private:
 public:
 	using posix::sync::Proactor::connect;
 	using posix::sync::Proactor::write;
+	using posix::sync::Proactor::writev;
 
 	template <class Context>
 	constexpr Proactor(Context& context) noexcept : posix::sync::Proactor{context}
@@ -33,9 +34,17 @@ public:
 	/// Perform an asynchronous read operator.
 	bzd::Async<bzd::Span<const bzd::Byte>> read(const posix::FileDescriptor fd, bzd::Span<bzd::Byte>&& data) noexcept;
 
+	/// Perform an asynchronous read operator into a buffer provided by this proactor.
+	/// The buffer is only taken once the file descriptor is readable.
+	bzd::Async<posix::ReceiveBuffer> readProvided(const posix::FileDescriptor fd) noexcept;
+
 	/// Execution loop for the reactor to poll events.
 	bzd::Async<> exec() noexcept;
 
+private:
+	/// Wait until the file descriptor has some data to be read.
+	bzd::Async<> waitReadable(const posix::FileDescriptor fd) noexcept;
+
 private:
 	posix::FileDescriptorOwner epollFd_{};
 };
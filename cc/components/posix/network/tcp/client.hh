@@ -86,17 +86,37 @@ struct ClientTraits<bzd::components::posix::network::tcp::Client<Context>>
 			co_return co_await context_.config.proactor.write(socket_.getFileDescriptor(), data);
 		}
 
+		bzd::Async<> writeVectored(const bzd::Span<const bzd::Span<const Byte>> segments) noexcept final
+		{
+			co_return co_await context_.config.proactor.writev(socket_.getFileDescriptor(), segments);
+		}
+
 	protected:
+		/// Data is received into the span passed by the caller, or into buffers provided by the proactor if it is empty.
+		/// Each buffer is given back to the proactor as soon as the generator advances.
 		bzd::Generator<bzd::Span<const Byte>> readerImpl(bzd::Span<Byte> data) noexcept final
 		{
+			auto& proactor = context_.config.proactor;
 			while (true)
 			{
-				auto dataRead = co_await !context_.config.proactor.read(socket_.getFileDescriptor(), bzd::move(data));
-				if (dataRead.empty())
+				if (data.empty())
+				{
+					auto buffer = co_await !proactor.readProvided(socket_.getFileDescriptor());
+					if (buffer.empty())
+					{
+						break;
+					}
+					co_yield buffer.data();
+				}
+				else
 				{
-					break;
+					const auto received = co_await !proactor.read(socket_.getFileDescriptor(), bzd::Span<Byte>{data});
+					if (received.empty())
+					{
+						break;
+					}
+					co_yield received;
 				}
-				co_yield dataRead;
 			}
 		}
 
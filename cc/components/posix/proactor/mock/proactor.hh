@@ -9,9 +9,21 @@ class Proactor : public bzd::components::posix::Proactor<Proactor>
 public:
 	bzd::Async<> write(const FileDescriptor, const bzd::Span<const bzd::Byte>) noexcept { co_return {}; }
 
+	bzd::Async<> writev(const FileDescriptor, const bzd::Span<const bzd::Span<const bzd::Byte>>) noexcept { co_return {}; }
+
 	bzd::Async<bzd::Span<const bzd::Byte>> read(const FileDescriptor, bzd::Span<bzd::Byte>&& data) noexcept { co_return data.first(1u); }
 
+	bzd::Async<ReceiveBuffer> readProvided(const FileDescriptor) noexcept
+	{
+		auto buffer = co_await !receiveBuffers_.acquire();
+		buffer.resize(1u);
+		co_return bzd::move(buffer);
+	}
+
 	bzd::Async<> connect(const FileDescriptor, const network::Address&) noexcept { co_return {}; }
+
+private:
+	ReceiveBuffers<1u, 2u> receiveBuffers_{};
 };
 
 } // namespace bzd::components::posix::mock
@@ -3,6 +3,7 @@
 #include "cc/bzd/core/async.hh"
 #include "cc/components/posix/io/file_descriptor.hh"
 #include "cc/components/posix/network/address/address.hh"
+#include "cc/components/posix/proactor/receive_buffers.hh"
 
 namespace bzd::components::posix {
 
@@ -19,6 +20,17 @@ public:
 		return bzd::impl::getImplementation(this, &Proactor::write, &Impl::write)->write(fd, data);
 	}
 
+	/// Write multiple segments to a file descriptor at once: https://man7.org/linux/man-pages/man2/writev.2.html
+	///
+	/// Segments are written in order, as if they were concatenated.
+	///
+	/// \param fd The file descriptor to write to.
+	/// \param segments The data segments to be written.
+	bzd::Async<> writev(const FileDescriptor fd, const bzd::Span<const bzd::Span<const bzd::Byte>> segments) noexcept
+	{
+		return bzd::impl::getImplementation(this, &Proactor::writev, &Impl::writev)->writev(fd, segments);
+	}
+
 	/// Perform an asynchronous read operator: https://man7.org/linux/man-pages/man2/read.2.html
 	///
 	/// This function blocks until there is at least a single byte of data to be read.
@@ -32,6 +44,19 @@ public:
 		return bzd::impl::getImplementation(this, &Proactor::read, &Impl::read)->read(fd, bzd::move(data));
 	}
 
+	/// Perform an asynchronous read operation into a buffer provided by the proactor.
+	///
+	/// This function blocks until there is at least a single byte of data to be read, and only then
+	/// takes a buffer from the proactor. The returned buffer points directly to where the data was received,
+	/// it is given back to the proactor when destroyed.
+	///
+	/// \param fd The file descriptor to read from.
+	/// \return The buffer containing the data read, it is empty if the end of the stream is reached.
+	bzd::Async<ReceiveBuffer> readProvided(const FileDescriptor fd) noexcept
+	{
+		return bzd::impl::getImplementation(this, &Proactor::readProvided, &Impl::readProvided)->readProvided(fd);
+	}
+
 	/// Perform an asynchronous connect operator: https://man7.org/linux/man-pages/man2/connect.2.html
 	///
 	/// \param fd The file descriptor to connect.
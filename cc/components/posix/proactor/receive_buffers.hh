@@ -0,0 +1,186 @@
+#pragma once
+
+#include "cc/bzd/container/optional.hh"
+#include "cc/bzd/container/span.hh"
+#include "cc/bzd/core/assert/minimal.hh"
+#include "cc/bzd/core/async.hh"
+#include "cc/bzd/platform/types.hh"
+#include "cc/bzd/utility/synchronization/semaphore.hh"
+#include "cc/bzd/utility/synchronization/spin_mutex.hh"
+#include "cc/bzd/utility/synchronization/sync_lock_guard.hh"
+
+namespace bzd::components::posix::impl {
+class ReceiveBuffers;
+}
+
+namespace bzd::components::posix {
+
+/// Receive buffer lent by a proactor.
+///
+/// It points directly into the storage of the proactor, and is given back to it once destroyed.
+class ReceiveBuffer
+{
+public: // Constructors/assignments.
+	constexpr ReceiveBuffer() noexcept = default;
+	ReceiveBuffer(const ReceiveBuffer&) = delete;
+	ReceiveBuffer& operator=(const ReceiveBuffer&) = delete;
+	constexpr ReceiveBuffer(ReceiveBuffer&& other) noexcept : pool_{other.pool_}, storage_{other.storage_}, size_{other.size_}
+	{
+		other.pool_ = nullptr;
+	}
+	ReceiveBuffer& operator=(ReceiveBuffer&& other) noexcept
+	{
+		reset();
+		pool_ = other.pool_;
+		storage_ = other.storage_;
+		size_ = other.size_;
+		other.pool_ = nullptr;
+		return *this;
+	}
+	~ReceiveBuffer() noexcept { reset(); }
+
+public: // API.
+	/// The data received.
+	[[nodiscard]] constexpr bzd::Span<const bzd::Byte> data() const noexcept { return storage_.first(size_); }
+
+	/// Whether or not this buffer contains data.
+	[[nodiscard]] constexpr bzd::Bool empty() const noexcept { return size_ == 0u; }
+
+	/// The whole storage of this buffer, to be filled by the proactor.
+	[[nodiscard]] constexpr bzd::Span<bzd::Byte> storage() noexcept { return storage_; }
+
+	/// Set the amount of data received into the storage.
+	constexpr void resize(const bzd::Size size) noexcept
+	{
+		bzd::assert::isTrue(size <= storage_.size());
+		size_ = size;
+	}
+
+	/// Give the buffer back to its pool, this is a no-op if the buffer is not owned.
+	void reset() noexcept;
+
+private:
+	friend class impl::ReceiveBuffers;
+
+	constexpr ReceiveBuffer(impl::ReceiveBuffers& pool, const bzd::Span<bzd::Byte> storage) noexcept : pool_{&pool}, storage_{storage} {}
+
+	impl::ReceiveBuffers* pool_{nullptr};
+	bzd::Span<bzd::Byte> storage_{};
+	bzd::Size size_{0u};
+};
+
+} // namespace bzd::components::posix
+
+namespace bzd::components::posix::impl {
+
+/// Slab of fixed size receive buffers owned by a proactor.
+///
+/// Buffers are only lent while data is pending consumption, this allows long-lived connections
+/// to keep at most one buffer resident instead of one per reader.
+class ReceiveBuffers
+{
+public:
+	constexpr ReceiveBuffers(const bzd::Span<bzd::Byte> storage, const bzd::Size bufferSize, const bzd::Span<bzd::Size> free) noexcept :
+		storage_{storage}, bufferSize_{bufferSize}, free_{free}, available_{free.size()}
+	{
+		bzd::assert::isTrue(storage_.size() == free_.size() * bufferSize_);
+	}
+
+public:
+	/// Number of buffers available.
+	[[nodiscard]] bzd::Size available() noexcept { return available_.available(); }
+
+	/// Try to acquire a buffer from the slab, returns immediately.
+	[[nodiscard]] bzd::Optional<ReceiveBuffer> tryAcquire() noexcept
+	{
+		if (!available_.tryAcquire())
+		{
+			return bzd::nullopt;
+		}
+		return take();
+	}
+
+	/// Acquire a buffer from the slab, wait until one is given back if none is available.
+	///
+	/// Waiters are suspended and served in FIFO order, a released buffer is handed over directly to them.
+	bzd::Async<ReceiveBuffer> acquire() noexcept
+	{
+		co_await !available_.acquire();
+		co_return take();
+	}
+
+private:
+	friend class bzd::components::posix::ReceiveBuffer;
+
+	/// Take a buffer out of the slab, a token from `available_` must be held.
+	ReceiveBuffer take() noexcept
+	{
+		const auto scope = bzd::makeSyncLockGuard(mutex_);
+		bzd::Size index{0u};
+		if (freeCount_)
+		{
+			index = free_[--freeCount_];
+		}
+		// Buffers never used so far are handed out last, to keep the memory footprint low.
+		else
+		{
+			bzd::assert::isTrue(used_ < free_.size());
+			index = used_++;
+		}
+		return ReceiveBuffer{*this, storage_.subSpan(index * bufferSize_, bufferSize_)};
+	}
+
+	void release(const bzd::Span<bzd::Byte> buffer) noexcept
+	{
+		{
+			const auto scope = bzd::makeSyncLockGuard(mutex_);
+			free_[freeCount_++] = static_cast<bzd::Size>(buffer.data() - storage_.data()) / bufferSize_;
+		}
+		available_.release();
+	}
+
+private:
+	bzd::Span<bzd::Byte> storage_;
+	bzd::Size bufferSize_;
+	bzd::Span<bzd::Size> free_;
+	bzd::Size freeCount_{0u};
+	bzd::Size used_{0u};
+	bzd::SpinMutex mutex_{};
+	/// One token per buffer available.
+	bzd::Semaphore available_;
+};
+
+} // namespace bzd::components::posix::impl
+
+namespace bzd::components::posix {
+
+inline void ReceiveBuffer::reset() noexcept
+{
+	if (pool_)
+	{
+		pool_->release(storage_);
+		pool_ = nullptr;
+		size_ = 0u;
+	}
+}
+
+namespace interface {
+using ReceiveBuffers = impl::ReceiveBuffers;
+}
+
+/// Slab of `count` receive buffers of `bufferSize` bytes each.
+template <bzd::Size bufferSize, bzd::Size count>
+class ReceiveBuffers : public interface::ReceiveBuffers
+{
+public:
+	constexpr ReceiveBuffers() noexcept :
+		interface::ReceiveBuffers{bzd::Span<bzd::Byte>{storage_, bufferSize * count}, bufferSize, bzd::Span<bzd::Size>{free_, count}}
+	{
+	}
+
+private:
+	bzd::Byte storage_[bufferSize * count];
+	bzd::Size free_[count];
+};
+
+} // namespace bzd::components::posix
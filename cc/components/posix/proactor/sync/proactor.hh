@@ -1,5 +1,6 @@
 #pragma once
 
+#include "cc/bzd/container/array.hh"
 #include "cc/components/posix/error.hh"
 #include "cc/components/posix/network/socket_options.hh"
 #include "cc/components/posix/proactor/interface.hh"
@@ -7,6 +8,7 @@
 #include <cerrno>
 #include <cstring>
 #include <poll.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
 namespace bzd::components::posix::sync {
@@ -16,7 +18,7 @@ class Proactor : public bzd::components::posix::Proactor<Proactor>
 {
 public:
 	template <class Context>
-	constexpr Proactor(Context&) noexcept
+	constexpr Proactor(Context&) noexcept : receiveBuffers_{makeReceiveBuffers<Context>()}
 	{
 	}
 
@@ -42,6 +44,62 @@ public:
 		co_return {};
 	}
 
+	/// Perform a synchronous scatter-gather write operation.
+	///
+	/// Segments are grouped by batches of `iovecBatchSize` and sent with a single system call per batch,
+	/// partial writes are resumed where they stopped.
+	// NOLINTNEXTLINE(bugprone-exception-escape)
+	bzd::Async<> writev(const FileDescriptor fd, const bzd::Span<const bzd::Span<const bzd::Byte>> segments) noexcept
+	{
+		bzd::Array<::iovec, iovecBatchSize> iovecs;
+		bzd::Size index{0u};
+		bzd::Size offset{0u};
+		while (true)
+		{
+			// Gather the non-empty segments left to be written.
+			bzd::Size count{0u};
+			for (bzd::Size i = index, skip = offset; i < segments.size() && count < iovecs.size(); ++i, skip = 0u)
+			{
+				const auto& segment = segments[i];
+				if (segment.size() > skip)
+				{
+					iovecs[count++] = ::iovec{const_cast<bzd::Byte*>(segment.data()) + skip, segment.size() - skip};
+				}
+			}
+			if (count == 0u)
+			{
+				break;
+			}
+
+			const auto result = ::writev(fd.native(), iovecs.data(), static_cast<int>(count));
+			if (result < 0)
+			{
+				if (errno == EAGAIN)
+				{
+					co_await bzd::async::yield();
+					continue;
+				}
+				co_return bzd::error::Errno("writev");
+			}
+
+			// Advance the cursor by the amount of data written.
+			auto written = static_cast<bzd::Size>(result);
+			while (written && index < segments.size())
+			{
+				const auto left = segments[index].size() - offset;
+				if (written < left)
+				{
+					offset += written;
+					break;
+				}
+				written -= left;
+				offset = 0u;
+				++index;
+			}
+		}
+		co_return {};
+	}
+
 	/// Perform a synchronous read operation.
 	// NOLINTNEXTLINE(bugprone-exception-escape)
 	bzd::Async<bzd::Span<const bzd::Byte>> read(const FileDescriptor fd, bzd::Span<bzd::Byte>&& data) noexcept
@@ -62,6 +120,32 @@ public:
 		}
 	}
 
+	/// Perform a synchronous read operation into a buffer provided by this proactor.
+	///
+	/// The read is attempted directly, without polling the file descriptor first. If no data is pending,
+	/// the buffer is given back to the pool before yielding, so that it is only kept while holding data.
+	// NOLINTNEXTLINE(bugprone-exception-escape)
+	bzd::Async<ReceiveBuffer> readProvided(const FileDescriptor fd) noexcept
+	{
+		while (true)
+		{
+			auto buffer = co_await !receiveBuffers_.acquire();
+			const auto result = ::read(fd.native(), buffer.storage().data(), buffer.storage().size());
+			if (result == -1)
+			{
+				if (errno == EAGAIN || errno == EWOULDBLOCK)
+				{
+					buffer.reset();
+					co_await bzd::async::yield();
+					continue;
+				}
+				co_return bzd::error::Errno("read");
+			}
+			buffer.resize(static_cast<bzd::Size>(result));
+			co_return bzd::move(buffer);
+		}
+	}
+
 	/// Perform a synchronous connect operation.
 	// NOLINTNEXTLINE(bugprone-exception-escape)
 	bzd::Async<> connect(const FileDescriptor fd, const network::Address& address) noexcept
@@ -88,7 +172,25 @@ public:
 		co_return {};
 	}
 
+protected:
+	/// Buffers lent by `readProvided`, sized by the configuration of this proactor.
+	interface::ReceiveBuffers& receiveBuffers_;
+
 private:
+	/// Maximum number of segments sent with a single system call.
+	static constexpr bzd::Size iovecBatchSize{16u};
+
+	/// The pool is not part of the proactor, to keep its size out of the object. There is one pool per
+	/// context, hence per proactor instance.
+	template <class Context>
+	static interface::ReceiveBuffers& makeReceiveBuffers() noexcept
+	{
+		static ReceiveBuffers<static_cast<bzd::Size>(Context::Config::receiveBufferSize),
+							  static_cast<bzd::Size>(Context::Config::receiveBufferCount)>
+			receiveBuffers{};
+		return receiveBuffers;
+	}
+
 	// NOLINTNEXTLINE(bugprone-exception-escape)
 	bzd::Async<> poll(const FileDescriptor fd, const short events) noexcept
 	{
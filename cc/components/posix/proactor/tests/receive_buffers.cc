@@ -0,0 +1,82 @@
+#include "cc/components/posix/proactor/receive_buffers.hh"
+
+#include "cc/bzd/test/test.hh"
+
+TEST(ReceiveBuffers, Acquire)
+{
+	bzd::components::posix::ReceiveBuffers<16u, 2u> pool;
+	EXPECT_EQ(pool.available(), 2u);
+
+	{
+		auto maybeBuffer1 = pool.tryAcquire();
+		ASSERT_TRUE(maybeBuffer1);
+		EXPECT_EQ(maybeBuffer1->storage().size(), 16u);
+		EXPECT_TRUE(maybeBuffer1->empty());
+		auto maybeBuffer2 = pool.tryAcquire();
+		ASSERT_TRUE(maybeBuffer2);
+		EXPECT_NE(maybeBuffer1->storage().data(), maybeBuffer2->storage().data());
+		EXPECT_EQ(pool.available(), 0u);
+		EXPECT_FALSE(pool.tryAcquire());
+	}
+
+	EXPECT_EQ(pool.available(), 2u);
+}
+
+TEST(ReceiveBuffers, Reuse)
+{
+	bzd::components::posix::ReceiveBuffers<16u, 4u> pool;
+
+	const bzd::Byte* previous{nullptr};
+	for (bzd::Size i = 0u; i < 10u; ++i)
+	{
+		auto maybeBuffer = pool.tryAcquire();
+		ASSERT_TRUE(maybeBuffer);
+		maybeBuffer->resize(4u);
+		EXPECT_EQ(maybeBuffer->data().size(), 4u);
+		// The same buffer is reused while only one is resident.
+		if (previous)
+		{
+			EXPECT_EQ(previous, maybeBuffer->data().data());
+		}
+		previous = maybeBuffer->data().data();
+	}
+	EXPECT_EQ(pool.available(), 4u);
+}
+
+TEST(ReceiveBuffers, Move)
+{
+	bzd::components::posix::ReceiveBuffers<16u, 1u> pool;
+
+	auto maybeBuffer = pool.tryAcquire();
+	ASSERT_TRUE(maybeBuffer);
+	bzd::components::posix::ReceiveBuffer buffer{bzd::move(maybeBuffer.valueMutable())};
+	maybeBuffer.reset();
+	EXPECT_EQ(pool.available(), 0u);
+	buffer.reset();
+	EXPECT_EQ(pool.available(), 1u);
+}
+
+namespace {
+bzd::Async<> reader(bzd::components::posix::interface::ReceiveBuffers& pool, bzd::Size& active, bzd::Size& maxActive)
+{
+	auto buffer = co_await !pool.acquire();
+	++active;
+	maxActive = (active > maxActive) ? active : maxActive;
+	co_await bzd::async::yield();
+	--active;
+	co_return {};
+}
+} // namespace
+
+TEST_ASYNC(ReceiveBuffers, AcquireWait)
+{
+	bzd::components::posix::ReceiveBuffers<16u, 2u> pool;
+	bzd::Size active{0u};
+	bzd::Size maxActive{0u};
+	// Readers starved of buffers are suspended until one is given back.
+	[[maybe_unused]] const auto result =
+		co_await bzd::async::all(reader(pool, active, maxActive), reader(pool, active, maxActive), reader(pool, active, maxActive));
+	EXPECT_EQ(maxActive, 2u);
+	EXPECT_EQ(pool.available(), 2u);
+	co_return {};
+}
@@ -0,0 +1,64 @@
+#include "cc/components/posix/proactor/sync/proactor.hh"
+
+#include "cc/bzd/test/test.hh"
+
+#include <unistd.h>
+
+namespace {
+struct Context
+{
+	struct Config
+	{
+		static constexpr bzd::Size receiveBufferSize{16u};
+		static constexpr bzd::Size receiveBufferCount{1u};
+	};
+};
+} // namespace
+
+TEST(ProactorSync, Writev)
+{
+	Context context;
+	bzd::components::posix::sync::Proactor proactor{context};
+	int fds[2];
+	ASSERT_EQ(::pipe(fds), 0);
+
+	// More segments than a single batch, with some of them empty.
+	bzd::Span<const bzd::Byte> segments[20];
+	bzd::Size expected{0u};
+	for (bzd::Size i = 0u; i < 20u; ++i)
+	{
+		segments[i] = (i % 3u) ? "0123456789abcdefghij"_sv.asBytes().first(i) : bzd::Span<const bzd::Byte>{};
+		expected += segments[i].size();
+	}
+	EXPECT_TRUE(proactor.writev(bzd::components::posix::FileDescriptor{fds[1]}, segments).sync());
+
+	char buffer[256];
+	EXPECT_EQ(::read(fds[0], buffer, sizeof(buffer)), static_cast<::ssize_t>(expected));
+	::close(fds[0]);
+	::close(fds[1]);
+}
+
+TEST(ProactorSync, ReadProvided)
+{
+	Context context;
+	bzd::components::posix::sync::Proactor proactor{context};
+	int fds[2];
+	ASSERT_EQ(::pipe(fds), 0);
+	ASSERT_EQ(::write(fds[1], "hello", 5u), 5);
+
+	{
+		auto result = proactor.readProvided(bzd::components::posix::FileDescriptor{fds[0]}).sync();
+		ASSERT_TRUE(result);
+		EXPECT_EQ(result.value().data().size(), 5u);
+		EXPECT_EQ(result.value().data()[0], bzd::Byte{'h'});
+	}
+
+	// End of stream.
+	::close(fds[1]);
+	{
+		auto result = proactor.readProvided(bzd::components::posix::FileDescriptor{fds[0]}).sync();
+		ASSERT_TRUE(result);
+		EXPECT_TRUE(result.value().empty());
+	}
+	::close(fds[0]);
+}
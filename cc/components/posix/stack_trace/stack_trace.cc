@@ -1,52 +1,56 @@
-// std
 #include "cc/bzd/container/array.hh"
-#include "cc/bzd/container/optional.hh"
+#include "cc/bzd/container/span.hh"
 #include "cc/bzd/container/string_view.hh"
-#include "cc/bzd/core/channel.hh"
+#include "cc/bzd/core/assert.hh"
+#include "cc/bzd/platform/atomic.hh"
+#include "cc/bzd/platform/coredump/minidump.hh"
 #include "cc/bzd/platform/types.hh"
-#include "cc/bzd/utility/ignore.hh"
-#include "cc/bzd/utility/pattern/to_stream.hh"
-#include "cc/bzd/utility/singleton.hh"
-#include "cc/components/posix/error.hh"
 
-#include <atomic>
 #include <csignal>
 #include <cstdio>
-#include <cstring>
-#include <cxxabi.h>
-#include <dlfcn.h>
+#include <elf.h>
 #include <execinfo.h>
-#include <iomanip>
-#include <iostream>
 #include <link.h>
-#include <memory>
-#include <stdexcept>
-#include <string>
+#include <ucontext.h>
 #include <unistd.h>
 
+// Everything reachable from the signal handler must be async-signal-safe: no heap, no locks, no stdio. All the
+// information that would need them (the loaded modules) is collected when the handler is installed, and the dump
+// is written with a single `write` from a pre-allocated buffer. It is symbolized offline, see
+// `@bzd_python//bzd/apps/minidump`.
+
 namespace {
-class AsyncSignalSafeStream : public bzd::OStream
-{
-public:
-	// NOLINTNEXTLINE(bugprone-exception-escape)
-	bzd::Async<> write(const bzd::Span<const bzd::Byte> data) noexcept final
-	{
-		constexpr int fd = STDERR_FILENO;
 
-		bzd::Size alreadyWritten = 0u;
-		while (alreadyWritten < data.size())
-		{
-			const auto result = ::write(fd, data.data(), data.size());
-			if (result < 0)
-			{
-				co_return bzd::error::Errno("write");
-			}
-			alreadyWritten += result;
-		}
-		co_return {};
-	}
+constexpr bzd::Size maxModules{64u};
+constexpr bzd::Size maxBuildIdSize{32u};
+constexpr bzd::Size maxPathSize{256u};
+constexpr bzd::Size maxStackLevel{64u};
+constexpr bzd::Size dumpSize{8192u};
+constexpr bzd::StringView dumpPrefix{"minidump:"};
+
+#if defined(__x86_64__)
+constexpr bzd::UInt16 machine{EM_X86_64};
+#elif defined(__aarch64__)
+constexpr bzd::UInt16 machine{EM_AARCH64};
+#else
+constexpr bzd::UInt16 machine{EM_NONE};
+#endif
+
+/// A module loaded when the handler was installed.
+struct Module
+{
+	bzd::UInt64 bias;
+	bzd::UInt64 start;
+	bzd::UInt64 end;
+	bzd::Array<bzd::Byte, maxBuildIdSize> buildId;
+	bzd::Size buildIdSize;
+	bzd::Array<char, maxPathSize> path;
+	bzd::Size pathSize;
 };
 
+bzd::Array<Module, maxModules> modules{};
+bzd::Size moduleCount{0u};
+
 constexpr const char* getSignalName(int sig) noexcept
 {
 	switch (sig)
@@ -112,221 +116,183 @@ constexpr const char* getSignalName(int sig) noexcept
 	}
 }
 
-bzd::StringView exec(const char* cmd)
+/// Copy a null terminated string, truncated to the size of the output.
+bzd::Size copyString(const char* const str, const bzd::Span<char> output) noexcept
 {
-	constexpr ::std::size_t maxSize = 1024;
-	static char result[maxSize + 1];
-	::std::memset(result, 0, sizeof(result));
-
-	// Using "int(*)(FILE*)" instead of "decltype(&pclose)" because of this (on nixos):
-	// https://stackoverflow.com/questions/76867698/what-does-ignoring-attributes-on-template-argument-mean-in-this-context
-	::std::unique_ptr<FILE, int (*)(FILE*)> pipe(::popen(cmd, "r"), ::pclose);
-	if (!pipe)
-	{
-		return nullptr;
-	}
-
-	::std::size_t index = 0;
-	while (index < maxSize && ::fgets(&result[index], static_cast<int>(maxSize - index), pipe.get()) != nullptr)
+	bzd::Size size{0u};
+	while (str && str[size] != '\0' && size < output.size())
 	{
-		index = ::strlen(result);
+		output[size] = str[size];
+		++size;
 	}
-
-	result[sizeof(result) - 1] = '\0';
-	return bzd::StringView{result};
+	return size;
 }
 
-bzd::StringView readLine(bzd::StringView str, bzd::Size& start)
+/// Get the GNU build id from the notes of a module.
+bzd::Size getBuildId(const ::dl_phdr_info& info, const ::ElfW(Phdr) & header, const bzd::Span<bzd::Byte> output) noexcept
 {
-	const auto end = str.find('\n', start);
-	if (end != bzd::npos)
+	auto* const first = reinterpret_cast<const bzd::Byte*>(info.dlpi_addr + header.p_vaddr);
+	const auto* const last = first + header.p_memsz;
+	for (auto* current = first; current + sizeof(::ElfW(Nhdr)) <= last;)
 	{
-		const auto line = str.subStr(start, end - start);
-		// Needs to be modified
-		const_cast<char&>(str[end]) = '\0';
-		start = end + 1;
-		return line;
+		const auto& note = *reinterpret_cast<const ::ElfW(Nhdr)*>(current);
+		const auto* const name = current + sizeof(::ElfW(Nhdr));
+		const auto* const desc = name + ((note.n_namesz + 3u) & ~3u);
+		if (note.n_type == NT_GNU_BUILD_ID && note.n_namesz == 4u && desc + note.n_descsz <= last &&
+			name[0] == bzd::Byte{'G'} && name[1] == bzd::Byte{'N'} && name[2] == bzd::Byte{'U'})
+		{
+			const auto size = (note.n_descsz < output.size()) ? note.n_descsz : output.size();
+			for (bzd::Size i = 0u; i < size; ++i)
+			{
+				output[i] = desc[i];
+			}
+			return size;
+		}
+		current = desc + ((note.n_descsz + 3u) & ~3u);
 	}
-	return "";
+	return 0u;
 }
 
-struct DemangledBuffer
+int collectModule(::dl_phdr_info* info, bzd::Size, void*) noexcept
 {
-	static constexpr bzd::Size initialSize = 1024;
-
-	DemangledBuffer() noexcept
+	if (moduleCount == maxModules)
 	{
-		data = static_cast<char*>(::malloc(initialSize));
-		bzd::assert::isTrue(data);
-		size = initialSize;
+		return 1;
 	}
-
-	~DemangledBuffer()
+	auto& module = modules[moduleCount];
+	module.bias = info->dlpi_addr;
+	module.start = ~bzd::UInt64{0u};
+	module.end = 0u;
+	module.buildIdSize = 0u;
+	for (bzd::Size index = 0u; index < info->dlpi_phnum; ++index)
 	{
-		if (data)
+		const auto& header = info->dlpi_phdr[index];
+		if (header.p_type == PT_LOAD)
+		{
+			const bzd::UInt64 start = info->dlpi_addr + header.p_vaddr;
+			module.start = (start < module.start) ? start : module.start;
+			module.end = (start + header.p_memsz > module.end) ? start + header.p_memsz : module.end;
+		}
+		else if (header.p_type == PT_NOTE && module.buildIdSize == 0u)
 		{
-			::free(data);
+			module.buildIdSize = getBuildId(*info, header, bzd::Span<bzd::Byte>{module.buildId.data(), module.buildId.size()});
 		}
 	}
-
-	char* data{nullptr};
-	bzd::Size size{0};
-};
-// Pre-allocate data for demangling
-DemangledBuffer demangleBuffer{};
-
-bzd::Optional<bzd::StringView> tryDemangle(const char* const pSymbol) noexcept
-{
-	int status;
-	auto data = abi::__cxa_demangle(pSymbol, demangleBuffer.data, &demangleBuffer.size, &status);
-	if (data)
+	if (module.end == 0u)
 	{
-		demangleBuffer.data = data;
+		return 0;
 	}
-	if (status != 0)
+	// The main program has no name.
+	if (moduleCount == 0u && (!info->dlpi_name || info->dlpi_name[0] == '\0'))
 	{
-		return bzd::nullopt;
+		const auto size = ::readlink("/proc/self/exe", module.path.data(), module.path.size());
+		module.pathSize = (size > 0) ? static_cast<bzd::Size>(size) : 0u;
 	}
-
-	return bzd::StringView{demangleBuffer.data};
-}
-
-struct SymbolicInfo
-{
-	bzd::StringView path{};
-	bzd::StringView symbol{};
-	void* address{};
-	bzd::IntPointer offset{};
-};
-
-static void* getSelfBaseAddress()
-{
-	Dl_info info{};
-	const auto result = ::dladdr(reinterpret_cast<const void*>(getSelfBaseAddress), &info);
-	return (result) ? info.dli_fbase : nullptr;
+	else
+	{
+		module.pathSize = copyString(info->dlpi_name, bzd::Span<char>{module.path.data(), module.path.size()});
+	}
+	++moduleCount;
+	return 0;
 }
 
-SymbolicInfo makeSymbolicInfo(void* address)
+/// Collect the registers from the signal context.
+bzd::Size getRegisters([[maybe_unused]] const void* const context, [[maybe_unused]] const bzd::Span<bzd::UInt64> output) noexcept
 {
-	static auto selfBaseAddress = getSelfBaseAddress();
-	SymbolicInfo symbolicInfo{};
-	Dl_info info{};
-	void* extraInfo{nullptr};
-	const auto result = ::dladdr1(address, &info, &extraInfo, RTLD_DL_LINKMAP);
-
-	if (result)
+	bzd::Size count{0u};
+#if defined(__x86_64__)
+	const auto& gregs = static_cast<const ::ucontext_t*>(context)->uc_mcontext.gregs;
+	for (; count < NGREG && count < output.size(); ++count)
+	{
+		output[count] = static_cast<bzd::UInt64>(gregs[count]);
+	}
+#elif defined(__aarch64__)
+	const auto& mcontext = static_cast<const ::ucontext_t*>(context)->uc_mcontext;
+	for (; count < 31u && count < output.size(); ++count)
+	{
+		output[count] = mcontext.regs[count];
+	}
+	for (const auto value : {mcontext.sp, mcontext.pc, mcontext.pstate})
 	{
-		if (info.dli_saddr)
+		if (count < output.size())
 		{
-			symbolicInfo.offset = reinterpret_cast<bzd::IntPointer>(address) - reinterpret_cast<bzd::IntPointer>(info.dli_saddr);
+			output[count++] = value;
 		}
-		/*else if (extraInfo)
-		{
-			const ::link_map& linkMap = reinterpret_cast<const ::link_map&>(extraInfo);
-			// NOLINTNEXTLINE(clang-analyzer-core.UndefinedBinaryOperatorResult)
-			symbolicInfo.offset = reinterpret_cast<bzd::IntPointer>(address) - reinterpret_cast<bzd::IntPointer>(linkMap.l_ld);
-		}*/
 	}
-
-	symbolicInfo.address = (info.dli_fbase == selfBaseAddress) ? address : reinterpret_cast<void*>(symbolicInfo.offset);
-	symbolicInfo.path = (info.dli_fname) ? bzd::StringView{info.dli_fname} : bzd::StringView{""};
-	symbolicInfo.symbol = (info.dli_sname) ? bzd::StringView{info.dli_sname} : bzd::StringView{""};
-
-	return symbolicInfo;
+#endif
+	return count;
 }
 
-void callStack() noexcept // NOLINT(bugprone-exception-escape)
+/// Write the whole buffer to the standard error.
+void writeAll(const bzd::Span<const char> data) noexcept
 {
-	constexpr size_t maxStackLevel = 32;
-	static void* addresses[maxStackLevel];
-
-	const int nbLevels = ::backtrace(addresses, maxStackLevel);
-	AsyncSignalSafeStream stream;
-
-	for (int level = 0; level < nbLevels; ++level)
+	bzd::Size alreadyWritten = 0u;
+	while (alreadyWritten < data.size())
 	{
-		// Do not print the last stack trace, but ellipsis instead.
-		if (level == maxStackLevel - 1)
+		const auto result = ::write(STDERR_FILENO, data.data() + alreadyWritten, data.size() - alreadyWritten);
+		if (result <= 0)
 		{
-			toStream(stream, "...\n"_sv).sync();
 			return;
 		}
-
-		auto address = addresses[level];
-		const auto info = makeSymbolicInfo(address);
-		bzd::StringView path{info.path};
-		bzd::StringView symbol{info.symbol};
-
-		// Look for improved function/source names with addr2line
-		if (!path.empty())
-		{
-			bzd::String<1024> command;
-			toString(command.assigner(),
-					 "exec 2>/dev/null; addr2line -f -e \"{}\" {:#x} {:#x}"_csv,
-					 path,
-					 reinterpret_cast<bzd::IntPointer>(info.address),
-					 info.offset);
-
-			{
-				const auto result = exec(command.data());
-				bzd::Size start = 0;
-				const auto line1 = readLine(result, start);
-				const auto line2 = readLine(result, start);
-				const auto line3 = readLine(result, start);
-				const auto line4 = readLine(result, start);
-				symbol = (line1.size() && line1.at(0) != '?') ? line1 : symbol;
-				symbol = (line3.size() && line3.at(0) != '?') ? line3 : symbol;
-				path = (line2.size() && line2.at(0) != '?') ? line2 : path;
-				path = (line4.size() && line4.at(0) != '?') ? line4 : path;
-			}
-
-			// Remove useless path prefix.
-			for (const auto prefix : {"/proc/self/cwd/"_sv})
-			{
-				if (const auto index = path.find(prefix); index == 0)
-				{
-					path.removePrefix(prefix.size());
-					break;
-				}
-			}
-		}
-
-		if (symbol.data())
-		{
-			const auto maybeDemangled = tryDemangle(symbol.data());
-			if (maybeDemangled)
-			{
-				symbol = maybeDemangled.value();
-			}
-		}
-
-		// Print stack trace number and memory address
-		toStream(stream,
-				 "#{:d} {:#x} in {}+{:#x} {}\n"_csv,
-				 level,
-				 reinterpret_cast<uint64_t>(address),
-				 symbol.data(),
-				 info.offset,
-				 path.data())
-			.sync();
+		alreadyWritten += static_cast<bzd::Size>(result);
 	}
-	toStream(stream, "---\n"_sv).sync();
 }
 
-void sigHandler(const int sig)
+void sigHandler(const int sig, ::siginfo_t*, void* context)
 {
 	// Ensure only a single instance is running at a time
-	static volatile std::atomic_flag sigHandlerInProgress{};
-	if (sigHandlerInProgress.test_and_set())
+	static bzd::Atomic<bzd::Bool> sigHandlerInProgress{false};
+	if (sigHandlerInProgress.exchange(true))
 	{
 		return;
 	}
 
-	AsyncSignalSafeStream stream;
-	toStream(stream, "\nCaught signal: {} ({:d})\n"_csv, getSignalName(sig), sig).sync();
+	// Pre-allocated, the alternate signal stack is too small for them.
+	static void* addresses[maxStackLevel];
+	static bzd::UInt64 registers[64u];
+	static bzd::Byte dump[dumpSize];
+	static char text[128u + dumpPrefix.size() + 2u * dumpSize + 1u];
+
+	bzd::platform::coredump::Minidump minidump{dump};
+	minidump.header(machine, sig);
+	// The registers and the call stack go first, so that they are kept if the modules do not all fit in the dump.
+	minidump.registers(bzd::Span<const bzd::UInt64>{registers, getRegisters(context, registers)});
+	const auto nbLevels = ::backtrace(addresses, maxStackLevel);
+	minidump.frames(bzd::Span<void* const>{addresses, static_cast<bzd::Size>(nbLevels)});
+	for (bzd::Size index = 0u; index < moduleCount; ++index)
+	{
+		const auto& module = modules[index];
+		minidump.module(module.bias,
+						module.start,
+						module.end,
+						bzd::Span<const bzd::Byte>{module.buildId.data(), module.buildIdSize},
+						bzd::StringView{module.path.data(), module.pathSize});
+	}
+	const auto data = minidump.end();
+
+	// Format as a single text line, so it can go through logs.
+	bzd::Size size{0u};
+	const auto append = [&](const char* const str) { size += copyString(str, bzd::Span<char>{text + size, sizeof(text) - size}); };
+	append("\nCaught signal: ");
+	append(getSignalName(sig));
+	append("\n");
+	append(dumpPrefix.data());
+	constexpr const char* digits = "0123456789abcdef";
+	for (const auto byte : data)
+	{
+		if (size + 3u > sizeof(text))
+		{
+			break;
+		}
+		text[size++] = digits[static_cast<bzd::UInt8>(byte) >> 4u];
+		text[size++] = digits[static_cast<bzd::UInt8>(byte) & 0xfu];
+	}
+	append("\n");
+	writeAll(bzd::Span<const char>{text, size});
 
-	callStack();
-	std::exit(sig);
+	// Terminate with the default action of this signal, it is triggered once this handler returns.
+	::signal(sig, SIG_DFL);
+	::raise(sig);
 }
 } // namespace
 
@@ -344,10 +310,17 @@ bool installStackTrace()
 		bzd::assert::unreachable();
 	}
 
+	// Modules loaded later are not part of the dump, walking them from the handler is not async-signal-safe.
+	::dl_iterate_phdr(collectModule, nullptr);
+
+	// The first call to `backtrace` loads the unwinder, which allocates, so it must not happen in the handler.
+	void* warmup[1];
+	::backtrace(warmup, 1);
+
 	struct ::sigaction sa;
 	sigemptyset(&sa.sa_mask);
-	sa.sa_handler = sigHandler;
-	sa.sa_flags = SA_ONSTACK;
+	sa.sa_sigaction = sigHandler;
+	sa.sa_flags = SA_ONSTACK | SA_SIGINFO;
 
 	for (const auto& signal : {SIGSEGV, SIGFPE, SIGILL, SIGSYS, SIGABRT, SIGBUS, SIGTERM, SIGINT, SIGHUP})
 	{
@@ -11,7 +11,7 @@
 
 namespace bzd::components::posix {
 template <class Context>
-class In : public bzd::IStream
+class In final : public bzd::IStream
 {
 public: // Constructors
 	constexpr In(Context& context) noexcept : context_{context}
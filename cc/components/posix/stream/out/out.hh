@@ -3,21 +3,23 @@
 #include "cc/bzd/core/channel.hh"
 #include "cc/components/posix/stream/out/interface.hh"
 
-#include <iostream>
 #include <unistd.h>
 
 namespace bzd::components::posix {
 template <class Context>
-class Out : public bzd::OStream
+class Out final : public bzd::OStream
 {
 public:
 	constexpr Out(Context& context) noexcept : context_{context} {}
 
 	bzd::Async<> write(const bzd::Span<const bzd::Byte> data) noexcept final
 	{
-		co_await !context_.config.proactor.write(out_, data);
-		::std::flush(::std::cout);
-		co_return {};
+		co_return co_await context_.config.proactor.write(out_, data);
+	}
+
+	bzd::Async<> writeVectored(const bzd::Span<const bzd::Span<const bzd::Byte>> segments) noexcept final
+	{
+		co_return co_await context_.config.proactor.writev(out_, segments);
 	}
 
 private:
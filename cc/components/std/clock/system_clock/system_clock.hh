@@ -4,7 +4,7 @@
 
 namespace bzd::components::std::clock {
 
-class SystemClock : public bzd::Clock
+class SystemClock final : public bzd::Clock
 {
 public:
 	template <class Context>
@@ -6,7 +6,7 @@
 #include <unistd.h>
 
 namespace bzd::components::std {
-class Out : public bzd::OStream
+class Out final : public bzd::OStream
 {
 public:
 	Out() = default;
@@ -4,7 +4,7 @@
 
 namespace bzd::components::std::timer {
 
-class SteadyClock : public bzd::Timer
+class SteadyClock final : public bzd::Timer
 {
 public:
 	template <class Context>
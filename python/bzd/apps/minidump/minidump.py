@@ -0,0 +1,144 @@
+import argparse
+import pathlib
+import signal
+import subprocess
+import sys
+import typing
+
+from elftools.elf.elffile import ELFFile
+
+from bzd.apps.minidump.parser import Minidump, Module
+
+
+def readBuildId(path: pathlib.Path) -> typing.Optional[bytes]:
+	"""Read the GNU build id of an ELF file."""
+
+	with open(path, "rb") as f:
+		elffile = ELFFile(f)  # type: ignore
+		for section in elffile.iter_sections():
+			if section["sh_type"] != "SHT_NOTE":
+				continue
+			for note in section.iter_notes():  # type: ignore
+				if note["n_type"] == "NT_GNU_BUILD_ID":
+					return bytes.fromhex(note["n_desc"])
+	return None
+
+
+def resolveModule(module: Module, searchPaths: typing.List[pathlib.Path]) -> typing.Optional[pathlib.Path]:
+	"""Find the binary matching a module, first in the search paths, then at its run-time location."""
+
+	path = pathlib.Path(module.path)
+	candidates = [searchPath / path.name for searchPath in searchPaths]
+	candidates += [searchPath for searchPath in searchPaths if searchPath.is_file()]
+	candidates.append(path)
+	for candidate in candidates:
+		if not candidate.is_file():
+			continue
+		try:
+			buildId = readBuildId(candidate)
+		except Exception:
+			continue
+		if not module.buildId or buildId == module.buildId:
+			return candidate
+	return None
+
+
+def symbolize(addr2line: str, binary: pathlib.Path, addresses: typing.List[int]) -> typing.Dict[int, typing.List[str]]:
+	"""Symbolize link-time addresses of a binary, including the inlined functions."""
+
+	output = subprocess.run(
+		[addr2line, "-a", "-f", "-C", "-i", "-e", str(binary)] + [hex(address) for address in addresses],
+		capture_output=True,
+		text=True,
+		check=False,
+	).stdout.splitlines()
+
+	result: typing.Dict[int, typing.List[str]] = {}
+	current: typing.Optional[typing.List[str]] = None
+	lines = iter(output)
+	for line in lines:
+		if line.startswith("0x"):
+			current = result.setdefault(int(line, 16), [])
+		elif current is not None:
+			location = next(lines, "??:0")
+			current.append(f"{line} at {location}")
+	return result
+
+
+def main() -> int:
+	parser = argparse.ArgumentParser(description="Symbolize the minidumps written by a crashing process.")
+	parser.add_argument(
+		"-s",
+		"--search-path",
+		action="append",
+		type=pathlib.Path,
+		default=[],
+		help="Binary, or directory containing binaries, to use instead of the run-time paths of the modules.",
+	)
+	parser.add_argument("--addr2line", default="addr2line", help="The addr2line executable to use.")
+	parser.add_argument("--all", action="store_true", help="Also show the frames of the crash handler.")
+	parser.add_argument("input", nargs="?", type=pathlib.Path, help="File containing the minidump, stdin if not set.")
+
+	args = parser.parse_args()
+
+	text = args.input.read_text(errors="replace") if args.input else sys.stdin.read()
+	dumps = Minidump.fromText(text)
+	if not dumps:
+		print("No minidump found.", file=sys.stderr)
+		return 1
+
+	for dump in dumps:
+		try:
+			name = signal.Signals(dump.signal).name
+		except ValueError:
+			name = "<unknown>"
+		print(f"Signal: {name} ({dump.signal}){' [truncated]' if dump.truncated else ''}")
+
+		# Skip the frames of the handler, the faulting one is the program counter.
+		frames = dump.frames
+		pc = dump.programCounter
+		if not args.all and pc in frames:
+			frames = frames[frames.index(pc) :]
+
+		# Resolve the frames per module, return addresses point after the call instruction.
+		binaries: typing.Dict[int, typing.Optional[pathlib.Path]] = {}
+		lookups: typing.Dict[int, typing.List[int]] = {}
+		for address in frames:
+			module = dump.findModule(address)
+			if module is None:
+				continue
+			key = dump.modules.index(module)
+			if key not in binaries:
+				binaries[key] = resolveModule(module, args.search_path)
+			lookups.setdefault(key, []).append(address - module.bias - (0 if address == pc else 1))
+		symbols = {
+			key: symbolize(args.addr2line, binaries[key], addresses)  # type: ignore
+			for key, addresses in lookups.items()
+			if binaries[key]
+		}
+
+		for level, address in enumerate(frames):
+			module = dump.findModule(address)
+			if module is None:
+				print(f"#{level} {address:#x} in ??")
+				continue
+			key = dump.modules.index(module)
+			offset = address - module.bias - (0 if address == pc else 1)
+			description = symbols.get(key, {}).get(offset)
+			if not description:
+				reason = "" if binaries[key] else ", binary not found or build id mismatch"
+				print(f"#{level} {address:#x} in {module.path}+{offset:#x}{reason}")
+				continue
+			for index, line in enumerate(description):
+				prefix = f"#{level} {address:#x}" if index == 0 else " " * len(f"#{level} {address:#x}")
+				print(f"{prefix} in {line}")
+
+		print("Registers:")
+		for name, value in dump.namedRegisters.items():
+			print(f"  {name:8} {value:#018x}")
+
+	return 0
+
+
+if __name__ == "__main__":
+	sys.exit(main())
@@ -0,0 +1,135 @@
+import dataclasses
+import struct
+import typing
+
+MAGIC = b"BZDM"
+PREFIX = "minidump:"
+
+TAG_END = 0
+TAG_MODULE = 1
+TAG_REGISTERS = 2
+TAG_FRAMES = 3
+
+FLAG_TRUNCATED = 1
+
+# Register names in the order they are dumped, per ELF machine.
+REGISTER_NAMES: typing.Dict[int, typing.List[str]] = {
+	# x86_64, order of `gregset_t`.
+	62: [
+		"r8",
+		"r9",
+		"r10",
+		"r11",
+		"r12",
+		"r13",
+		"r14",
+		"r15",
+		"rdi",
+		"rsi",
+		"rbp",
+		"rbx",
+		"rdx",
+		"rax",
+		"rcx",
+		"rsp",
+		"rip",
+		"eflags",
+		"csgsfs",
+		"err",
+		"trapno",
+		"oldmask",
+		"cr2",
+	],
+	# aarch64.
+	183: [f"x{index}" for index in range(31)] + ["sp", "pc", "pstate"],
+}
+
+# Name of the program counter register, per ELF machine.
+PROGRAM_COUNTER: typing.Dict[int, str] = {62: "rip", 183: "pc"}
+
+
+@dataclasses.dataclass
+class Module:
+	# Difference between the run-time and the link-time addresses.
+	bias: int
+	start: int
+	end: int
+	buildId: bytes
+	path: str
+
+	def contains(self, address: int) -> bool:
+		return self.start <= address < self.end
+
+
+@dataclasses.dataclass
+class Minidump:
+	machine: int
+	signal: int
+	truncated: bool
+	modules: typing.List[Module] = dataclasses.field(default_factory=list)
+	registers: typing.List[int] = dataclasses.field(default_factory=list)
+	frames: typing.List[int] = dataclasses.field(default_factory=list)
+
+	@staticmethod
+	def fromBytes(data: bytes) -> "Minidump":
+		"""Parse a binary minidump, see cc/bzd/platform/coredump/minidump.hh for the format."""
+
+		if len(data) < 16 or data[0:4] != MAGIC:
+			raise ValueError("Not a minidump, the magic number does not match.")
+		version, machine, signal, flags = struct.unpack_from("<HHiI", data, 4)
+		if version != 1:
+			raise ValueError(f"Unsupported minidump version {version}.")
+		dump = Minidump(machine=machine, signal=signal, truncated=bool(flags & FLAG_TRUNCATED))
+
+		offset = 16
+		while True:
+			if offset + 4 > len(data):
+				raise ValueError("Unexpected end of the minidump.")
+			tag, size = struct.unpack_from("<HH", data, offset)
+			offset += 4
+			payload = data[offset : offset + size]
+			if len(payload) != size:
+				raise ValueError("Unexpected end of the minidump.")
+			offset += size
+
+			if tag == TAG_END:
+				break
+			elif tag == TAG_MODULE:
+				bias, start, end, buildIdSize = struct.unpack_from("<QQQB", payload)
+				buildId = payload[25 : 25 + buildIdSize]
+				path = payload[25 + buildIdSize :].decode(errors="replace")
+				dump.modules.append(Module(bias=bias, start=start, end=end, buildId=buildId, path=path))
+			elif tag == TAG_REGISTERS:
+				dump.registers = list(struct.unpack_from(f"<{size // 8}Q", payload))
+			elif tag == TAG_FRAMES:
+				dump.frames = list(struct.unpack_from(f"<{size // 8}Q", payload))
+			# Unknown records are ignored, for forward compatibility.
+
+		return dump
+
+	@staticmethod
+	def fromText(text: str) -> typing.List["Minidump"]:
+		"""Extract all the minidumps from a text, such as a log."""
+
+		dumps = []
+		for line in text.splitlines():
+			index = line.find(PREFIX)
+			if index != -1:
+				dumps.append(Minidump.fromBytes(bytes.fromhex(line[index + len(PREFIX) :].strip())))
+		return dumps
+
+	def findModule(self, address: int) -> typing.Optional[Module]:
+		for module in self.modules:
+			if module.contains(address):
+				return module
+		return None
+
+	@property
+	def namedRegisters(self) -> typing.Dict[str, int]:
+		names = REGISTER_NAMES.get(self.machine, [])
+		return {(names[index] if index < len(names) else f"r{index}"): value for index, value in enumerate(self.registers)}
+
+	@property
+	def programCounter(self) -> typing.Optional[int]:
+		name = PROGRAM_COUNTER.get(self.machine)
+		return self.namedRegisters.get(name) if name else None
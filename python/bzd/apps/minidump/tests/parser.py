@@ -0,0 +1,61 @@
+import struct
+import unittest
+
+from bzd.apps.minidump.parser import Minidump, TAG_END, TAG_FRAMES, TAG_MODULE, TAG_REGISTERS
+
+
+def makeRecord(tag: int, payload: bytes) -> bytes:
+	return struct.pack("<HH", tag, len(payload)) + payload
+
+
+def makeDump(flags: int = 0) -> bytes:
+	data = b"BZDM" + struct.pack("<HHiI", 1, 62, 11, flags)
+	data += makeRecord(TAG_MODULE, struct.pack("<QQQB", 0x1000, 0x2000, 0x3000, 2) + b"\xab\xcd" + b"/bin/a")
+	data += makeRecord(TAG_MODULE, struct.pack("<QQQB", 0x7000, 0x8000, 0x9000, 0) + b"/lib/b.so")
+	registers = [0] * 23
+	registers[16] = 0x2010
+	data += makeRecord(TAG_REGISTERS, struct.pack("<23Q", *registers))
+	data += makeRecord(TAG_FRAMES, struct.pack("<4Q", 0x8100, 0x2010, 0x2020, 0x10))
+	# Unknown records are skipped.
+	data += makeRecord(42, b"future")
+	return data + makeRecord(TAG_END, b"")
+
+
+class TestRun(unittest.TestCase):
+	def testParse(self) -> None:
+		dump = Minidump.fromBytes(makeDump())
+		self.assertEqual(dump.machine, 62)
+		self.assertEqual(dump.signal, 11)
+		self.assertFalse(dump.truncated)
+		self.assertEqual(len(dump.modules), 2)
+		self.assertEqual(dump.modules[0].bias, 0x1000)
+		self.assertEqual(dump.modules[0].buildId, b"\xab\xcd")
+		self.assertEqual(dump.modules[0].path, "/bin/a")
+		self.assertEqual(dump.modules[1].buildId, b"")
+		self.assertEqual(dump.modules[1].path, "/lib/b.so")
+		self.assertEqual(dump.frames, [0x8100, 0x2010, 0x2020, 0x10])
+		self.assertEqual(dump.programCounter, 0x2010)
+		self.assertEqual(dump.namedRegisters["rip"], 0x2010)
+
+	def testFindModule(self) -> None:
+		dump = Minidump.fromBytes(makeDump())
+		self.assertEqual(dump.findModule(0x2020), dump.modules[0])
+		self.assertEqual(dump.findModule(0x8fff), dump.modules[1])
+		self.assertIsNone(dump.findModule(0x3000))
+
+	def testFromText(self) -> None:
+		text = "\n".join(["[i] some log", "Caught signal: SIGSEGV", "[e] minidump:" + makeDump(flags=1).hex(), "end"])
+		dumps = Minidump.fromText(text)
+		self.assertEqual(len(dumps), 1)
+		self.assertTrue(dumps[0].truncated)
+		self.assertEqual(len(dumps[0].frames), 4)
+
+	def testInvalid(self) -> None:
+		with self.assertRaises(ValueError):
+			Minidump.fromBytes(b"XXXX" + bytes(12))
+		with self.assertRaises(ValueError):
+			Minidump.fromBytes(makeDump()[:-4])
+
+
+if __name__ == "__main__":
+	unittest.main()
@@ -130,6 +130,15 @@ class Result(Builtin):
 		super().__init__(ElementBuilder("builtin").setAttr("name", "Result").addConfigType(name="Value", symbol="Any"))
 
 
+class Optional(Builtin):
+	def __init__(self) -> None:
+		super().__init__(
+			ElementBuilder("builtin")
+			.setAttr("name", "Optional")
+			.addConfigType(symbol="Any", name="Type", contract="mandatory")
+		)
+
+
 class Async(Builtin):
 	def __init__(self) -> None:
 		super().__init__(ElementBuilder("builtin").setAttr("name", "Async").addConfigType(name="Value", symbol="Any"))
@@ -173,6 +182,7 @@ Builtins = [
 	Byte(),
 	String(),
 	Result(),
+	Optional(),
 	Async(),
 	Array(),
 	Vector(),
@@ -13,6 +13,7 @@ from bdl.contracts.init import ContractInit
 from bdl.contracts.shutdown import ContractShutdown
 from bdl.contracts.convertible import ContractConvertible
 from bdl.contracts.executor import ContractExecutor
+from bdl.contracts.frame_size import ContractFrameSize
 
 _Contracts = [
 	ContractInteger(),
@@ -27,6 +28,7 @@ _Contracts = [
 	ContractShutdown(),
 	ContractConvertible(),
 	ContractExecutor(),
+	ContractFrameSize(),
 ]
 
 
@@ -0,0 +1,18 @@
+import typing
+
+import bzd.validation.validation
+from bzd.validation.schema import Constraint, ProcessedSchema
+
+from bdl.contracts.traits import ContractTraits, Role
+
+
+class FrameSizeConstraint_(Constraint):
+	def install(self, processedSchema: ProcessedSchema, args: typing.List[str]) -> None:
+		bzd.validation.validation.Validation(schema=["integer min(1) mandatory"]).validate(args)
+
+
+class ContractFrameSize(ContractTraits):
+	"""Number of bytes statically reserved for the coroutine frames of a composition entry point."""
+
+	def __init__(self) -> None:
+		super().__init__(name="frameSize", role=Role.Entity | Role.Public, constraint=FrameSizeConstraint_)
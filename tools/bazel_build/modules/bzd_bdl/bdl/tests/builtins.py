@@ -173,6 +173,26 @@ class TestRun(unittest.TestCase):
 			objectContext=ObjectContext(resolve=True),
 		)
 
+	def testOptional(self) -> None:
+		# No template
+		with self.assertRaisesRegex(Exception, r"mandatory"):
+			Object.fromContent(
+				content="struct temp { var = Optional; }",
+				objectContext=ObjectContext(resolve=True),
+			)
+
+		# Template
+		Object.fromContent(
+			content="struct temp { var = Optional<Integer>; }",
+			objectContext=ObjectContext(resolve=True),
+		)
+
+		with self.assertRaisesRegex(Exception, r"not expected"):
+			Object.fromContent(
+				content="struct temp { var = Optional<Integer, Void>; }",
+				objectContext=ObjectContext(resolve=True),
+			)
+
 	def testVector(self) -> None:
 		# No template
 		with self.assertRaisesRegex(Exception, r"mandatory"):
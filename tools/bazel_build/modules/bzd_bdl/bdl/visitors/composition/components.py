@@ -117,6 +117,12 @@ class ExpressionEntry:
 	def isService(self) -> bool:
 		return EntryType.service in self.entryType
 
+	@property
+	def frameSize(self) -> typing.Optional[int]:
+		"""Number of bytes reserved for the coroutine frames of this entry, if set."""
+		maybeFrameSize = self.expression.contracts.get("frameSize")
+		return None if maybeFrameSize is None else int(maybeFrameSize.valueNumber)
+
 	def __repr__(self) -> str:
 		content = [
 			f"type: {str(self.entryType)}",
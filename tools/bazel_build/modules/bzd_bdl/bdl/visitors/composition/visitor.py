@@ -1,3 +1,4 @@
+import dataclasses
 import typing
 import enum
 
@@ -17,6 +18,45 @@ class AsyncType(enum.Enum):
 	service = "service"
 
 
+@dataclasses.dataclass
+class Binding:
+	"""A configuration parameter of a registry entry bound to an interface implementation."""
+
+	# The registry entry using this binding.
+	fqn: str
+	# The name of the configuration parameter.
+	name: str
+	# The interface expected.
+	interface: str
+	# The registry entry implementing the interface.
+	implementation: str
+
+
+@dataclasses.dataclass
+class Wiring:
+	"""How the components of a context are wired together."""
+
+	# Instantiated components.
+	components: typing.List[str]
+	# Components declared but not referenced, hence not instantiated. They are not discarded here, the registry
+	# only contains the executors, the workloads and their dependencies, see `Entities.process`.
+	unreferenced: typing.List[str]
+	# Interface bindings between the instantiated components.
+	bindings: typing.List[Binding]
+
+	@property
+	def componentCount(self) -> int:
+		return len(self.components)
+
+	@property
+	def unreferencedCount(self) -> int:
+		return len(self.unreferenced)
+
+	@property
+	def bindingCount(self) -> int:
+		return len(self.bindings)
+
+
 class CompositionView:
 	"""Create a composition view, this is the interface exposed to the composition template."""
 
@@ -45,6 +85,56 @@ class CompositionView:
 	def iosRegistry(self) -> typing.Dict[str, typing.Dict[str, typing.Any]]:
 		return self.composition.iosRegistry
 
+	@property
+	def outputs(self) -> typing.Dict[Context, typing.Optional[str]]:
+		"""The registry entry used as output for each context, the one declared as `bzd.OStream`, if there is exactly one."""
+
+		result: typing.Dict[Context, typing.Optional[str]] = {}
+		for context, data in self.registry.items():
+			outputs = [
+				fqn
+				for fqn, entry in data.items()
+				if entry.expression.isInterfaceType and entry.expression.interfaceType.fqn == "bzd.OStream"
+			]
+			result[context] = outputs[0] if len(outputs) == 1 else None
+		return result
+
+	@property
+	def wiring(self) -> typing.Dict[Context, Wiring]:
+		"""The wiring of the components for each context."""
+
+		targets = {context.target for context in self.composition.contexts}
+		instantiated = {fqn for data in self.composition.registry.values() for fqn in data.keys()}
+
+		result: typing.Dict[Context, Wiring] = {}
+		for context, data in self.registry.items():
+			# Components from this target or from no target at all are expected to be used.
+			unreferenced = [
+				fqn
+				for fqn in self.composition.components.keys()
+				if fqn not in data
+				and (fqn.split(".")[0] == self.target or (fqn.split(".")[0] not in targets and fqn not in instantiated))
+			]
+
+			bindings: typing.List[Binding] = []
+			for fqn, entry in data.items():
+				for item in entry.expression.parametersResolved:
+					if item.param.isLiteral or not item.isLValue:
+						continue
+					for dependency in sorted(item.param.dependencies):
+						if dependency in data and data[dependency].expression.isInterfaceType:
+							bindings.append(
+								Binding(
+									fqn=fqn,
+									name=item.name,
+									interface=data[dependency].expression.interfaceType.fqn,
+									implementation=dependency,
+								)
+							)
+
+			result[context] = Wiring(components=list(data.keys()), unreferenced=sorted(unreferenced), bindings=bindings)
+		return result
+
 	def isValidTarget(self, target: str) -> bool:
 		return target == self.target
 
@@ -96,6 +186,19 @@ class Composition:
 	def iosRegistry(self) -> typing.Dict[str, typing.Dict[str, typing.Any]]:
 		return self.entities.iosRegistry
 
+	@property
+	def components(self) -> typing.Dict[str, Expression]:
+		"""All the component instances declared in the compositions, whether they are used or not."""
+
+		return {
+			fqn: entity
+			for fqn, entity in self.symbols.items(groups={Group.composition | Group.topLevel})
+			if isinstance(entity, Expression)
+			and entity.isName
+			and entity.isSymbol
+			and entity.symbol.category == Category.component
+		}
+
 	def visit(self, bdl: Object) -> "Composition":
 		"""Add a specific BDL object to the composition.
 
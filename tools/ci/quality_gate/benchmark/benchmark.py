@@ -0,0 +1,130 @@
+import argparse
+import json
+import os
+import pathlib
+import statistics
+import sys
+import typing
+
+from tools.ci.quality_gate.benchmark.results import ResultSet
+from tools.ci.quality_gate.benchmark.significance import compare
+
+
+def resolvePath(path: str) -> pathlib.Path:
+	"""Paths are relative to the directory where `bazel run` was invoked."""
+
+	return pathlib.Path(os.environ.get("BUILD_WORKING_DIRECTORY", ".")) / path
+
+
+def formatTime(ns: float) -> str:
+	for unit, scale in (("s", 1e9), ("ms", 1e6), ("us", 1e3)):
+		if ns >= scale:
+			return f"{ns / scale:.2f} {unit}"
+	return f"{ns:.2f} ns"
+
+
+def formatChange(change: float) -> str:
+	return f"{change * 100:+.1f}%"
+
+
+def commandCollect(args: argparse.Namespace) -> int:
+	resultSet = ResultSet.fromPaths([resolvePath(path) for path in args.inputs])
+	if not resultSet.results:
+		print("No benchmark results found.", file=sys.stderr)
+		return 1
+	content = json.dumps(resultSet.toJson(), indent=4)
+	if args.output:
+		resolvePath(args.output).write_text(content)
+	else:
+		print(content)
+	return 0
+
+
+def commandCompare(args: argparse.Namespace) -> int:
+	baseline = ResultSet.fromPaths([resolvePath(args.baseline)])
+	candidate = ResultSet.fromPaths([resolvePath(args.candidate)])
+
+	rows: typing.List[typing.Tuple[str, ...]] = []
+	regressions = 0
+	improvements = 0
+	for name in sorted(set(baseline.results) | set(candidate.results)):
+		if name not in candidate.results:
+			rows.append((name, formatTime(statistics.median(baseline.results[name].samples)), "-", "", "", "", "missing"))
+			continue
+		if name not in baseline.results:
+			rows.append((name, "-", formatTime(statistics.median(candidate.results[name].samples)), "", "", "", "new"))
+			continue
+
+		before = baseline.results[name]
+		after = candidate.results[name]
+		comparison = compare(before.samples, after.samples, confidence=args.confidence)
+		isRegression = False
+		notes: typing.List[str] = []
+		# The samples of a run are not independent from run-level effects (frequency scaling, memory layout...),
+		# so the whole confidence interval must be beyond the threshold, not only the median.
+		if comparison.pValue < 1 - args.confidence:
+			if comparison.low > args.threshold / 100:
+				isRegression = True
+			elif comparison.high < -args.threshold / 100:
+				notes.append("improvement")
+				improvements += 1
+		if before.allocations is not None and after.allocations is not None and after.allocations > before.allocations + 1e-3:
+			notes.append(f"allocations {before.allocations:.3f} -> {after.allocations:.3f}")
+			isRegression = isRegression or args.allocations
+		if isRegression:
+			notes.insert(0, "REGRESSION")
+			regressions += 1
+		rows.append(
+			(
+				name,
+				formatTime(statistics.median(before.samples)),
+				formatTime(statistics.median(after.samples)),
+				formatChange(comparison.change),
+				f"[{formatChange(comparison.low)}, {formatChange(comparison.high)}]",
+				f"{comparison.pValue:.3f}",
+				", ".join(notes),
+			)
+		)
+
+	header = ("Benchmark", "Baseline", "Candidate", "Change", f"{args.confidence * 100:.0f}% CI", "p-value", "")
+	widths = [max(len(row[column]) for row in [header] + rows) for column in range(len(header))]
+	for row in [header] + rows:
+		print("  ".join(cell.ljust(width) for cell, width in zip(row, widths)).rstrip())
+
+	print(
+		f"\n{len(rows)} benchmark(s), {regressions} regression(s), {improvements} improvement(s), threshold {args.threshold}%."
+	)
+	return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+	parser = argparse.ArgumentParser(description="Benchmark results collection and regression detection.")
+	subparsers = parser.add_subparsers(dest="command", required=True)
+
+	parserCollect = subparsers.add_parser(
+		"collect", help="Gather the results from test logs, JSON lines or result sets into a single result set."
+	)
+	parserCollect.add_argument("--output", help="Where to write the result set, standard output if not set.")
+	parserCollect.add_argument("inputs", nargs="+", help="Files or directories (such as bazel-testlogs) to be collected.")
+
+	parserCompare = subparsers.add_parser("compare", help="Compare a candidate against a baseline.")
+	parserCompare.add_argument(
+		"--threshold",
+		type=float,
+		default=10.0,
+		help="Relative change of the median in percent, a slowdown with a confidence interval entirely above it is a regression.",
+	)
+	parserCompare.add_argument(
+		"--confidence", type=float, default=0.95, help="Confidence level of the statistical tests."
+	)
+	parserCompare.add_argument(
+		"--allocations",
+		action=argparse.BooleanOptionalAction,
+		default=True,
+		help="Treat an increase of the number of allocations per iteration as a regression.",
+	)
+	parserCompare.add_argument("baseline", help="The baseline results.")
+	parserCompare.add_argument("candidate", help="The candidate results.")
+
+	args = parser.parse_args()
+	sys.exit(commandCollect(args) if args.command == "collect" else commandCompare(args))
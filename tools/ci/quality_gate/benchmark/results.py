@@ -0,0 +1,92 @@
+import dataclasses
+import json
+import pathlib
+import typing
+
+# Prefix of the lines reported by the C++ test framework.
+PREFIX = "[ BENCHMARK] "
+
+
+@dataclasses.dataclass
+class Result:
+	"""The result of a single benchmark."""
+
+	name: str
+	# Time per iteration in nanoseconds.
+	samples: typing.List[float]
+	# Average number of heap allocations per iteration, if counted.
+	allocations: typing.Optional[float] = None
+
+	@staticmethod
+	def fromJson(data: typing.Dict[str, typing.Any]) -> "Result":
+		return Result(
+			name=str(data["name"]),
+			samples=[float(sample) for sample in data["samples"]],
+			allocations=None if data.get("allocations") is None else float(data["allocations"]),
+		)
+
+	def toJson(self) -> typing.Dict[str, typing.Any]:
+		return {"name": self.name, "samples": self.samples, "allocations": self.allocations}
+
+
+class ResultSet:
+	"""A set of benchmark results, indexed by name.
+
+	Results with the same name, for example from several runs of the same test, are merged.
+	"""
+
+	def __init__(self) -> None:
+		self.results: typing.Dict[str, Result] = {}
+
+	def add(self, result: Result) -> None:
+		if result.name in self.results:
+			previous = self.results[result.name]
+			previous.samples += result.samples
+			if previous.allocations is None or result.allocations is None:
+				previous.allocations = None
+			else:
+				previous.allocations = max(previous.allocations, result.allocations)
+		else:
+			self.results[result.name] = Result(name=result.name, samples=list(result.samples), allocations=result.allocations)
+
+	def addText(self, text: str) -> None:
+		"""Add the results from a text, either a test log or JSON lines."""
+
+		for line in text.splitlines():
+			index = line.find(PREFIX)
+			line = line[index + len(PREFIX) :] if index != -1 else line.strip()
+			if not line.startswith("{"):
+				continue
+			try:
+				data = json.loads(line)
+			except json.JSONDecodeError:
+				continue
+			if isinstance(data, dict) and "name" in data and "samples" in data:
+				self.add(Result.fromJson(data))
+
+	def addPath(self, path: pathlib.Path) -> None:
+		"""Add the results from a file or from all the test logs of a directory, such as `bazel-testlogs`."""
+
+		if path.is_dir():
+			for log in sorted(path.rglob("test.log")):
+				self.addText(log.read_text(errors="replace"))
+			return
+
+		text = path.read_text(errors="replace")
+		try:
+			data = json.loads(text)
+		except json.JSONDecodeError:
+			self.addText(text)
+			return
+		for item in data.get("benchmarks", []) if isinstance(data, dict) else data:
+			self.add(Result.fromJson(item))
+
+	@staticmethod
+	def fromPaths(paths: typing.Iterable[pathlib.Path]) -> "ResultSet":
+		resultSet = ResultSet()
+		for path in paths:
+			resultSet.addPath(path)
+		return resultSet
+
+	def toJson(self) -> typing.Dict[str, typing.Any]:
+		return {"benchmarks": [self.results[name].toJson() for name in sorted(self.results)]}
@@ -0,0 +1,119 @@
+import dataclasses
+import math
+import random
+import statistics
+import typing
+
+
+@dataclasses.dataclass
+class Comparison:
+	"""Result of the comparison of two sets of samples."""
+
+	# Relative change of the median, positive if the candidate is greater.
+	change: float
+	# Confidence interval of the relative change of the median.
+	low: float
+	high: float
+	# Two-sided p-value of the Mann-Whitney U test.
+	pValue: float
+
+
+def rankSum(first: typing.Sequence[float], second: typing.Sequence[float]) -> typing.Tuple[float, typing.List[int]]:
+	"""Compute the sum of the ranks of the first sequence within both, ties get their average rank.
+
+	Returns:
+		The sum of the ranks and the size of each group of ties.
+	"""
+
+	values = sorted([(value, 0) for value in first] + [(value, 1) for value in second])
+	total = 0.0
+	ties = []
+	index = 0
+	while index < len(values):
+		end = index
+		while end + 1 < len(values) and values[end + 1][0] == values[index][0]:
+			end += 1
+		rank = (index + end) / 2 + 1
+		total += rank * sum(1 for _, group in values[index:end + 1] if group == 0)
+		if end > index:
+			ties.append(end - index + 1)
+		index = end + 1
+	return total, ties
+
+
+def exactDistribution(n1: int, n2: int) -> typing.List[int]:
+	"""Number of arrangements giving each value of U, for samples without ties."""
+
+	# counts[m][n] is the distribution for sizes m and n, built incrementally.
+	counts: typing.List[typing.List[typing.List[int]]] = [[[1] for _ in range(n2 + 1)] for _ in range(n1 + 1)]
+	for m in range(1, n1 + 1):
+		for n in range(1, n2 + 1):
+			distribution = [0] * (m * n + 1)
+			# The largest value belongs either to the first sample (adding n to U) or to the second one.
+			for u, count in enumerate(counts[m - 1][n]):
+				distribution[u + n] += count
+			for u, count in enumerate(counts[m][n - 1]):
+				distribution[u] += count
+			counts[m][n] = distribution
+	return counts[n1][n2]
+
+
+def mannWhitney(first: typing.Sequence[float], second: typing.Sequence[float]) -> float:
+	"""Two-sided p-value of the Mann-Whitney U test.
+
+	The exact distribution is used for small samples without ties, the normal approximation with tie and
+	continuity corrections otherwise.
+	"""
+
+	n1 = len(first)
+	n2 = len(second)
+	if n1 == 0 or n2 == 0:
+		return 1.0
+	total, ties = rankSum(first, second)
+	u = total - n1 * (n1 + 1) / 2
+
+	if not ties and n1 * n2 <= 2500:
+		distribution = exactDistribution(n1, n2)
+		count = sum(distribution)
+		lower = sum(distribution[:int(u) + 1]) / count
+		upper = sum(distribution[int(u):]) / count
+		return min(1.0, 2 * min(lower, upper))
+
+	n = n1 + n2
+	mean = n1 * n2 / 2
+	variance = n1 * n2 / 12 * ((n + 1) - sum(t**3 - t for t in ties) / (n * (n - 1)))
+	if variance <= 0:
+		return 1.0
+	z = max(0.0, abs(u - mean) - 0.5) / math.sqrt(variance)
+	return min(1.0, 2 * (1 - statistics.NormalDist().cdf(z)))
+
+
+def medianChangeInterval(
+	first: typing.Sequence[float], second: typing.Sequence[float], confidence: float, resamples: int = 2000
+) -> typing.Tuple[float, float]:
+	"""Bootstrap confidence interval of the relative change of the median from the first to the second sequence.
+
+	The random generator is seeded, so the result is reproducible.
+	"""
+
+	generator = random.Random(0)
+	changes = []
+	for _ in range(resamples):
+		median1 = statistics.median(generator.choices(first, k=len(first)))
+		median2 = statistics.median(generator.choices(second, k=len(second)))
+		if median1 > 0:
+			changes.append(median2 / median1 - 1)
+	if not changes:
+		return 0.0, 0.0
+	changes.sort()
+	alpha = (1 - confidence) / 2
+	return changes[int(alpha * (len(changes) - 1))], changes[math.ceil((1 - alpha) * (len(changes) - 1))]
+
+
+def compare(baseline: typing.Sequence[float], candidate: typing.Sequence[float], confidence: float = 0.95) -> Comparison:
+	"""Compare the samples of a candidate against a baseline."""
+
+	median = statistics.median(baseline)
+	change = (statistics.median(candidate) / median - 1) if median > 0 else 0.0
+	low, high = medianChangeInterval(baseline, candidate, confidence)
+	return Comparison(change=change, low=low, high=high, pValue=mannWhitney(baseline, candidate))
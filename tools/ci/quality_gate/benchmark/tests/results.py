@@ -0,0 +1,48 @@
+import json
+import pathlib
+import tempfile
+import unittest
+
+from tools.ci.quality_gate.benchmark.results import ResultSet
+
+LOG = """[ RUN      ] Sort.Random (seed=12)
+[ BENCHMARK] {"name": "Sort.Random", "iterations": 10, "samples": [1.0, 2.0], "median": 2.0, "mean": 1.5, "min": 1.0, "cycles": 3.0, "allocations": null}
+[       OK ]
+[ RUN      ] Map.Insert (seed=12)
+[ BENCHMARK] {"name": "Map.Insert", "iterations": 10, "samples": [4.0], "median": 4.0, "mean": 4.0, "min": 4.0, "cycles": 8.0, "allocations": 1.000}
+[       OK ]
+PASSED (0 failed)
+"""
+
+
+class TestRun(unittest.TestCase):
+	def testLog(self) -> None:
+		resultSet = ResultSet()
+		resultSet.addText(LOG)
+		self.assertEqual(sorted(resultSet.results), ["Map.Insert", "Sort.Random"])
+		self.assertEqual(resultSet.results["Sort.Random"].samples, [1.0, 2.0])
+		self.assertIsNone(resultSet.results["Sort.Random"].allocations)
+		self.assertEqual(resultSet.results["Map.Insert"].allocations, 1.0)
+
+	def testMerge(self) -> None:
+		resultSet = ResultSet()
+		resultSet.addText(LOG)
+		resultSet.addText(LOG)
+		self.assertEqual(resultSet.results["Sort.Random"].samples, [1.0, 2.0, 1.0, 2.0])
+
+	def testPaths(self) -> None:
+		with tempfile.TemporaryDirectory() as directory:
+			root = pathlib.Path(directory)
+			(root / "cc" / "sort").mkdir(parents=True)
+			(root / "cc" / "sort" / "test.log").write_text(LOG)
+			fromDirectory = ResultSet.fromPaths([root])
+			self.assertEqual(len(fromDirectory.results), 2)
+
+			# A result set can be read back.
+			(root / "results.json").write_text(json.dumps(fromDirectory.toJson()))
+			fromJson = ResultSet.fromPaths([root / "results.json"])
+			self.assertEqual(fromJson.toJson(), fromDirectory.toJson())
+
+
+if __name__ == "__main__":
+	unittest.main()
@@ -0,0 +1,49 @@
+import unittest
+
+from tools.ci.quality_gate.benchmark.significance import compare, exactDistribution, mannWhitney, rankSum
+
+
+class TestRun(unittest.TestCase):
+	def testRankSum(self) -> None:
+		total, ties = rankSum([1, 2, 3], [4, 5, 6])
+		self.assertEqual(total, 6)
+		self.assertEqual(ties, [])
+		total, ties = rankSum([1, 2, 2], [2, 3])
+		self.assertEqual(total, 1 + 3 + 3)
+		self.assertEqual(ties, [3])
+
+	def testExactDistribution(self) -> None:
+		# All the arrangements of 2 + 2 elements.
+		self.assertEqual(exactDistribution(2, 2), [1, 1, 2, 1, 1])
+		self.assertEqual(sum(exactDistribution(10, 10)), 184756)
+
+	def testMannWhitneyExact(self) -> None:
+		# Fully separated samples of 5: the smallest two-sided p-value is 2 / C(10, 5).
+		self.assertAlmostEqual(mannWhitney([1, 2, 3, 4, 5], [6, 7, 8, 9, 10]), 2 / 252)
+		self.assertAlmostEqual(mannWhitney([6, 7, 8, 9, 10], [1, 2, 3, 4, 5]), 2 / 252)
+		# Symmetric.
+		self.assertEqual(mannWhitney([1, 3, 5, 7], [2, 4, 6, 8]), mannWhitney([2, 4, 6, 8], [1, 3, 5, 7]))
+		self.assertGreater(mannWhitney([1, 3, 5, 7], [2, 4, 6, 8]), 0.5)
+
+	def testMannWhitneyTies(self) -> None:
+		self.assertEqual(mannWhitney([1, 1, 1], [1, 1, 1]), 1.0)
+		self.assertLess(mannWhitney([1, 1, 2, 2, 3] * 4, [5, 5, 6, 6, 7] * 4), 0.001)
+
+	def testCompare(self) -> None:
+		baseline = [100.0, 101.0, 99.0, 100.5, 99.5, 100.2, 99.8, 100.1, 99.9, 100.3]
+		comparison = compare(baseline, [value * 1.2 for value in baseline])
+		self.assertAlmostEqual(comparison.change, 0.2)
+		self.assertLess(comparison.pValue, 0.001)
+		self.assertLessEqual(comparison.low, comparison.change)
+		self.assertGreaterEqual(comparison.high, comparison.change)
+		self.assertGreater(comparison.low, 0.1)
+
+		comparison = compare(baseline, list(reversed(baseline)))
+		self.assertEqual(comparison.change, 0.0)
+		self.assertEqual(comparison.pValue, 1.0)
+		self.assertLess(comparison.low, 0.0)
+		self.assertGreater(comparison.high, 0.0)
+
+
+if __name__ == "__main__":
+	unittest.main()